@@ -1,6 +1,8 @@
 #include "dev_test_mode.h"
 #include "game.h"
 #include "gravity_system.h"
+#include "profiler.h"
+#include "../render/render.h"
 #include <raymath.h>
 #include <string.h>
 #include <stdio.h>
@@ -20,6 +22,9 @@ static const char* ENEMY_TYPE_NAMES[] = {
     "BLACKHOLE"     // ENEMY_TYPE_BLACKHOLE
 };
 
+#define PROFILER_TRACE_FILENAME "profile_trace.json"
+#define PROFILER_OVERLAY_FRAMES 60     // Averaging window for the overlay (1 second at 60 FPS)
+
 // Keyboard shortcuts for enemy selection (1-9, 0 for BLACKHOLE)
 static const int ENEMY_SELECTION_KEYS[] = {
     KEY_ONE,    // ENEMY_TYPE_BASIC
@@ -42,6 +47,7 @@ TestModeState InitTestMode(void) {
         .selectedEnemyType = ENEMY_TYPE_BASIC,
         .showHelp = true,  // Show help on startup
         .showGravityFields = false,  // Gravity visualization off by default
+        .showProfiler = true,  // Frame time breakdown on by default
         .enemiesSpawned = 0,
         .enemiesRemoved = 0
     };
@@ -74,9 +80,17 @@ void HandleTestModeKeyboard(TestModeState* state, void* gamePtr) {
         state->showGravityFields = !state->showGravityFields;
     }
 
+    // Toggle profiler overlay with F2, save the recorded frames as a Chrome trace with F3
+    if (IsKeyPressed(KEY_F2)) {
+        state->showProfiler = !state->showProfiler;
+    }
+    if (IsKeyPressed(KEY_F3)) {
+        Profiler_WriteChromeTrace(PROFILER_TRACE_FILENAME);
+    }
+
     // Clear all enemies with C
     if (IsKeyPressed(KEY_C)) {
-        game->enemyCount = 0;
+        ClearEnemies(game);
         state->enemiesRemoved = state->enemiesSpawned;
     }
 
@@ -113,15 +127,15 @@ void HandleTestModeKeyboard(TestModeState* state, void* gamePtr) {
 
     // State manipulation keys (work on nearest enemy to cursor)
     if (IsKeyPressed(KEY_I) || IsKeyPressed(KEY_S) || IsKeyPressed(KEY_P)) {
-        if (game->enemyCount > 0) {
+        if (game->enemies.count > 0) {
             Vector2 mousePos = GetMousePosition();
 
             // Find nearest enemy
             int nearestIndex = -1;
             float nearestDistance = 999999.0f;
 
-            for (int i = 0; i < game->enemyCount; i++) {
-                float distance = Vector2Distance(game->enemies[i].position, mousePos);
+            for (int i = 0; i < game->enemies.count; i++) {
+                float distance = Vector2Distance(game->enemies.items[i].position, mousePos);
                 if (distance < nearestDistance) {
                     nearestDistance = distance;
                     nearestIndex = i;
@@ -129,7 +143,7 @@ void HandleTestModeKeyboard(TestModeState* state, void* gamePtr) {
             }
 
             if (nearestIndex >= 0 && nearestDistance <= 150.0f) {
-                Enemy* enemy = &game->enemies[nearestIndex];
+                Enemy* enemy = &game->enemies.items[nearestIndex];
 
                 if (IsKeyPressed(KEY_I)) {
                     // Toggle Invulnerability
@@ -166,24 +180,25 @@ void HandleTestModeMouseInput(TestModeState* state, void* gamePtr) {
         Vector2 mousePos = GetMousePosition();
 
         // Check if we can spawn more enemies
-        if (game->enemyCount >= MAX_ENEMIES) {
+        if (EnemyStore_IsFull(&game->enemies)) {
             return;  // Max enemies reached
         }
 
         // Spawn enemy at mouse position
+        EnemyMotion motion;
         Enemy newEnemy = InitEnemyByType(
             state->selectedEnemyType,
             game->screenWidth,
             game->screenHeight,
-            game->player.position
+            game->player.position,
+            &motion
         );
 
         // Override spawn position with mouse position
         newEnemy.position = mousePos;
 
-        // Add to game's enemy array
-        game->enemies[game->enemyCount] = newEnemy;
-        game->enemyCount++;
+        // Add to game's enemy store
+        EnemyStore_Add(&game->enemies, &newEnemy, &motion);
         state->enemiesSpawned++;
     }
 }
@@ -194,14 +209,14 @@ void HandleTestModeMouseInput(TestModeState* state, void* gamePtr) {
 bool RemoveNearestEnemy(void* gamePtr, Vector2 mousePos) {
     Game* game = (Game*)gamePtr;
 
-    if (game->enemyCount == 0) return false;
+    if (game->enemies.count == 0) return false;
 
     // Find nearest enemy
     int nearestIndex = -1;
     float nearestDistance = 999999.0f;
 
-    for (int i = 0; i < game->enemyCount; i++) {
-        float distance = Vector2Distance(game->enemies[i].position, mousePos);
+    for (int i = 0; i < game->enemies.count; i++) {
+        float distance = Vector2Distance(game->enemies.items[i].position, mousePos);
         if (distance < nearestDistance) {
             nearestDistance = distance;
             nearestIndex = i;
@@ -209,11 +224,8 @@ bool RemoveNearestEnemy(void* gamePtr, Vector2 mousePos) {
     }
 
     if (nearestIndex >= 0) {
-        // Remove enemy by shifting array
-        for (int i = nearestIndex; i < game->enemyCount - 1; i++) {
-            game->enemies[i] = game->enemies[i + 1];
-        }
-        game->enemyCount--;
+        // Swap-remove (the last enemy takes its slot)
+        RemoveEnemyAt(game, nearestIndex);
         return true;
     }
 
@@ -226,7 +238,7 @@ bool RemoveNearestEnemy(void* gamePtr, Vector2 mousePos) {
 void DrawEnemyStateDebug(void* gamePtr, int screenWidth, int screenHeight) {
     Game* game = (Game*)gamePtr;
 
-    if (game->enemyCount == 0) return;
+    if (game->enemies.count == 0) return;
 
     Vector2 mousePos = GetMousePosition();
 
@@ -234,8 +246,8 @@ void DrawEnemyStateDebug(void* gamePtr, int screenWidth, int screenHeight) {
     int nearestIndex = -1;
     float nearestDistance = 999999.0f;
 
-    for (int i = 0; i < game->enemyCount; i++) {
-        float distance = Vector2Distance(game->enemies[i].position, mousePos);
+    for (int i = 0; i < game->enemies.count; i++) {
+        float distance = Vector2Distance(game->enemies.items[i].position, mousePos);
         if (distance < nearestDistance) {
             nearestDistance = distance;
             nearestIndex = i;
@@ -244,7 +256,7 @@ void DrawEnemyStateDebug(void* gamePtr, int screenWidth, int screenHeight) {
 
     if (nearestIndex < 0 || nearestDistance > 150.0f) return;  // Only show if within 150px
 
-    Enemy* enemy = &game->enemies[nearestIndex];
+    Enemy* enemy = &game->enemies.items[nearestIndex];
 
     // Draw debug panel (bottom-left)
     int panelX = 10;
@@ -252,80 +264,121 @@ void DrawEnemyStateDebug(void* gamePtr, int screenWidth, int screenHeight) {
     int panelWidth = 350;
     int panelHeight = 210;
 
-    DrawRectangle(panelX, panelY, panelWidth, panelHeight, Fade(BLACK, 0.85f));
-    DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, SKYBLUE);
+    Render_DrawRectangle(panelX, panelY, panelWidth, panelHeight, Fade(BLACK, 0.85f));
+    Render_DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, SKYBLUE);
 
     int textY = panelY + 10;
     int lineHeight = 18;
 
     // Title
-    DrawText("ENEMY STATE DEBUG", panelX + 10, textY, 16, SKYBLUE);
+    Render_DrawText("ENEMY STATE DEBUG", panelX + 10, textY, 16, SKYBLUE);
     textY += 25;
 
     // Enemy type
     char buffer[128];
     sprintf(buffer, "Type: %s", GetEnemyTypeName(enemy->type));
-    DrawText(buffer, panelX + 10, textY, 14, WHITE);
+    Render_DrawText(buffer, panelX + 10, textY, 14, WHITE);
     textY += lineHeight;
 
     // Health
     sprintf(buffer, "Health: %.1f / %.1f", enemy->health, enemy->maxHealth);
-    DrawText(buffer, panelX + 10, textY, 14, WHITE);
+    Render_DrawText(buffer, panelX + 10, textY, 14, WHITE);
     textY += lineHeight;
 
     // State flags (show individual flags)
-    DrawText("State Flags:", panelX + 10, textY, 14, YELLOW);
+    Render_DrawText("State Flags:", panelX + 10, textY, 14, YELLOW);
     textY += lineHeight;
 
     if (enemy->stateFlags == ENEMY_STATE_NONE) {
-        DrawText("  NONE", panelX + 10, textY, 12, LIGHTGRAY);
+        Render_DrawText("  NONE", panelX + 10, textY, 12, LIGHTGRAY);
         textY += lineHeight;
     } else {
         if (HasState(enemy->stateFlags, ENEMY_STATE_INVULNERABLE)) {
-            DrawText("  INVULNERABLE", panelX + 10, textY, 12, RED);
+            Render_DrawText("  INVULNERABLE", panelX + 10, textY, 12, RED);
             textY += lineHeight;
         }
         if (HasState(enemy->stateFlags, ENEMY_STATE_SHIELDED)) {
-            DrawText("  SHIELDED", panelX + 10, textY, 12, SKYBLUE);
+            Render_DrawText("  SHIELDED", panelX + 10, textY, 12, SKYBLUE);
             textY += lineHeight;
         }
         if (HasState(enemy->stateFlags, ENEMY_STATE_PULSED)) {
-            DrawText("  PULSED", panelX + 10, textY, 12, PURPLE);
+            Render_DrawText("  PULSED", panelX + 10, textY, 12, PURPLE);
             textY += lineHeight;
         }
         if (HasState(enemy->stateFlags, ENEMY_STATE_TELEPORTING)) {
-            DrawText("  TELEPORTING", panelX + 10, textY, 12, ORANGE);
+            Render_DrawText("  TELEPORTING", panelX + 10, textY, 12, ORANGE);
             textY += lineHeight;
         }
         if (HasState(enemy->stateFlags, ENEMY_STATE_STORM_ACTIVE)) {
-            DrawText("  STORM_ACTIVE", panelX + 10, textY, 12, DARKGREEN);
+            Render_DrawText("  STORM_ACTIVE", panelX + 10, textY, 12, DARKGREEN);
             textY += lineHeight;
         }
     }
 
     // State data (only show relevant fields)
-    DrawText("State Data:", panelX + 10, textY, 14, YELLOW);
+    Render_DrawText("State Data:", panelX + 10, textY, 14, YELLOW);
     textY += lineHeight;
 
     sprintf(buffer, "  Phase: %d", enemy->stateData.phase);
-    DrawText(buffer, panelX + 10, textY, 12, LIGHTGRAY);
+    Render_DrawText(buffer, panelX + 10, textY, 12, LIGHTGRAY);
     textY += lineHeight;
 
     if (enemy->stateData.shieldHealth > 0) {
         sprintf(buffer, "  Shield HP: %.1f", enemy->stateData.shieldHealth);
-        DrawText(buffer, panelX + 10, textY, 12, SKYBLUE);
+        Render_DrawText(buffer, panelX + 10, textY, 12, SKYBLUE);
         textY += lineHeight;
     }
 
     if (enemy->stateData.splitCount > 0) {
         sprintf(buffer, "  Splits Left: %d", enemy->stateData.splitCount);
-        DrawText(buffer, panelX + 10, textY, 12, ORANGE);
+        Render_DrawText(buffer, panelX + 10, textY, 12, ORANGE);
         textY += lineHeight;
     }
 
     // Draw indicator line from cursor to enemy
-    DrawLineEx(mousePos, enemy->position, 2.0f, Fade(SKYBLUE, 0.5f));
-    DrawCircleV(enemy->position, enemy->radius + 5, Fade(SKYBLUE, 0.3f));
+    Render_DrawLineEx(mousePos, enemy->position, 2.0f, Fade(SKYBLUE, 0.5f));
+    Render_DrawCircleV(enemy->position, enemy->radius + 5, Fade(SKYBLUE, 0.3f));
+}
+
+/**
+ * Draw per-phase frame time breakdown (averaged over the last second)
+ */
+void DrawProfilerOverlay(int screenWidth, int screenHeight) {
+    int lineHeight = 16;
+    int panelWidth = 280;
+    int panelHeight = 40 + (PROFILE_ZONE_COUNT + 1) * lineHeight;
+    int panelX = screenWidth - panelWidth - 10;
+    int panelY = screenHeight - panelHeight - 10;
+
+    Render_DrawRectangle(panelX, panelY, panelWidth, panelHeight, Fade(BLACK, 0.8f));
+    Render_DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, ORANGE);
+
+#if PROFILER_ENABLED
+    char buffer[64];
+    float frameMs = Profiler_GetAverageMs(PROFILE_ZONE_COUNT, PROFILER_OVERLAY_FRAMES);
+    sprintf(buffer, "FRAME %.2f ms (avg %d frames)", frameMs, PROFILER_OVERLAY_FRAMES);
+    Render_DrawText(buffer, panelX + 10, panelY + 10, 14, ORANGE);
+
+    int textY = panelY + 32;
+    int barX = panelX + 190;
+    int barMaxWidth = panelWidth - 200;
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        float ms = Profiler_GetAverageMs((ProfileZone)z, PROFILER_OVERLAY_FRAMES);
+        // 중력은 파티클 구간, 래스터는 그리기 구간 안에 포함된 시간, 래스터 작업은 워커 CPU 합 (흐린 색으로 구분)
+        bool nested = (z == PROFILE_ZONE_GRAVITY || z == PROFILE_ZONE_PARTICLE_RASTER ||
+                       z == PROFILE_ZONE_PARTICLE_RASTER_WORK);
+        sprintf(buffer, "%-11s %6.2f ms", Profiler_GetZoneName((ProfileZone)z), ms);
+        Render_DrawText(buffer, panelX + 10, textY, 12, nested ? LIGHTGRAY : WHITE);
+
+        int barWidth = (frameMs > 0.0f) ? (int)(barMaxWidth * fminf(ms / frameMs, 1.0f)) : 0;
+        Render_DrawRectangle(barX, textY + 2, barWidth, lineHeight - 6, nested ? GRAY : ORANGE);
+        textY += lineHeight;
+    }
+    Render_DrawText("F3: save profile_trace.json", panelX + 10, textY + 2, 12, GRAY);
+#else
+    Render_DrawText("PROFILER DISABLED", panelX + 10, panelY + 10, 14, ORANGE);
+    Render_DrawText("(built with PROFILER_ENABLED=0)", panelX + 10, panelY + 30, 12, GRAY);
+#endif
 }
 
 /**
@@ -345,54 +398,60 @@ void DrawTestModeUI(TestModeState* state, int screenWidth, int screenHeight) {
         DrawGravityFields(true);  // Show labels
     }
 
+    // Draw frame time breakdown (bottom-right)
+    if (state->showProfiler) {
+        DrawProfilerOverlay(screenWidth, screenHeight);
+    }
+
     // Draw enemy selector panel (top-left)
     int panelX = 10;
     int panelY = 100;
     int panelWidth = 250;
     int panelHeight = 80;
 
-    DrawRectangle(panelX, panelY, panelWidth, panelHeight, Fade(BLACK, 0.7f));
-    DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, YELLOW);
+    Render_DrawRectangle(panelX, panelY, panelWidth, panelHeight, Fade(BLACK, 0.7f));
+    Render_DrawRectangleLines(panelX, panelY, panelWidth, panelHeight, YELLOW);
 
     // Selected enemy type
-    DrawText("SELECTED ENEMY:", panelX + 10, panelY + 10, 16, WHITE);
+    Render_DrawText("SELECTED ENEMY:", panelX + 10, panelY + 10, 16, WHITE);
     const char* typeName = GetEnemyTypeName(state->selectedEnemyType);
-    DrawText(typeName, panelX + 10, panelY + 30, 20, YELLOW);
+    Render_DrawText(typeName, panelX + 10, panelY + 30, 20, YELLOW);
 
     // Stats
     char statsText[128];
     sprintf(statsText, "Spawned: %d  Removed: %d", state->enemiesSpawned, state->enemiesRemoved);
-    DrawText(statsText, panelX + 10, panelY + 55, 14, LIGHTGRAY);
+    Render_DrawText(statsText, panelX + 10, panelY + 55, 14, LIGHTGRAY);
 
     // Draw help overlay if enabled
     if (state->showHelp) {
         int helpX = screenWidth - 360;
         int helpY = 10;
         int helpWidth = 350;
-        int helpHeight = 350;
-
-        DrawRectangle(helpX, helpY, helpWidth, helpHeight, Fade(BLACK, 0.8f));
-        DrawRectangleLines(helpX, helpY, helpWidth, helpHeight, GREEN);
-
-        DrawText("TEST MODE CONTROLS", helpX + 10, helpY + 10, 16, GREEN);
-        DrawText("F1: Toggle Help", helpX + 10, helpY + 35, 14, WHITE);
-        DrawText("G: Toggle Gravity Fields", helpX + 10, helpY + 55, 14, PURPLE);
-        DrawText("TAB: Next Enemy Type", helpX + 10, helpY + 75, 14, YELLOW);
-        DrawText("Shift+TAB: Previous Enemy", helpX + 10, helpY + 95, 14, YELLOW);
-        DrawText("1-9,0: Quick Select (1st-10th)", helpX + 10, helpY + 115, 14, WHITE);
-        DrawText("Left Click: Spawn Enemy", helpX + 10, helpY + 135, 14, WHITE);
-        DrawText("R: Remove Nearest Enemy", helpX + 10, helpY + 155, 14, WHITE);
-        DrawText("C: Clear All Enemies", helpX + 10, helpY + 175, 14, WHITE);
-        DrawText("ESC: Exit Test Mode", helpX + 10, helpY + 195, 14, WHITE);
-        DrawText("", helpX + 10, helpY + 215, 14, WHITE);
-        DrawText("STATE TOGGLE (hover near enemy):", helpX + 10, helpY + 220, 14, SKYBLUE);
-        DrawText("I: Toggle Invulnerability", helpX + 10, helpY + 240, 14, RED);
-        DrawText("S: Toggle Shield", helpX + 10, helpY + 260, 14, SKYBLUE);
-        DrawText("P: Toggle Pulsed (BLACKHOLE)", helpX + 10, helpY + 280, 14, PURPLE);
-        DrawText("", helpX + 10, helpY + 300, 14, WHITE);
-        DrawText("QUICK SELECT:", helpX + 10, helpY + 310, 14, YELLOW);
-        DrawText("1=BASIC  2=TRACKER  3=SPEEDY", helpX + 10, helpY + 330, 12, LIGHTGRAY);
-        DrawText("4=SPLIT  5=ORBIT   6=BOSS", helpX + 10, helpY + 345, 12, LIGHTGRAY);
-        DrawText("7=TELE   8=REPULSE 9=CLUSTER", helpX + 10, helpY + 360, 12, LIGHTGRAY);
+        int helpHeight = 400;
+
+        Render_DrawRectangle(helpX, helpY, helpWidth, helpHeight, Fade(BLACK, 0.8f));
+        Render_DrawRectangleLines(helpX, helpY, helpWidth, helpHeight, GREEN);
+
+        Render_DrawText("TEST MODE CONTROLS", helpX + 10, helpY + 10, 16, GREEN);
+        Render_DrawText("F1: Toggle Help", helpX + 10, helpY + 35, 14, WHITE);
+        Render_DrawText("G: Toggle Gravity Fields", helpX + 10, helpY + 55, 14, PURPLE);
+        Render_DrawText("TAB: Next Enemy Type", helpX + 10, helpY + 75, 14, YELLOW);
+        Render_DrawText("Shift+TAB: Previous Enemy", helpX + 10, helpY + 95, 14, YELLOW);
+        Render_DrawText("1-9,0: Quick Select (1st-10th)", helpX + 10, helpY + 115, 14, WHITE);
+        Render_DrawText("Left Click: Spawn Enemy", helpX + 10, helpY + 135, 14, WHITE);
+        Render_DrawText("R: Remove Nearest Enemy", helpX + 10, helpY + 155, 14, WHITE);
+        Render_DrawText("C: Clear All Enemies", helpX + 10, helpY + 175, 14, WHITE);
+        Render_DrawText("ESC: Exit Test Mode", helpX + 10, helpY + 195, 14, WHITE);
+        Render_DrawText("", helpX + 10, helpY + 215, 14, WHITE);
+        Render_DrawText("STATE TOGGLE (hover near enemy):", helpX + 10, helpY + 220, 14, SKYBLUE);
+        Render_DrawText("I: Toggle Invulnerability", helpX + 10, helpY + 240, 14, RED);
+        Render_DrawText("S: Toggle Shield", helpX + 10, helpY + 260, 14, SKYBLUE);
+        Render_DrawText("P: Toggle Pulsed (BLACKHOLE)", helpX + 10, helpY + 280, 14, PURPLE);
+        Render_DrawText("", helpX + 10, helpY + 300, 14, WHITE);
+        Render_DrawText("QUICK SELECT:", helpX + 10, helpY + 310, 14, YELLOW);
+        Render_DrawText("1=BASIC  2=TRACKER  3=SPEEDY", helpX + 10, helpY + 330, 12, LIGHTGRAY);
+        Render_DrawText("4=SPLIT  5=ORBIT   6=BOSS", helpX + 10, helpY + 345, 12, LIGHTGRAY);
+        Render_DrawText("7=TELE   8=REPULSE 9=CLUSTER", helpX + 10, helpY + 360, 12, LIGHTGRAY);
+        Render_DrawText("F2: Profiler Overlay  F3: Save Trace", helpX + 10, helpY + 380, 14, ORANGE);
     }
 }
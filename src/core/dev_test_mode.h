@@ -11,6 +11,7 @@ typedef struct {
     EnemyType selectedEnemyType;  // Currently selected enemy type for spawning
     bool showHelp;                // Whether to show help overlay
     bool showGravityFields;       // Whether to visualize gravity fields
+    bool showProfiler;            // Whether to show the per-phase frame time overlay
     int enemiesSpawned;           // Total enemies spawned this session
     int enemiesRemoved;           // Total enemies removed this session
 } TestModeState;
@@ -65,6 +66,13 @@ bool RemoveNearestEnemy(void* game, Vector2 mousePos);
  */
 const char* GetEnemyTypeName(EnemyType type);
 
+/**
+ * @brief Draw per-phase frame time breakdown from the profiler
+ * @param screenWidth Screen width
+ * @param screenHeight Screen height
+ */
+void DrawProfilerOverlay(int screenWidth, int screenHeight);
+
 /**
  * @brief Draw enemy state debug information
  * @param game Game instance
@@ -1,5 +1,5 @@
 #include "event_system.h"
-#include "../memory_pool.h"
+#include "../thread_pool.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -7,8 +7,8 @@
 
 #define MAX_LISTENERS_PER_EVENT 16
 #define MAX_EVENT_QUEUE_SIZE 1024
-#define EVENT_DATA_POOL_BLOCK_SIZE 64
-#define EVENT_DATA_POOL_CAPACITY 1024
+#define EVENT_BATCH_ARENA_SIZE (256 * 1024)
+#define EVENT_STAGING_CAPACITY 256
 
 // 이벤트 리스너 구조체
 typedef struct {
@@ -30,51 +30,42 @@ static struct {
     EventListener listeners[EVENT_COUNT][MAX_LISTENERS_PER_EVENT];
     int listenerCount[EVENT_COUNT];
     EventQueue queue;
+    int droppedCount;       // Events lost to a full queue since the last ProcessEventQueue
     bool initialized;
 } eventSystem;
 
-// 이벤트 데이터를 위한 메모리 풀
-static MemoryPool g_eventDataPool;
-
-void InitEventMemoryPool(void) {
-    MemoryPool_Init(&g_eventDataPool, EVENT_DATA_POOL_BLOCK_SIZE, EVENT_DATA_POOL_CAPACITY);
-}
-
-void DestroyEventMemoryPool(void) {
-    MemoryPool_Destroy(&g_eventDataPool);
-}
+// 병렬 구간에서 발행된 이벤트를 워커별로 모아두는 버퍼 (각 워커만 자기 버퍼에 씀)
+typedef struct {
+    Event events[EVENT_STAGING_CAPACITY];
+    int count;
+    int droppedCount;
+} EventStaging;
 
-void* AllocEventData(size_t size) {
-    if (size > EVENT_DATA_POOL_BLOCK_SIZE) {
-        // 크기가 너무 큰 경우 일반 malloc 사용
-        return malloc(size);
-    }
-    return MemoryPool_Alloc(&g_eventDataPool);
-}
+static EventStaging staging[THREAD_POOL_MAX_THREADS];
 
-void FreeEventData(void* ptr) {
-    // 메모리 풀 범위 내인지 확인
-    char* poolStart = (char*)g_eventDataPool.blocks;
-    char* poolEnd = poolStart + g_eventDataPool.blockSize * g_eventDataPool.capacity;
-    if ((char*)ptr >= poolStart && (char*)ptr < poolEnd) {
-        MemoryPool_Free(&g_eventDataPool, ptr);
-    } else {
-        free(ptr);
-    }
-}
+// 배치 이벤트 레코드 저장 공간 (ProcessEventQueue 가 큐를 비우면 초기화)
+static struct {
+    double storage[EVENT_BATCH_ARENA_SIZE / sizeof(double)];  // double 로 정렬 보장
+    size_t used;
+} batchArena;
 
 // 이벤트 시스템 초기화
 void InitEventSystem(void) {
     memset(&eventSystem, 0, sizeof(eventSystem));
     eventSystem.initialized = true;
-    InitEventMemoryPool();
+    batchArena.used = 0;
+    for (int w = 0; w < THREAD_POOL_MAX_THREADS; w++) {
+        staging[w].count = 0;
+        staging[w].droppedCount = 0;
+    }
+    ThreadPool_SetJoinHook(FlushStagedEvents);
     printf("Event system initialized\n");
 }
 
 // 이벤트 시스템 정리
 void CleanupEventSystem(void) {
+    ThreadPool_SetJoinHook(NULL);
     memset(&eventSystem, 0, sizeof(eventSystem));
-    DestroyEventMemoryPool();
     printf("Event system cleaned up\n");
 }
 
@@ -86,7 +77,8 @@ static bool EnqueueEvent(const Event* event) {
     }
     
     if (eventSystem.queue.count >= MAX_EVENT_QUEUE_SIZE) {
-        printf("Warning: Event queue overflow\n");
+        // 경고는 ProcessEventQueue 에서 프레임당 한 번만 출력
+        eventSystem.droppedCount++;
         return false;
     }
     
@@ -110,8 +102,31 @@ static bool DequeueEvent(Event* event) {
     return true;
 }
 
+// 호출 스레드의 워커 버퍼에 이벤트 추가 (락 없음: 버퍼마다 쓰는 스레드가 하나)
+static void StageEvent(int worker, const Event* event) {
+    EventStaging* buffer = &staging[worker];
+    if (buffer->count >= EVENT_STAGING_CAPACITY) {
+        buffer->droppedCount++;
+        return;
+    }
+    buffer->events[buffer->count++] = *event;
+}
+
+void FlushStagedEvents(void) {
+    // 워커 순서 = 파티클/적 범위 순서이므로 단일 스레드 실행과 같은 순서로 합쳐짐
+    for (int w = 0; w < THREAD_POOL_MAX_THREADS; w++) {
+        EventStaging* buffer = &staging[w];
+        for (int i = 0; i < buffer->count; i++) {
+            EnqueueEvent(&buffer->events[i]);
+        }
+        eventSystem.droppedCount += buffer->droppedCount;
+        buffer->count = 0;
+        buffer->droppedCount = 0;
+    }
+}
+
 // 이벤트 발행
-void PublishEvent(EventType type, void* data) {
+void PublishEvent(EventType type, const void* data, size_t size) {
     if (!eventSystem.initialized) {
         printf("Warning: Event system not initialized\n");
         return;
@@ -122,12 +137,47 @@ void PublishEvent(EventType type, void* data) {
         return;
     }
     
+    if (size > sizeof(EventPayload)) {
+        printf("Warning: Event data too large for type %d (%zu bytes)\n", type, size);
+        return;
+    }
+    
     Event event;
     event.type = type;
-    event.data = data;
+    event.data = NULL;
     event.timestamp = GetTime();
+    if (data && size > 0) {
+        memcpy(&event.payload, data, size);
+        event.data = &event.payload;  // 큐에 복사되면 디스패치 직전에 다시 연결
+    }
+    
+    int worker = ThreadPool_GetCurrentWorker();
+    if (worker >= 0) {
+        StageEvent(worker, &event);
+    } else {
+        EnqueueEvent(&event);
+    }
+}
+
+void PublishEventBatch(EventType type, const void* items, size_t itemSize, int count) {
+    if (!items || itemSize == 0 || count <= 0) {
+        return;
+    }
+    
+    size_t bytes = itemSize * (size_t)count;
+    size_t aligned = (bytes + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+    // 워커 스레드도 호출할 수 있으므로 공간 예약은 원자적 덧셈으로
+    size_t offset = __atomic_fetch_add(&batchArena.used, aligned, __ATOMIC_RELAXED);
+    if (offset + aligned > sizeof(batchArena.storage)) {
+        printf("Warning: Event batch arena full, dropping batch of type %d\n", type);
+        return;
+    }
     
-    EnqueueEvent(&event);
+    char* copy = (char*)batchArena.storage + offset;
+    memcpy(copy, items, bytes);
+    
+    EventBatchData batch = { copy, count };
+    PublishEvent(type, &batch, sizeof(batch));
 }
 
 // 이벤트 즉시 처리
@@ -147,10 +197,22 @@ void ProcessEventQueue(void) {
         return;
     }
     
+    // 병렬 구간 밖에서 남은 워커 이벤트가 있으면 먼저 합침
+    FlushStagedEvents();
+    
     Event event;
     while (DequeueEvent(&event)) {
+        if (event.data) {
+            event.data = &event.payload;
+        }
         DispatchEvent(&event);
     }
+    
+    batchArena.used = 0;
+    if (eventSystem.droppedCount > 0) {
+        printf("Warning: Event queue overflow, %d events dropped\n", eventSystem.droppedCount);
+        eventSystem.droppedCount = 0;
+    }
 }
 
 // 이벤트 구독
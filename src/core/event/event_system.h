@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include "raylib.h"
+#include "event_types.h"
 
 // 이벤트 타입 정의 (점진적으로 확장 가능)
 typedef enum {
@@ -21,6 +22,8 @@ typedef enum {
     EVENT_ENEMY_HEALTH_CHANGED,
     EVENT_ENEMY_STATE_CHANGED,
     EVENT_ENEMY_SPLIT,           // New: Enemy splitting
+    EVENT_ENEMY_DAMAGE_BATCH,    // All enemy damage of one frame (EnemyDamageRecord[])
+    EVENT_ENEMY_STATE_BATCH,     // All enemy state changes of one frame (EnemyStateEventData[])
     
     // 충돌 이벤트
     EVENT_COLLISION_PARTICLE_ENEMY,
@@ -62,11 +65,31 @@ typedef enum {
     EVENT_COUNT  // 이벤트 총 개수
 } EventType;
 
+// Inline payload large enough for every *EventData type in event_types.h
+typedef union {
+    KeyEventData key;
+    EnemyEventData enemy;
+    EnemyHealthEventData enemyHealth;
+    EnemyStateEventData enemyState;
+    CollisionEventData collision;
+    GameStateEventData gameState;
+    StageChangeEventData stageChange;
+    StageWaveEventData stageWave;
+    SpecialAbilityEventData specialAbility;
+    BossPhaseEventData bossPhase;
+    ParticleEffectEventData particleEffect;
+    ScoreChangeEventData scoreChange;
+    ItemEventData item;
+    HealthRestoredEventData healthRestored;
+    EventBatchData batch;
+} EventPayload;
+
 // 이벤트 데이터 구조체
 typedef struct {
     EventType type;    // 이벤트 유형
-    void* data;        // 이벤트 관련 데이터
+    void* data;        // 디스패치 중 payload 를 가리킴 (데이터 없는 이벤트는 NULL)
     double timestamp;  // 이벤트 발생 시간
+    EventPayload payload;  // 발행 시 복사된 이벤트 데이터 (별도 할당 없음)
 } Event;
 
 // 이벤트 핸들러 함수 포인터 타입
@@ -78,8 +101,29 @@ void InitEventSystem(void);
 // 이벤트 시스템 정리
 void CleanupEventSystem(void);
 
-// 이벤트 발행
-void PublishEvent(EventType type, void* data);
+/**
+ * @brief Publish an event (data's size bytes are copied, so stack data is fine)
+ *
+ * Safe to call from ThreadPool workers: inside ParallelFor each thread appends
+ * to its own staging buffer without locking, and the buffers are merged into
+ * the queue in worker order when the ParallelFor returns. Since workers own
+ * consecutive ranges, the queue order matches a single-threaded run.
+ * Subscribing and ProcessEventQueue stay main-thread only.
+ */
+void PublishEvent(EventType type, const void* data, size_t size);
+
+// 워커 버퍼의 이벤트를 큐로 합침 (ParallelFor 종료 시 자동 호출)
+void FlushStagedEvents(void);
+
+/**
+ * @brief Publish one event that carries an array of records
+ *
+ * The records are copied into a frame arena owned by the event system, so a
+ * subscriber receives the whole batch in a single dispatch (event->data is an
+ * EventBatchData). The arena is reset once ProcessEventQueue has drained the
+ * queue. Empty batches are not published.
+ */
+void PublishEventBatch(EventType type, const void* items, size_t itemSize, int count);
 
 // 이벤트 구독
 int SubscribeToEvent(EventType type, EventHandler handler, void* context);
@@ -90,10 +134,4 @@ void UnsubscribeFromEvent(EventType type, int listenerId);
 // 이벤트 큐 처리 (게임 루프에서 호출)
 void ProcessEventQueue(void);
 
-// 메모리 풀 기반 이벤트 데이터 관리 함수
-void InitEventMemoryPool(void);
-void DestroyEventMemoryPool(void);
-void* AllocEventData(size_t size);
-void FreeEventData(void* ptr);
-
 #endif // EVENT_SYSTEM_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define EVENT_TYPES_H
 
 #include "raylib.h"
+#include "../../entities/enemy_handle.h"
 
 // 키보드 입력 이벤트 데이터
 typedef struct {
@@ -9,26 +10,23 @@ typedef struct {
     bool isPressed;   // 눌림 여부 (true: 눌림, false: 뗌)
 } KeyEventData;
 
-// 적 이벤트 데이터
+// 적 이벤트 데이터 (적 참조는 핸들: 이벤트 처리 시점에 EnemyStore_Get 으로 확인)
 typedef struct {
-    int enemyIndex;
-    void* enemyPtr;
+    EnemyHandle enemy;
 } EnemyEventData;
 
 // 적 체력 변화 이벤트 데이터
 typedef struct {
-    int enemyIndex;
+    EnemyHandle enemy;
     float oldHealth;
     float newHealth;
-    void* enemyPtr;
 } EnemyHealthEventData;
 
 // 적 상태 변화 이벤트 데이터
 typedef struct {
-    int enemyIndex;
+    EnemyHandle enemy;
     int oldState;
     int newState;
-    void* enemyPtr;
 } EnemyStateEventData;
 
 // 충돌 이벤트 데이터
@@ -40,6 +38,7 @@ typedef struct {
     int entityAType; // 0: 파티클, 1: 적, 2: 플레이어
     int entityBType;
     float impact; // 충돌 강도(필요시)
+    EnemyHandle enemy; // 적이 관련된 충돌이면 그 적 (포인터는 제거 후 무효)
 } CollisionEventData;
 
 // 게임 상태 변경 이벤트 데이터
@@ -65,16 +64,14 @@ typedef struct {
 
 // 특수 능력 이벤트 데이터
 typedef struct {
-    int enemyIndex;
-    void* enemyPtr;
+    EnemyHandle enemy;
     int abilityType;  // 0: teleport, 1: split, 2: repulse, etc.
     Vector2 position;
 } SpecialAbilityEventData;
 
 // 보스 페이즈 변경 이벤트 데이터
 typedef struct {
-    int enemyIndex;
-    void* enemyPtr;
+    EnemyHandle enemy;
     int oldPhase;
     int newPhase;
     float healthPercentage;
@@ -96,6 +93,22 @@ typedef struct {
     int enemyType;
 } ScoreChangeEventData;
 
+// 프레임 단위 배치 이벤트 데이터 (items 는 이벤트 시스템이 보관, 디스패치 중에만 유효)
+typedef struct {
+    const void* items;
+    int count;
+} EventBatchData;
+
+// 적 한 마리의 프레임 내 피해 합계 (EVENT_ENEMY_DAMAGE_BATCH 의 원소)
+typedef struct {
+    EnemyHandle enemy;  // 제거된 적의 핸들은 무효 (destroyed 참고)
+    int hits;           // 파티클 접촉 수
+    float damage;       // DamageEnemy 에 넘긴 피해 합계 (접촉 피해는 보호막/보스/무적 배율 적용 후, 보호막 흡수 전)
+    float oldHealth;    // 프레임 첫 피해 직전 체력
+    float newHealth;    // 마지막 피해 직후 체력
+    bool destroyed;
+} EnemyDamageRecord;
+
 // 향후 다른 이벤트 데이터 구조체는 여기에 추가
 
 // Item event data
@@ -0,0 +1,44 @@
+#include "fixed_step.h"
+#include <string.h>
+
+void FixedStep_Init(FixedStep* clock, int rate) {
+    memset(clock, 0, sizeof(FixedStep));
+    if (rate < SIM_MIN_RATE || rate > SIM_MAX_RATE) rate = SIM_DEFAULT_RATE;
+    clock->rate = rate;
+    clock->stepSeconds = 1.0f / (float)rate;
+    clock->alpha = 1.0f;
+}
+
+void FixedStep_Reset(FixedStep* clock) {
+    clock->accumulator = 0.0f;
+    clock->alpha = 1.0f;
+    clock->hasPrevious = false;
+}
+
+int FixedStep_Advance(FixedStep* clock, float frameSeconds) {
+    if (frameSeconds > 0.0f) clock->accumulator += frameSeconds;
+
+    int steps = 0;
+    while (clock->accumulator >= clock->stepSeconds && steps < SIM_MAX_STEPS_PER_FRAME) {
+        clock->accumulator -= clock->stepSeconds;
+        steps++;
+    }
+
+    // 너무 느린 프레임: 따라잡지 못한 만큼 버리고 한 스텝 미만만 남김
+    if (clock->accumulator >= clock->stepSeconds) {
+        uint64_t dropped = (uint64_t)(clock->accumulator / clock->stepSeconds);
+        clock->accumulator -= (float)dropped * clock->stepSeconds;
+        if (clock->accumulator >= clock->stepSeconds) {
+            clock->accumulator -= clock->stepSeconds;
+            dropped++;
+        }
+        if (clock->accumulator < 0.0f) clock->accumulator = 0.0f;
+        clock->droppedSteps += dropped;
+    }
+
+    clock->steps += steps;
+    if (steps > 0) clock->hasPrevious = true;
+    // 이전 상태가 없으면 현재 상태를 그대로 그림
+    clock->alpha = clock->hasPrevious ? clock->accumulator / clock->stepSeconds : 1.0f;
+    return steps;
+}
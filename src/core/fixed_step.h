@@ -0,0 +1,54 @@
+#ifndef FIXED_STEP_H
+#define FIXED_STEP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIM_REFERENCE_RATE 60       // Rate the per-step constants (velocities, friction, forces) were tuned at
+#define SIM_DEFAULT_RATE 60         // Simulation rate when --sim-hz is not given
+#define SIM_MIN_RATE 10             // Smallest accepted --sim-hz value
+#define SIM_MAX_RATE 240            // Largest accepted --sim-hz value
+#define SIM_MAX_STEPS_PER_FRAME 8   // Backlog beyond this many steps is dropped (no spiral of death)
+
+/**
+ * @brief Accumulator for a fixed simulation rate decoupled from the frame rate
+ *
+ * Every frame adds its real delta; the simulation then runs as many fixed
+ * steps as fit. The remainder carries over, and `alpha` tells the renderer
+ * how far it is between the state before the last step (0) and after it (1).
+ * Driven only by frame deltas, so recorded deltas replay the same steps.
+ */
+typedef struct FixedStep {
+    int rate;                   // Simulation steps per second
+    float stepSeconds;          // 1 / rate
+    float accumulator;          // Unsimulated time carried to the next frame
+    float alpha;                // Render blend from the previous to the current state
+    bool hasPrevious;           // A previous state was captured since the last reset
+    uint64_t steps;             // Steps run so far
+    uint64_t droppedSteps;      // Steps skipped because a frame exceeded SIM_MAX_STEPS_PER_FRAME
+} FixedStep;
+
+// 시뮬레이션 속도 설정 (범위 밖이면 SIM_DEFAULT_RATE)
+void FixedStep_Init(FixedStep* clock, int rate);
+// 누적 시간과 이전 상태 폐기 (시뮬레이션이 멈추는 상태 전환 후)
+void FixedStep_Reset(FixedStep* clock);
+/**
+ * @brief Add a frame's real time and return the number of steps to run now
+ *
+ * Also updates alpha for the frame. The caller should capture the previous
+ * render state right before the last of the returned steps.
+ */
+int FixedStep_Advance(FixedStep* clock, float frameSeconds);
+
+/**
+ * @brief Step length relative to the reference rate (exactly 1 at 60 Hz)
+ *
+ * Multiply per-step constants by this so behavior does not change with the
+ * simulation rate. Dividing by the reference step (rather than multiplying
+ * by the rate) keeps the 60 Hz result bit-identical to the unscaled code.
+ */
+static inline float FixedStep_Scale(float stepSeconds) {
+    return stepSeconds / (1.0f / SIM_REFERENCE_RATE);
+}
+
+#endif // FIXED_STEP_H
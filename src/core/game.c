@@ -9,9 +9,12 @@
 #include "raymath.h"
 #include "event/event_system.h"
 #include "event/event_types.h"
-#include "memory_pool.h"
 #include "gravity_system.h"
+#include "rng.h"
+#include "profiler.h"
+#include "replay.h"
 #include "../entities/managers/stage_manager.h"
+#include "../render/render.h"
 
 #define SCOREBOARD_FILENAME "scoreboard.txt"
 
@@ -19,54 +22,29 @@
 int g_screenWidth = 800;
 int g_screenHeight = 800;
 
-// 외부 메모리 풀 참조 선언
-extern MemoryPool g_collisionEventPool;
-extern MemoryPool g_enemyEventPool;
-extern MemoryPool g_enemyHealthEventPool;
-extern MemoryPool g_gameStateEventPool;
-extern MemoryPool g_enemyStateEventPool;
-
-// 추가 메모리 풀 정의
-static MemoryPool g_stageChangeEventPool;
-static MemoryPool g_specialAbilityEventPool;
-static MemoryPool g_particleEffectEventPool;
-static bool g_additionalPoolsInitialized = false;
 
 // Initialize game state and resources
-Game InitGame(int screenWidth, int screenHeight) {
+Game InitGame(int screenWidth, int screenHeight, int particleCount, int enemyCapacity) {
     // Set global screen dimensions
     g_screenWidth = screenWidth;
     g_screenHeight = screenHeight;
     
-    // 랜덤 시드 초기화
-    SetRandomSeed(time(NULL));
+    // 랜덤 시드 초기화 (raylib 생성기도 Rng 시드를 따라 --seed 로 재현 가능)
+    SetRandomSeed((unsigned int)Rng_GetSeed());
     
     // 이벤트 시스템 초기화
     InitEventSystem();
     
-    // 물리 시스템 메모리 풀 초기화
-    InitPhysicsMemoryPools();
-
     // 중력 시스템 초기화
     InitGravitySystem();
-
-    // 추가 메모리 풀 초기화 (한 번만)
-    if (!g_additionalPoolsInitialized) {
-        MemoryPool_Init(&g_stageChangeEventPool, sizeof(StageChangeEventData), 32);
-        MemoryPool_Init(&g_specialAbilityEventPool, sizeof(SpecialAbilityEventData), 32);
-        MemoryPool_Init(&g_particleEffectEventPool, sizeof(ParticleEffectEventData), 32);
-        g_additionalPoolsInitialized = true;
-    }
     
     Game game = {
         .screenWidth = screenWidth,
         .screenHeight = screenHeight,
         .moveSpeed = 2,
         .player = InitPlayer(screenWidth, screenHeight),
-        .particles = NULL,  // 초기화는 아래에서
         .deltaTime = 0,
-        .lastEnemySpawnTime = GetTime(),
-        .enemyCount = 0,
+        .lastEnemySpawnTime = Replay_GetTime(),
         .explosionParticleCount = 0,
         .score = 0,
         .gameState = GAME_STATE_TUTORIAL,
@@ -81,16 +59,49 @@ Game InitGame(int screenWidth, int screenHeight) {
         .enemiesKilledThisStage = 0
     };
 
-    // 파티클 배열 동적 할당
-    game.particles = (Particle*)malloc(PARTICLE_COUNT * sizeof(Particle));
-    
-    // 모든 파티클 초기화
-    for (int i = 0; i < PARTICLE_COUNT; i++) {
-        game.particles[i] = InitParticle(screenWidth, screenHeight);
+    // 파티클 버퍼 할당 (SoA, 게임 전체에서 한 번만) 및 초기화
+    if (!ParticleBuffer_Init(&game.particles, particleCount)) {
+        printf("Failed to allocate %d particles, falling back to %d\n", particleCount, DEFAULT_PARTICLE_COUNT);
+        ParticleBuffer_Init(&game.particles, DEFAULT_PARTICLE_COUNT);
     }
 
-    // 적(enemy) 배열 동적 할당
-    game.enemies = (Enemy*)malloc(MAX_ENEMIES * sizeof(Enemy));
+    // 정확 모드 중력 소스와 임펄스의 셀 컬링용 균일 그리드
+    if (!SpatialGrid_Init(&game.particleGrid, screenWidth, screenHeight, PARTICLE_GRID_CELL_SIZE, game.particles.count)) {
+        printf("Failed to allocate the particle grid for %d particles, falling back to %d\n",
+               game.particles.count, DEFAULT_PARTICLE_COUNT);
+        ParticleBuffer_Destroy(&game.particles);
+        ParticleBuffer_Init(&game.particles, DEFAULT_PARTICLE_COUNT);
+        if (!SpatialGrid_Init(&game.particleGrid, screenWidth, screenHeight, PARTICLE_GRID_CELL_SIZE, game.particles.count)) {
+            printf("Failed to allocate the particle grid, gravity sources and impulses are disabled\n");
+        }
+    }
+    ParticleBuffer_Randomize(&game.particles, screenWidth, screenHeight);
+
+    // 중력장 (실패 시 정확 모드로 계산)
+    if (!GravityField_Init(&game.gravityField, screenWidth, screenHeight, GRAVITY_FIELD_CELL_SIZE)) {
+        printf("Failed to allocate the gravity field, using exact gravity\n");
+        SetGravityMode(GRAVITY_MODE_EXACT);
+    }
+    ParticlePipeline_Init(&game.particlePipeline, screenWidth, screenHeight);
+
+    // 렌더 보간용 이전 스텝 위치 (할당 실패 시 보간 없이 현재 위치만 그림)
+    game.particlePreviousX = (float*)malloc(game.particles.count * sizeof(float));
+    game.particlePreviousY = (float*)malloc(game.particles.count * sizeof(float));
+
+    // 파티클 래스터 (실패 시 파티클마다 DrawPixelV 로 그림)
+    if (!ParticleRaster_Init(&game.particleRaster, screenWidth, screenHeight)) {
+        printf("Failed to allocate the particle framebuffer, drawing particles one by one\n");
+    }
+
+    // 고정 시뮬레이션 속도 (main 에서 --sim-hz 로 다시 설정 가능)
+    FixedStep_Init(&game.clock, SIM_DEFAULT_RATE);
+    game.deltaTime = game.clock.stepSeconds;
+
+    // 적 저장소 할당 (용량은 실행 중 고정, 추가해도 Enemy 포인터가 유지됨)
+    if (!EnemyStore_Init(&game.enemies, enemyCapacity)) {
+        printf("Failed to allocate %d enemies, falling back to %d\n", enemyCapacity, DEFAULT_ENEMY_CAPACITY);
+        EnemyStore_Init(&game.enemies, DEFAULT_ENEMY_CAPACITY);
+    }
     
     // Initialize item manager
     InitItemManager();
@@ -107,10 +118,13 @@ int FindNearestParticleInDirection(Game* game, Vector2 direction) {
     float nearestDistance = INFINITY;
     float maxAngleDiff = PI / 4.0f;  // 45도 각도 내의 파티클만 고려
 
-    for (int i = 0; i < PARTICLE_COUNT; i++) {
+    const float* xs = game->particles.x;
+    const float* ys = game->particles.y;
+
+    for (int i = 0; i < game->particles.count; i++) {
         Vector2 toParticle = {
-            game->particles[i].position.x - game->player.position.x,
-            game->particles[i].position.y - game->player.position.y
+            xs[i] - game->player.position.x,
+            ys[i] - game->player.position.y
         };
 
         // 파티클까지의 거리 계산
@@ -140,23 +154,258 @@ int FindNearestParticleInDirection(Game* game, Vector2 direction) {
 
 // 플레이어와 파티클 교체
 void SwapPlayerWithParticle(Game* game, int particleIndex) {
-    if (particleIndex < 0 || particleIndex >= PARTICLE_COUNT) return;
+    if (particleIndex < 0 || particleIndex >= game->particles.count) return;
 
     // 현재 플레이어의 위치를 저장
     Vector2 playerPos = game->player.position;
     
     // 플레이어를 파티클 위치로 이동
-    game->player.position = game->particles[particleIndex].position;
+    game->player.position = ParticleBuffer_GetPosition(&game->particles, particleIndex);
     
     // 파티클을 이전 플레이어 위치로 이동
-    game->particles[particleIndex].position = playerPos;
+    ParticleBuffer_SetPosition(&game->particles, particleIndex, playerPos);
     
     // 파티클 속도 초기화
-    game->particles[particleIndex].velocity = (Vector2){0, 0};
+    ParticleBuffer_SetVelocity(&game->particles, particleIndex, (Vector2){0, 0});
 }
+// 렌더 보간용: 마지막 스텝 직전의 위치 저장
+static void CaptureRenderState(Game* game) {
+    if (game->particlePreviousX && game->particlePreviousY) {
+        memcpy(game->particlePreviousX, game->particles.x, game->particles.count * sizeof(float));
+        memcpy(game->particlePreviousY, game->particles.y, game->particles.count * sizeof(float));
+    }
+    for (int i = 0; i < game->enemies.count; i++) {
+        game->enemies.previousPosition[i] = game->enemies.items[i].position;
+    }
+    game->player.previousPosition = game->player.position;
+}
+
+/**
+ * @brief Run the fixed steps this frame's time covers
+ *
+ * deltaTime is the step length while the steps run. Events published by a
+ * step are handled before the next one, as they would be between frames. If
+ * a step changes the game state the remaining steps are dropped.
+ */
+static void RunFixedSteps(Game* game, float frameTime, void (*step)(Game* game)) {
+    GameState state = game->gameState;
+    int steps = FixedStep_Advance(&game->clock, frameTime);
+    game->deltaTime = game->clock.stepSeconds;
+
+    for (int s = 0; s < steps; s++) {
+        if (s > 0) {
+            PROFILE_BEGIN(PROFILE_ZONE_EVENTS);
+            ProcessEventQueue();
+            PROFILE_END(PROFILE_ZONE_EVENTS);
+        }
+        if (s == steps - 1) {
+            CaptureRenderState(game);
+        }
+        step(game);
+        if (game->gameState != state) {
+            FixedStep_Reset(&game->clock);
+            break;
+        }
+    }
+}
+
+// 테스트 모드 한 스텝
+static void StepTestMode(Game* game) {
+    // Update player
+    PROFILE_BEGIN(PROFILE_ZONE_PLAYER);
+    UpdatePlayer(&game->player, game->screenWidth, game->screenHeight, game->moveSpeed, game->deltaTime);
+    PROFILE_END(PROFILE_ZONE_PLAYER);
+
+    // Update enemies (before particles so contacts use this step's positions)
+    PROFILE_BEGIN(PROFILE_ZONE_ENEMY_AI);
+    UpdateAllEnemies(game);
+    PROFILE_END(PROFILE_ZONE_ENEMY_AI);
+
+    // Update particles: gravity, attraction, movement and contacts in one pass
+    PROFILE_BEGIN(PROFILE_ZONE_PARTICLES);
+    UpdateAllParticles(game, Replay_IsKeyDown(KEY_SPACE));
+    PROFILE_END(PROFILE_ZONE_PARTICLES);
+
+    // Handle collisions
+    PROFILE_BEGIN(PROFILE_ZONE_COLLISIONS);
+    ProcessEnemyCollisions(game);
+    PROFILE_END(PROFILE_ZONE_COLLISIONS);
+}
+
+// 게임 진행 한 스텝 (고정 시간 간격)
+static void StepPlaying(Game* game) {
+    // Update stage system
+    PROFILE_BEGIN(PROFILE_ZONE_STAGE);
+    UpdateStageSystem(game);
+    PROFILE_END(PROFILE_ZONE_STAGE);
+    
+    // 이벤트 시스템을 사용하지 않을 경우에만 직접 입력 처리
+    if (!game->useEventSystem) {
+        // 직접 입력 방식에서만 키 상태 직접 설정
+        bool isSpacePressed = Replay_IsKeyDown(KEY_SPACE);
+        bool isShiftPressed = Replay_IsKeyDown(KEY_LEFT_SHIFT);
+        game->player.isBoosting = isSpacePressed;
+        game->player.isSpeedBoosting = isShiftPressed;
+    }
+    
+    // 플레이어 업데이트 (방향키로 이동)
+    PROFILE_BEGIN(PROFILE_ZONE_PLAYER);
+    UpdatePlayer(&game->player, game->screenWidth, game->screenHeight, game->moveSpeed, game->deltaTime);
+    PROFILE_END(PROFILE_ZONE_PLAYER);
+    
+    // Update enemies with AI
+    PROFILE_BEGIN(PROFILE_ZONE_ENEMY_AI);
+    UpdateEnemiesByType(game);
+    for (int i = 0; i < game->enemies.count; i++) {
+        // BLACKHOLE special behavior
+        if (game->enemies.items[i].type == ENEMY_TYPE_BLACKHOLE) {
+            // Check if other enemies exist
+            int otherEnemiesCount = 0;
+            for (int j = 0; j < game->enemies.count; j++) {
+                if (j != i && game->enemies.items[j].health > 0) {
+                    otherEnemiesCount++;
+                }
+            }
+            
+            // Debug output
+            // static float lastDebugBlackhole = 0;
+            // if (game->stageTimer - lastDebugBlackhole > 1.0f) {
+            //     printf("BLACKHOLE: otherEnemies=%d, isInvuln=%d, hasPulsed=%d, stormTimer=%.1f\n", 
+            //            otherEnemiesCount, game->enemies.items[i].isInvulnerable, 
+            //            game->enemies.items[i].hasPulsed, game->enemies.items[i].stormCycleTimer);
+            //     lastDebugBlackhole = game->stageTimer;
+            // }
+            
+            // Update blackhole state based on other enemies
+            if (otherEnemiesCount == 0 &&
+                HasState(game->enemies.items[i].stateFlags, ENEMY_STATE_INVULNERABLE) &&
+                !HasState(game->enemies.items[i].stateFlags, ENEMY_STATE_PULSED)) {
+                // printf("BLACKHOLE TRANSFORMATION TRIGGERED!\n");
+                // All other enemies are dead, perform pulse and transform immediately
+                SetState(&game->enemies.items[i].stateFlags, ENEMY_STATE_PULSED);
+                ClearState(&game->enemies.items[i].stateFlags, ENEMY_STATE_INVULNERABLE);
+                game->enemies.items[i].movePattern = MOVE_PATTERN_TRACKING;
+                game->enemies.items[i].color = (Color){150, 0, 50, 255};  // Reddish color when active
+                game->enemies.items[i].aiState = AI_STATE_CHASE;
+                // Increase speed
+                game->enemies.items[i].velocity.x *= 3.0f;
+                game->enemies.items[i].velocity.y *= 3.0f;
+                
+                // Create a powerful radial pulse (inverted direction, applied in the gravity pass)
+                #define PULSE_RADIUS 400.0f
+                #define PULSE_FORCE 20.0f
+                ApplyRadialImpulse(game->enemies.items[i].position, PULSE_RADIUS, -PULSE_FORCE);
+            }
+            
+            // Apply semi-magnetic storm after transformation (cycles every 5 seconds)
+            if (HasState(game->enemies.items[i].stateFlags, ENEMY_STATE_PULSED) && game->enemies.items[i].type == ENEMY_TYPE_BLACKHOLE) {
+                // Update storm cycle timer
+                game->enemies.items[i].stateData.stormCycleTimer += game->deltaTime;
+                if (game->enemies.items[i].stateData.stormCycleTimer >= 6.0f) {
+                    game->enemies.items[i].stateData.stormCycleTimer = 0.0f;  // Reset every 6 seconds (5 on, 1 off)
+                }
+
+                // Check if storm is active (first 5 seconds of cycle)
+                bool stormActive = game->enemies.items[i].stateData.stormCycleTimer < 5.0f;
+
+                // Update color based on storm state
+                if (stormActive) {
+                    // Calculate storm strength for color interpolation
+                    float stormStrength = 1.0f - (game->enemies.items[i].stateData.stormCycleTimer / 5.0f);
+                    // Interpolate from bright red to dark red as storm weakens
+                    int redValue = 100 + (int)(100 * stormStrength);  // 200 to 100
+                    int greenValue = (int)(50 * (1.0f - stormStrength));  // 0 to 50
+                    game->enemies.items[i].color = (Color){redValue, greenValue, 50, 255};
+                } else {
+                    game->enemies.items[i].color = (Color){100, 150, 50, 255};  // Greenish when vulnerable
+                }
+                
+                // Apply magnetic storm only when active
+                if (stormActive) {
+                    #define SEMI_STORM_RADIUS 150.0f
+                    #define SEMI_STORM_FORCE 3.0f
+                    
+                    // Calculate storm strength that decreases over time (1.0 to 0.0 over 5 seconds)
+                    // float stormStrength = 1.0f - (game->enemies.items[i].stormCycleTimer / 5.0f);
+                    
+                    // Alternative: Use sine wave for smoother transition
+                    // float stormStrength = fmaxf(cosf((game->enemies.items[i].stormCycleTimer / 5.0f) * PI * 0.5f), 0.5f);
+                    float stormStrength = 1.0f;
+                    
+                    // 70% chance to repel each particle in range (applied in the gravity pass)
+                    QueueRadialImpulse((RadialImpulse){
+                        .center = game->enemies.items[i].position,
+                        .radius = SEMI_STORM_RADIUS,
+                        .minDistance = 1.0f,
+                        .strength = SEMI_STORM_FORCE * stormStrength,
+                        .probability = 0.7f
+                    });
+                }
+            }
+        }
+    }
+
+    // Legacy enemy spawn (only if not using stage system)
+    if (game->currentStageNumber == 0) {
+        SpawnEnemyIfNeeded(game);
+        UpdateAllEnemies(game);
+    }
+    PROFILE_END(PROFILE_ZONE_ENEMY_AI);
+    
+    // 모든 파티클 업데이트 (이벤트 처리된 isBoosting 값 사용)
+    // 중력, 펄스/폭풍, 인력, 이동, 적 접촉 기록을 한 번의 순회로 처리
+    PROFILE_BEGIN(PROFILE_ZONE_PARTICLES);
+    UpdateAllParticles(game, game->player.isBoosting);
+    PROFILE_END(PROFILE_ZONE_PARTICLES);
+
+    // Enemy-Particle 충돌 처리 (기록된 접촉) 및 이벤트 발행
+    PROFILE_BEGIN(PROFILE_ZONE_COLLISIONS);
+    ProcessEnemyCollisions(game);
+    PROFILE_END(PROFILE_ZONE_COLLISIONS);
+    
+    // Update items and check item collisions
+    PROFILE_BEGIN(PROFILE_ZONE_ITEMS);
+    UpdateItemManager(game->deltaTime, game->screenWidth, game->screenHeight);
+    CheckItemCollisions(&game->player);
+    PROFILE_END(PROFILE_ZONE_ITEMS);
+    
+    // 플레이어-적 충돌 체크
+    PROFILE_BEGIN(PROFILE_ZONE_COLLISIONS);
+    for (int i = 0; i < game->enemies.count; i++) {
+        float px = game->player.position.x + game->player.size/2;
+        float py = game->player.position.y + game->player.size/2;
+        // Ignore collision for first 0.5s after enemy spawn
+        if (Replay_GetTime() - game->enemies.items[i].spawnTime < 0.5f) continue;
+        if (CheckCollisionCircles((Vector2){px, py}, game->player.size/2, game->enemies.items[i].position, game->enemies.items[i].radius)) {
+            // 플레이어-적 충돌 이벤트 발행
+            CollisionEventData collisionData = {0};
+            collisionData.entityAIndex = 0; // 플레이어는 단일 엔티티이므로 인덱스는 0
+            collisionData.entityBIndex = i;
+            collisionData.entityAPtr = &game->player;
+            collisionData.enemy = game->enemies.handles[i];
+            collisionData.entityAType = 2; // 2: 플레이어
+            collisionData.entityBType = 1; // 1: 적
+            collisionData.impact = 1.0f; // 플레이어-적 충돌은 치명적
+            PublishEvent(EVENT_COLLISION_PLAYER_ENEMY, &collisionData, sizeof(collisionData));
+        }
+    }
+    PROFILE_END(PROFILE_ZONE_COLLISIONS);
+    
+    // 폭발 파티클 업데이트
+    PROFILE_BEGIN(PROFILE_ZONE_EXPLOSIONS);
+    UpdateAllExplosionParticles(game);
+    PROFILE_END(PROFILE_ZONE_EXPLOSIONS);
+}
+
 // game.c 파일에서 UpdateGame 함수 내 수정
 void UpdateGame(Game* game) {
-    game->deltaTime = GetFrameTime();
+    float frameTime = Replay_GetFrameTime();
+    game->deltaTime = frameTime;
+
+    // 시뮬레이션이 멈춘 상태: 누적 시간과 이전 상태를 버려 재개 시 튀지 않게 함
+    if (game->gameState != GAME_STATE_PLAYING && game->gameState != GAME_STATE_TEST_MODE) {
+        FixedStep_Reset(&game->clock);
+    }
     
     // 이벤트 시스템 사용 시 입력 이벤트 처리 - main.c에서 처리하므로 제거
     // if (game->useEventSystem) {
@@ -165,26 +414,14 @@ void UpdateGame(Game* game) {
 
     // Test mode update
     if (game->gameState == GAME_STATE_TEST_MODE) {
-        // Update test mode logic
+        // Update test mode logic (per frame: spawning and UI input)
         UpdateTestMode(&game->testModeState, game);
 
-        // Update player
-        UpdatePlayer(&game->player, game->screenWidth, game->screenHeight, game->moveSpeed, game->deltaTime);
-
-        // Update particles
-        UpdateAllParticles(game, IsKeyDown(KEY_SPACE));
-
-        // Update enemies
-        UpdateAllEnemies(game);
-
-        // Apply gravity from all registered sources to particles
-        ApplyAllGravitySources(game, game->deltaTime);
-
-        // Handle collisions
-        ProcessEnemyCollisions(game);
+        // Player, enemies, particles and collisions at the fixed rate
+        RunFixedSteps(game, frameTime, StepTestMode);
 
         // Exit test mode with ESC
-        if (IsKeyPressed(KEY_ESCAPE)) {
+        if (Replay_IsKeyPressed(KEY_ESCAPE)) {
             game->gameState = GAME_STATE_TUTORIAL;
         }
 
@@ -192,20 +429,18 @@ void UpdateGame(Game* game) {
     }
 
     if (game->gameState == GAME_STATE_TUTORIAL) {
-        if (IsKeyPressed(KEY_ENTER)) {
+        if (Replay_IsKeyPressed(KEY_ENTER)) {
             // 여기에 새로운 코드 추가: TUTORIAL → PLAYING 전환 시 게임 리소스 리셋
             game->player = InitPlayer(game->screenWidth, game->screenHeight);
             game->score = 0;
-            game->enemyCount = 0;
+            ClearEnemies(game);
             game->explosionParticleCount = 0;
-            game->lastEnemySpawnTime = GetTime();
+            game->lastEnemySpawnTime = Replay_GetTime();
             game->totalEnemiesKilled = 0;
             game->enemiesKilledThisStage = 0;
             
             // 파티클 재초기화
-            for (int i = 0; i < PARTICLE_COUNT; i++) {
-                game->particles[i] = InitParticle(game->screenWidth, game->screenHeight);
-            }
+            ParticleBuffer_Randomize(&game->particles, game->screenWidth, game->screenHeight);
             
             // Reset spawn timing for new game
             ResetSpawnTiming();
@@ -218,12 +453,10 @@ void UpdateGame(Game* game) {
             
             // 선택적: 상태 변경 이벤트 발행
             if (game->useEventSystem) {
-                GameStateEventData* stateData = MemoryPool_Alloc(&g_gameStateEventPool);
-                if (stateData) {
-                    stateData->oldState = GAME_STATE_TUTORIAL;
-                    stateData->newState = GAME_STATE_STAGE_INTRO;
-                    PublishEvent(EVENT_GAME_STATE_CHANGED, stateData);
-                }
+                GameStateEventData stateData = {0};
+                stateData.oldState = GAME_STATE_TUTORIAL;
+                stateData.newState = GAME_STATE_STAGE_INTRO;
+                PublishEvent(EVENT_GAME_STATE_CHANGED, &stateData, sizeof(stateData));
             }
         }
         return;
@@ -258,14 +491,14 @@ void UpdateGame(Game* game) {
     }
     
     if (game->gameState == GAME_STATE_STAGE_COMPLETE) {
-        if (IsKeyPressed(KEY_ENTER)) {
+        if (Replay_IsKeyPressed(KEY_ENTER)) {
             TransitionToNextStage(game);
         }
         return;
     }
     
     if (game->gameState == GAME_STATE_VICTORY) {
-        if (IsKeyPressed(KEY_ENTER)) {
+        if (Replay_IsKeyPressed(KEY_ENTER)) {
             game->gameState = GAME_STATE_SCORE_ENTRY;
         }
         return;
@@ -273,18 +506,16 @@ void UpdateGame(Game* game) {
     
     if (game->gameState == GAME_STATE_OVER) {
         // Enter name state on any key
-        if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
+        if (Replay_IsKeyPressed(KEY_ENTER) || Replay_IsKeyPressed(KEY_SPACE)) {
             game->gameState = GAME_STATE_SCORE_ENTRY;
             game->playerName[0] = '\0';
             game->nameLength = 0;
             
             // 게임 상태 변경 이벤트 발행
-            GameStateEventData* stateData = MemoryPool_Alloc(&g_gameStateEventPool);
-            if (stateData) {
-                stateData->oldState = GAME_STATE_OVER;
-                stateData->newState = GAME_STATE_SCORE_ENTRY;
-                PublishEvent(EVENT_GAME_STATE_CHANGED, stateData);
-            }
+            GameStateEventData stateData = {0};
+            stateData.oldState = GAME_STATE_OVER;
+            stateData.newState = GAME_STATE_SCORE_ENTRY;
+            PublishEvent(EVENT_GAME_STATE_CHANGED, &stateData, sizeof(stateData));
         }
         return;
     }
@@ -298,11 +529,11 @@ void UpdateGame(Game* game) {
             }
             key = GetCharPressed();
         }
-        if (IsKeyPressed(KEY_BACKSPACE) && game->nameLength > 0) {
+        if (Replay_IsKeyPressed(KEY_BACKSPACE) && game->nameLength > 0) {
             game->nameLength--;
             game->playerName[game->nameLength] = '\0';
         }
-        if (IsKeyPressed(KEY_ENTER) && game->nameLength > 0) {
+        if (Replay_IsKeyPressed(KEY_ENTER) && game->nameLength > 0) {
             // 새로운 코드: 점수 저장 후 단순히 상태만 변경
             AddScoreToScoreboard(game);
             
@@ -313,228 +544,104 @@ void UpdateGame(Game* game) {
             
             // 선택적: 상태 변경 이벤트 발행
             if (game->useEventSystem) {
-                GameStateEventData* stateData = MemoryPool_Alloc(&g_gameStateEventPool);
-                if (stateData) {
-                    stateData->oldState = GAME_STATE_SCORE_ENTRY;
-                    stateData->newState = GAME_STATE_TUTORIAL;
-                    PublishEvent(EVENT_GAME_STATE_CHANGED, stateData);
-                }
+                GameStateEventData stateData = {0};
+                stateData.oldState = GAME_STATE_SCORE_ENTRY;
+                stateData.newState = GAME_STATE_TUTORIAL;
+                PublishEvent(EVENT_GAME_STATE_CHANGED, &stateData, sizeof(stateData));
             }
         }
         return;
     }
     
     if (game->gameState == GAME_STATE_PLAYING) {
-        // Update stage system
-        UpdateStageSystem(game);
-        
-        // 이벤트 시스템을 사용하지 않을 경우에만 직접 입력 처리
-        if (!game->useEventSystem) {
-            // 직접 입력 방식에서만 키 상태 직접 설정
-            bool isSpacePressed = IsKeyDown(KEY_SPACE);
-            bool isShiftPressed = IsKeyDown(KEY_LEFT_SHIFT);
-            game->player.isBoosting = isSpacePressed;
-            game->player.isSpeedBoosting = isShiftPressed;
-        }
-        
-        // 플레이어 업데이트 (방향키로 이동)
-        UpdatePlayer(&game->player, game->screenWidth, game->screenHeight, game->moveSpeed, game->deltaTime);
-        
-        // Update enemies with AI
-        for (int i = 0; i < game->enemyCount; i++) {
-            UpdateEnemyAI(&game->enemies[i], game->player.position, game->deltaTime);
-            UpdateEnemyMovement(&game->enemies[i], game->player.position, game->deltaTime);
-            UpdateEnemy(&game->enemies[i], game->screenWidth, game->screenHeight, game->deltaTime);
-
-            // BLACKHOLE special behavior
-            if (game->enemies[i].type == ENEMY_TYPE_BLACKHOLE) {
-                // Check if other enemies exist
-                int otherEnemiesCount = 0;
-                for (int j = 0; j < game->enemyCount; j++) {
-                    if (j != i && game->enemies[j].health > 0) {
-                        otherEnemiesCount++;
-                    }
-                }
-                
-                // Debug output
-                // static float lastDebugBlackhole = 0;
-                // if (game->stageTimer - lastDebugBlackhole > 1.0f) {
-                //     printf("BLACKHOLE: otherEnemies=%d, isInvuln=%d, hasPulsed=%d, stormTimer=%.1f\n", 
-                //            otherEnemiesCount, game->enemies[i].isInvulnerable, 
-                //            game->enemies[i].hasPulsed, game->enemies[i].stormCycleTimer);
-                //     lastDebugBlackhole = game->stageTimer;
-                // }
-                
-                // Update blackhole state based on other enemies
-                if (otherEnemiesCount == 0 &&
-                    HasState(game->enemies[i].stateFlags, ENEMY_STATE_INVULNERABLE) &&
-                    !HasState(game->enemies[i].stateFlags, ENEMY_STATE_PULSED)) {
-                    // printf("BLACKHOLE TRANSFORMATION TRIGGERED!\n");
-                    // All other enemies are dead, perform pulse and transform immediately
-                    SetState(&game->enemies[i].stateFlags, ENEMY_STATE_PULSED);
-                    ClearState(&game->enemies[i].stateFlags, ENEMY_STATE_INVULNERABLE);
-                    game->enemies[i].movePattern = MOVE_PATTERN_TRACKING;
-                    game->enemies[i].color = (Color){150, 0, 50, 255};  // Reddish color when active
-                    game->enemies[i].aiState = AI_STATE_CHASE;
-                    // Increase speed
-                    game->enemies[i].velocity.x *= 3.0f;
-                    game->enemies[i].velocity.y *= 3.0f;
-                    
-                    // Create a powerful radial pulse that pushes all particles away
-                    #define PULSE_RADIUS 400.0f
-                    #define PULSE_FORCE 20.0f
-                    for (int p = 0; p < PARTICLE_COUNT; p++) {
-                        float dx = game->particles[p].position.x - game->enemies[i].position.x;
-                        float dy = game->particles[p].position.y - game->enemies[i].position.y;
-                        float dist = sqrtf(dx*dx + dy*dy);
-                        Vector2 pulseDir = {0, 0};
-                        if (dist > 0.0f) {
-                            pulseDir.x = dx / dist;
-                            pulseDir.y = dy / dist;
-                        }
-                        if (dist < PULSE_RADIUS && dist > 1.0f) {
-                            // Push particles away from blackhole center (invert direction)
-                            pulseDir.x = -pulseDir.x;
-                            pulseDir.y = -pulseDir.y;
-                            float pulsePower = (1.0f - dist / PULSE_RADIUS) * PULSE_FORCE;
-                            game->particles[p].velocity.x += pulseDir.x * pulsePower;
-                            game->particles[p].velocity.y += pulseDir.y * pulsePower;
-                        }
-                    }
-                }
-                
-                // Apply semi-magnetic storm after transformation (cycles every 5 seconds)
-                if (HasState(game->enemies[i].stateFlags, ENEMY_STATE_PULSED) && game->enemies[i].type == ENEMY_TYPE_BLACKHOLE) {
-                    // Update storm cycle timer
-                    game->enemies[i].stateData.stormCycleTimer += game->deltaTime;
-                    if (game->enemies[i].stateData.stormCycleTimer >= 6.0f) {
-                        game->enemies[i].stateData.stormCycleTimer = 0.0f;  // Reset every 6 seconds (5 on, 1 off)
-                    }
+        RunFixedSteps(game, frameTime, StepPlaying);
+    }
+}
 
-                    // Check if storm is active (first 5 seconds of cycle)
-                    bool stormActive = game->enemies[i].stateData.stormCycleTimer < 5.0f;
-
-                    // Update color based on storm state
-                    if (stormActive) {
-                        // Calculate storm strength for color interpolation
-                        float stormStrength = 1.0f - (game->enemies[i].stateData.stormCycleTimer / 5.0f);
-                        // Interpolate from bright red to dark red as storm weakens
-                        int redValue = 100 + (int)(100 * stormStrength);  // 200 to 100
-                        int greenValue = (int)(50 * (1.0f - stormStrength));  // 0 to 50
-                        game->enemies[i].color = (Color){redValue, greenValue, 50, 255};
-                    } else {
-                        game->enemies[i].color = (Color){100, 150, 50, 255};  // Greenish when vulnerable
-                    }
-                    
-                    // Apply magnetic storm only when active
-                    if (stormActive) {
-                        #define SEMI_STORM_RADIUS 150.0f
-                        #define SEMI_STORM_FORCE 3.0f
-                        
-                        // Calculate storm strength that decreases over time (1.0 to 0.0 over 5 seconds)
-                        // float stormStrength = 1.0f - (game->enemies[i].stormCycleTimer / 5.0f);
-                        
-                        // Alternative: Use sine wave for smoother transition
-                        // float stormStrength = fmaxf(cosf((game->enemies[i].stormCycleTimer / 5.0f) * PI * 0.5f), 0.5f);
-                        float stormStrength = 1.0f;
-                        
-                        
-                        for (int p = 0; p < PARTICLE_COUNT; p++) {
-                            float dx = game->particles[p].position.x - game->enemies[i].position.x;
-                            float dy = game->particles[p].position.y - game->enemies[i].position.y;
-                            float dist = sqrtf(dx*dx + dy*dy);
-                            Vector2 repelDir = {0, 0};
-                            if (dist > 0.0f) {
-                                repelDir.x = dx / dist;
-                                repelDir.y = dy / dist;
-                            }
-                            if (dist < SEMI_STORM_RADIUS && dist > 1.0f) {
-                                // 70% chance to repel each particle when storm is active
-                                if (GetRandomValue(1, 10) <= 7) {
-                                    // repelDir is already enemy->particle direction, so use it directly for repulsion
-                                    float distanceFactor = 1.0f - (dist / SEMI_STORM_RADIUS);
-                                    float repelForce = distanceFactor * SEMI_STORM_FORCE * stormStrength;
-                                    game->particles[p].velocity.x += repelDir.x * repelForce;
-                                    game->particles[p].velocity.y += repelDir.y * repelForce;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+// 이전 스텝과 마지막 스텝 사이의 렌더 위치 (이전 상태가 없으면 현재 위치)
+static Vector2 InterpolatePosition(const Game* game, Vector2 previous, Vector2 current) {
+    if (!game->clock.hasPrevious) return current;
+    float alpha = game->clock.alpha;
+    return (Vector2){
+        previous.x + (current.x - previous.x) * alpha,
+        previous.y + (current.y - previous.y) * alpha
+    };
+}
+
+// 파티클 하나씩 그리기 (프레임버퍼 할당 실패 시)
+static void DrawParticlePixels(const Game* game) {
+    const ParticleBuffer* particles = &game->particles;
+    if (!game->clock.hasPrevious || !game->particlePreviousX || !game->particlePreviousY) {
+        for (int i = 0; i < particles->count; i++) {
+            Render_DrawPixelV(ParticleBuffer_GetPosition(particles, i), particles->color);
         }
+        return;
+    }
 
-        // Apply gravity from all registered sources to particles
-        ApplyAllGravitySources(game, game->deltaTime);
+    float alpha = game->clock.alpha;
+    for (int i = 0; i < particles->count; i++) {
+        float px = game->particlePreviousX[i];
+        float py = game->particlePreviousY[i];
+        Render_DrawPixelV((Vector2){ px + (particles->x[i] - px) * alpha, py + (particles->y[i] - py) * alpha },
+                          particles->color);
+    }
+}
 
-        // Legacy enemy spawn (only if not using stage system)
-        if (game->currentStageNumber == 0) {
-            SpawnEnemyIfNeeded(game);
-            UpdateAllEnemies(game);
-        }
-        
-        // 모든 파티클 업데이트 (이벤트 처리된 isBoosting 값 사용)
-        UpdateAllParticles(game, game->player.isBoosting);
+/**
+ * @brief Draw every particle, interpolated between the last two steps
+ *
+ * Particles are rasterized on the CPU by the worker threads and handed to the
+ * render backend as a single image instead of one DrawPixelV call each.
+ */
+static void DrawInterpolatedParticles(Game* game) {
+    if (!game->particleRaster.pixels) {
+        DrawParticlePixels(game);
+        return;
+    }
 
-        // Enemy-Particle 충돌 체크 및 이벤트 발행
-        ProcessEnemyCollisions(game);
-        
-        // Update items and check item collisions
-        UpdateItemManager(game->deltaTime, game->screenWidth, game->screenHeight);
-        CheckItemCollisions(&game->player);
-        
-        // 플레이어-적 충돌 체크
-        for (int i = 0; i < game->enemyCount; i++) {
-            float px = game->player.position.x + game->player.size/2;
-            float py = game->player.position.y + game->player.size/2;
-            // Ignore collision for first 0.5s after enemy spawn
-            if (GetTime() - game->enemies[i].spawnTime < 0.5f) continue;
-            if (CheckCollisionCircles((Vector2){px, py}, game->player.size/2, game->enemies[i].position, game->enemies[i].radius)) {
-                // 플레이어-적 충돌 이벤트 발행 (메모리 풀 사용)
-                CollisionEventData* collisionData = MemoryPool_Alloc(&g_collisionEventPool);
-                if (collisionData) {
-                    collisionData->entityAIndex = 0; // 플레이어는 단일 엔티티이므로 인덱스는 0
-                    collisionData->entityBIndex = i;
-                    collisionData->entityAPtr = &game->player;
-                    collisionData->entityBPtr = &game->enemies[i];
-                    collisionData->entityAType = 2; // 2: 플레이어
-                    collisionData->entityBType = 1; // 1: 적
-                    collisionData->impact = 1.0f; // 플레이어-적 충돌은 치명적
-                    PublishEvent(EVENT_COLLISION_PLAYER_ENEMY, collisionData);
-                }
-            }
-        }
-        
-        // 폭발 파티클 업데이트
-        UpdateAllExplosionParticles(game);
+    bool interpolate = game->clock.hasPrevious && game->particlePreviousX && game->particlePreviousY;
+    ParticleRasterSource source = {
+        .x = game->particles.x,
+        .y = game->particles.y,
+        .previousX = interpolate ? game->particlePreviousX : NULL,
+        .previousY = interpolate ? game->particlePreviousY : NULL,
+        .alpha = game->clock.alpha,
+        .count = game->particles.count,
+        .color = game->particles.color
+    };
+    PROFILE_BEGIN(PROFILE_ZONE_PARTICLE_RASTER);
+    ParticleRaster_Render(&game->particleRaster, &source);
+    PROFILE_END(PROFILE_ZONE_PARTICLE_RASTER);
+
+    Render_DrawPixels(game->particleRaster.pixels, game->particleRaster.width, game->particleRaster.height, 0, 0);
+}
+
+static void DrawInterpolatedEnemies(const Game* game) {
+    for (int i = 0; i < game->enemies.count; i++) {
+        const Enemy* enemy = &game->enemies.items[i];
+        DrawEnemy(enemy, InterpolatePosition(game, game->enemies.previousPosition[i], enemy->position));
     }
 }
 
 void DrawGame(Game* game) {
-    BeginDrawing();
+    Render_BeginFrame();
 
     if (game->gameState == GAME_STATE_PLAYING || game->gameState == GAME_STATE_STAGE_INTRO || game->gameState == GAME_STATE_TEST_MODE) {
-        ClearBackground(game->currentStage.backgroundColor);
+        Render_ClearBackground(game->currentStage.backgroundColor);
     } else {
-        ClearBackground(RAYWHITE);
+        Render_ClearBackground(RAYWHITE);
     }
 
     // Test mode rendering
     if (game->gameState == GAME_STATE_TEST_MODE) {
-        // Draw particles
-        for (int i = 0; i < PARTICLE_COUNT; i++) {
-            DrawParticlePixel(game->particles[i]);
-        }
-
-        // Draw enemies
-        for (int i = 0; i < game->enemyCount; i++) {
-            DrawEnemy(game->enemies[i]);
-        }
+        // Draw particles and enemies between the last two steps
+        DrawInterpolatedParticles(game);
+        DrawInterpolatedEnemies(game);
 
         // Draw player
         if (!game->player.isInvincible || ((int)(GetTime() * 10) % 2 == 0)) {
-            DrawRectangle(game->player.position.x, game->player.position.y,
-                         game->player.size, game->player.size, RED);
+            Vector2 playerPos = InterpolatePosition(game, game->player.previousPosition, game->player.position);
+            Render_DrawRectangle(playerPos.x, playerPos.y, game->player.size, game->player.size, RED);
         }
 
         // Draw test mode UI
@@ -544,19 +651,19 @@ void DrawGame(Game* game) {
         DrawEnemyStateDebug(game, game->screenWidth, game->screenHeight);
 
         // Draw FPS
-        DrawFPS(10, 10);
+        Render_DrawFPS(10, 10);
 
-        EndDrawing();
+        Render_EndFrame();
         return;
     }
 
     if (game->gameState == GAME_STATE_TUTORIAL) {
-        DrawText("How to Play", 320, 200, 32, DARKBLUE);
-        DrawText("Move: Arrow keys", 260, 260, 24, BLACK);
-        DrawText("Attract particles: SPACE", 260, 300, 24, BLACK);
-        DrawText("Speed boost: Shift", 260, 340, 24, BLACK);
-        DrawText("Press Enter to Start", 260, 380, 24, RED);
-        EndDrawing();
+        Render_DrawText("How to Play", 320, 200, 32, DARKBLUE);
+        Render_DrawText("Move: Arrow keys", 260, 260, 24, BLACK);
+        Render_DrawText("Attract particles: SPACE", 260, 300, 24, BLACK);
+        Render_DrawText("Speed boost: Shift", 260, 340, 24, BLACK);
+        Render_DrawText("Press Enter to Start", 260, 380, 24, RED);
+        Render_EndFrame();
         return;
     }
     
@@ -567,7 +674,7 @@ void DrawGame(Game* game) {
             DrawStageIntro(&game->currentStage, game->screenWidth, game->screenHeight);
         } else if (game->currentStage.state == STAGE_STATE_COUNTDOWN) {
             // Phase 2: White background with countdown
-            ClearBackground(RAYWHITE);
+            Render_ClearBackground(RAYWHITE);
             
             float remainingTime = 3.0f - game->currentStage.stateTimer;
             if (remainingTime > 0) {
@@ -600,29 +707,29 @@ void DrawGame(Game* game) {
                 int adjustedFontSize = (int)(fontSize * pulseScale);
                 
                 // Center the text
-                int textWidth = MeasureText(countdownText, adjustedFontSize);
+                int textWidth = Render_MeasureText(countdownText, adjustedFontSize);
                 int textX = game->screenWidth / 2 - textWidth / 2;
                 int textY = game->screenHeight / 2 - adjustedFontSize / 2;
                 
                 // Add glowing background circle with color matching countdown
                 Color circleColor = Fade(textColor, 0.3f);
                 float circleRadius = 120 + sinf(GetTime() * pulseSpeed) * 20;
-                DrawCircle(game->screenWidth / 2, game->screenHeight / 2, circleRadius, circleColor);
+                Render_DrawCircle(game->screenWidth / 2, game->screenHeight / 2, circleRadius, circleColor);
                 
                 // Draw multiple shadow layers for glow effect
                 for (int i = 8; i >= 1; i--) {
                     Color shadowColor = Fade(BLACK, 0.1f);
-                    DrawText(countdownText, textX + i, textY + i, adjustedFontSize, shadowColor);
+                    Render_DrawText(countdownText, textX + i, textY + i, adjustedFontSize, shadowColor);
                 }
                 
                 // Draw main text with outline
-                DrawText(countdownText, textX + 1, textY + 1, adjustedFontSize, BLACK);
-                DrawText(countdownText, textX, textY, adjustedFontSize, textColor);
+                Render_DrawText(countdownText, textX + 1, textY + 1, adjustedFontSize, BLACK);
+                Render_DrawText(countdownText, textX, textY, adjustedFontSize, textColor);
                 
                 // Add screen flash effect for "1" and "START!"
                 if (countdown == 1 || strcmp(countdownText, "START!") == 0) {
                     float flashAlpha = (sinf(GetTime() * 15.0f) + 1.0f) * 0.1f;
-                    DrawRectangle(0, 0, game->screenWidth, game->screenHeight, Fade(WHITE, flashAlpha));
+                    Render_DrawRectangle(0, 0, game->screenWidth, game->screenHeight, Fade(WHITE, flashAlpha));
                 }
             }
         } else if (game->currentStage.state == STAGE_STATE_BOSS_WARNING) {
@@ -646,51 +753,49 @@ void DrawGame(Game* game) {
                 int fontSize = (int)(60 * pulseScale);
                 Color textColor = Fade(RED, 0.8f + sinf(GetTime() * 15.0f) * 0.2f);
                 
-                int textWidth = MeasureText(countdownText, fontSize);
+                int textWidth = Render_MeasureText(countdownText, fontSize);
                 int textX = game->screenWidth / 2 - textWidth / 2;
                 int textY = game->screenHeight / 2 + 100;
                 
-                DrawText(countdownText, textX + 2, textY + 2, fontSize, BLACK);
-                DrawText(countdownText, textX, textY, fontSize, textColor);
+                Render_DrawText(countdownText, textX + 2, textY + 2, fontSize, BLACK);
+                Render_DrawText(countdownText, textX, textY, fontSize, textColor);
             }
         }
-        EndDrawing();
+        Render_EndFrame();
         return;
     }
     
     if (game->gameState == GAME_STATE_STAGE_COMPLETE) {
         DrawStageComplete(&game->currentStage, game->screenWidth, game->screenHeight);
-        EndDrawing();
+        Render_EndFrame();
         return;
     }
     
     if (game->gameState == GAME_STATE_VICTORY) {
-        DrawRectangle(0, 0, game->screenWidth, game->screenHeight, Fade(GOLD, 0.7f));
+        Render_DrawRectangle(0, 0, game->screenWidth, game->screenHeight, Fade(GOLD, 0.7f));
         const char* victoryText = "VICTORY!";
         int fontSize = 72;
-        int textWidth = MeasureText(victoryText, fontSize);
-        DrawText(victoryText, game->screenWidth/2 - textWidth/2, game->screenHeight/2 - 100, fontSize, WHITE);
+        int textWidth = Render_MeasureText(victoryText, fontSize);
+        Render_DrawText(victoryText, game->screenWidth/2 - textWidth/2, game->screenHeight/2 - 100, fontSize, WHITE);
         
         char scoreText[64];
         sprintf(scoreText, "Final Score: %d", game->score);
         fontSize = 36;
-        textWidth = MeasureText(scoreText, fontSize);
-        DrawText(scoreText, game->screenWidth/2 - textWidth/2, game->screenHeight/2, fontSize, WHITE);
+        textWidth = Render_MeasureText(scoreText, fontSize);
+        Render_DrawText(scoreText, game->screenWidth/2 - textWidth/2, game->screenHeight/2, fontSize, WHITE);
         
         const char* continueText = "Press Enter to save your score";
         fontSize = 24;
-        textWidth = MeasureText(continueText, fontSize);
-        DrawText(continueText, game->screenWidth/2 - textWidth/2, game->screenHeight/2 + 60, fontSize, WHITE);
-        EndDrawing();
+        textWidth = Render_MeasureText(continueText, fontSize);
+        Render_DrawText(continueText, game->screenWidth/2 - textWidth/2, game->screenHeight/2 + 60, fontSize, WHITE);
+        Render_EndFrame();
         return;
     }
 
     // Only draw game objects during PLAYING state
     if (game->gameState == GAME_STATE_PLAYING) {
-        // 모든 파티클 그리기
-        for (int i = 0; i < PARTICLE_COUNT; i++) {
-            DrawParticlePixel(game->particles[i]);
-        }
+        // 모든 파티클 그리기 (마지막 두 스텝 사이 보간)
+        DrawInterpolatedParticles(game);
         
         // 폭발 파티클 그리기
         for (int i = 0; i < game->explosionParticleCount; i++) {
@@ -698,9 +803,7 @@ void DrawGame(Game* game) {
         }
         
         // Draw all enemies
-        for (int i = 0; i < game->enemyCount; i++) {
-            DrawEnemy(game->enemies[i]);
-        }
+        DrawInterpolatedEnemies(game);
         
         // Draw items
         DrawItems();
@@ -708,7 +811,7 @@ void DrawGame(Game* game) {
         // 점수 표시
         char scoreText[32];
         sprintf(scoreText, "Score: %d", game->score);
-        DrawText(scoreText, 10, 10, 20, BLACK);
+        Render_DrawText(scoreText, 10, 10, 20, BLACK);
         
         // Draw stage progress if in a stage
         if (game->currentStageNumber > 0) {
@@ -718,82 +821,74 @@ void DrawGame(Game* game) {
         int barW = 120, barH = 12;
         int barX = game->screenWidth - barW - 10;
         int barY = 10;
-        DrawRectangle(barX-2, barY-2, barW+4, barH+4, GRAY); // border
+        Render_DrawRectangle(barX-2, barY-2, barW+4, barH+4, GRAY); // border
         int boostW = (int)(barW * (game->player.boostGauge/BOOST_GAUGE_MAX));
-        DrawRectangle(barX, barY, boostW, barH, SKYBLUE);
-        DrawRectangleLines(barX-2, barY-2, barW+4, barH+4, DARKBLUE);
+        Render_DrawRectangle(barX, barY, boostW, barH, SKYBLUE);
+        Render_DrawRectangleLines(barX-2, barY-2, barW+4, barH+4, DARKBLUE);
         // UX: If boostGauge <= 50, gray out right half and show lock
         if (game->player.boostGauge <= 50.0f) {
-            DrawRectangle(barX + barW/2, barY, barW/2, barH, (Color){180,180,180,180});
-            DrawText("BOOST LOCKED", barX + barW/2 - 8, barY - 18, 14, DARKGRAY);
+            Render_DrawRectangle(barX + barW/2, barY, barW/2, barH, (Color){180,180,180,180});
+            Render_DrawText("BOOST LOCKED", barX + barW/2 - 8, barY - 18, 14, DARKGRAY);
         }
         // 체력(하트) 표시
         for (int i = 0; i < game->player.health; i++) {
-            DrawRectangle(10 + i * 30, 40, 20, 20, RED);
+            Render_DrawRectangle(10 + i * 30, 40, 20, 20, RED);
         }
         
         // 플레이어 그리기 (무적 시 깜빡임)
         if (!game->player.isInvincible || ((int)(GetTime() * 10) % 2 == 0)) {
-            DrawRectangle(game->player.position.x, game->player.position.y, game->player.size, game->player.size, RED);
+            Vector2 playerPos = InterpolatePosition(game, game->player.previousPosition, game->player.position);
+            Render_DrawRectangle(playerPos.x, playerPos.y, game->player.size, game->player.size, RED);
         }
         
         // FPS 표시
-        DrawFPS(10, 70);
+        Render_DrawFPS(10, 70);
     }
     
     // 게임 오버 화면
     if (game->gameState == GAME_STATE_OVER) {
         int sw = game->screenWidth;
         int sh = game->screenHeight;
-        DrawText("GAME OVER", sw/2 - 100, sh/2 - 90, 40, RED);
+        Render_DrawText("GAME OVER", sw/2 - 100, sh/2 - 90, 40, RED);
         char scoreText[64];
         sprintf(scoreText, "Final Score: %d", game->score);
-        DrawText(scoreText, sw/2 - 100, sh/2 - 40, 30, BLACK);
-        DrawText("Press Enter to register your score!", sw/2 - 180, sh/2 + 10, 20, DARKGRAY);
+        Render_DrawText(scoreText, sw/2 - 100, sh/2 - 40, 30, BLACK);
+        Render_DrawText("Press Enter to register your score!", sw/2 - 180, sh/2 + 10, 20, DARKGRAY);
     }
     if (game->gameState == GAME_STATE_SCORE_ENTRY) {
         int sw = game->screenWidth;
         int sh = game->screenHeight;
-        DrawText("Enter your name:", sw/2 - 120, sh/2 - 60, 30, BLACK);
-        DrawRectangle(sw/2 - 120, sh/2 - 20, 300, 40, LIGHTGRAY);
-        DrawText(game->playerName, sw/2 - 110, sh/2 - 10, 30, MAROON);
+        Render_DrawText("Enter your name:", sw/2 - 120, sh/2 - 60, 30, BLACK);
+        Render_DrawRectangle(sw/2 - 120, sh/2 - 20, 300, 40, LIGHTGRAY);
+        Render_DrawText(game->playerName, sw/2 - 110, sh/2 - 10, 30, MAROON);
         if ((int)(GetTime()*2)%2 == 0 && game->nameLength < MAX_NAME_LENGTH-1) {
-            DrawText("_", sw/2 - 110 + MeasureText(game->playerName, 30), sh/2 - 10, 30, MAROON);
+            Render_DrawText("_", sw/2 - 110 + Render_MeasureText(game->playerName, 30), sh/2 - 10, 30, MAROON);
         }
-        DrawText("Press Enter to save", sw/2 - 120, sh/2 + 30, 20, DARKGRAY);
+        Render_DrawText("Press Enter to save", sw/2 - 120, sh/2 + 30, 20, DARKGRAY);
         // Scoreboard display
-        DrawText("SCOREBOARD", sw/2 - 100, sh/2 + 70, 28, BLUE);
+        Render_DrawText("SCOREBOARD", sw/2 - 100, sh/2 + 70, 28, BLUE);
         for (int i = 0; i < game->scoreboardCount; i++) {
             char entry[64];
             sprintf(entry, "%2d. %-15s %6d", i+1, game->scoreboard[i].name, game->scoreboard[i].score);
-            DrawText(entry, sw/2 - 100, sh/2 + 100 + i*28, 24, (i==0)?GOLD:BLACK);
+            Render_DrawText(entry, sw/2 - 100, sh/2 + 100 + i*28, 24, (i==0)?GOLD:BLACK);
         }
     }
-    EndDrawing();
+    Render_EndFrame();
 }
 
 // 게임 종료 시 메모리 해제
 void CleanupGame(Game* game) {
-    if (game->particles) {
-        free(game->particles);
-        game->particles = NULL;
-    }
-    
-    if (game->enemies) {
-        free(game->enemies);
-        game->enemies = NULL;
-    }
-    
-    // 물리 시스템 메모리 풀 정리
-    CleanupPhysicsMemoryPools();
-    
-    // 추가 메모리 풀 정리
-    if (g_additionalPoolsInitialized) {
-        MemoryPool_Destroy(&g_stageChangeEventPool);
-        MemoryPool_Destroy(&g_specialAbilityEventPool);
-        MemoryPool_Destroy(&g_particleEffectEventPool);
-        g_additionalPoolsInitialized = false;
-    }
+    ParticlePipeline_Destroy(&game->particlePipeline);
+    GravityField_Destroy(&game->gravityField);
+    SpatialGrid_Destroy(&game->particleGrid);
+    ParticleBuffer_Destroy(&game->particles);
+    ParticleRaster_Destroy(&game->particleRaster);
+    free(game->particlePreviousX);
+    free(game->particlePreviousY);
+    game->particlePreviousX = NULL;
+    game->particlePreviousY = NULL;
+    
+    EnemyStore_Destroy(&game->enemies);
     
     // Cleanup item manager
     CleanupItemManager();
@@ -893,54 +988,25 @@ void AddScoreToScoreboard(Game* game) {
 
 // 전방 선언
 static void OnGameStateChanged(const Event* event, void* context);
-static void OnParticleEnemyCollision(const Event* event, void* context);
+static void OnEnemyDamageBatch(const Event* event, void* context);
 static void OnPlayerEnemyCollision(const Event* event, void* context);
 static void OnEnemySpawned(const Event* event, void* context);
 static void OnEnemyDestroyed(const Event* event, void* context);
-static void OnEnemyHealthChanged(const Event* event, void* context);
-static void OnEnemyStateChanged(const Event* event, void* context);
-
-// 메모리 풀 유효성 확인 함수
-static bool IsFromMemoryPool(MemoryPool* pool, void* ptr) {
-    if (!pool || !ptr || !pool->blocks) return false;
-    
-    char* poolStart = (char*)pool->blocks;
-    char* poolEnd = poolStart + (pool->capacity * pool->blockSize);
-    
-    return (char*)ptr >= poolStart && (char*)ptr < poolEnd;
-}
+static void OnEnemyStateBatch(const Event* event, void* context);
 
 // 게임 상태 변경 이벤트 핸들러
 static void OnGameStateChanged(const Event* event, void* context) {
-    GameStateEventData* data = (GameStateEventData*)event->data;
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_gameStateEventPool, data)) {
-        MemoryPool_Free(&g_gameStateEventPool, data);
-    } else {
-        free(data);
-    }
 }
 
-// 충돌 이벤트 핸들러 - 파티클-적 충돌
-static void OnParticleEnemyCollision(const Event* event, void* context) {
-    CollisionEventData* data = (CollisionEventData*)event->data;
-    
+// 충돌 이벤트 핸들러 - 프레임 동안의 파티클-적 충돌과 체력 변화 (적마다 레코드 하나)
+static void OnEnemyDamageBatch(const Event* event, void* context) {
     // 누적된 충돌 영향력 처리 (체력은 physics.c에서 이미 감소시켰으므로 여기서는 처리하지 않음)
-    // 추가적인 특수 효과나 로직이 필요하면 여기에 구현
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_collisionEventPool, data)) {
-        MemoryPool_Free(&g_collisionEventPool, data);
-    } else {
-        free(data); // 풀에서 할당되지 않은 경우 일반 free 사용
-    }
+    // 추가적인 특수 효과나 로직이 필요하면 여기에 구현 (EventBatchData.items 는 EnemyDamageRecord 배열)
 }
 
 // 플레이어-적 충돌 이벤트 핸들러
 static void OnPlayerEnemyCollision(const Event* event, void* context) {
     Game* game = (Game*)context;
-    CollisionEventData* data = (CollisionEventData*)event->data;
     
     // 플레이어 피해 적용
     DamagePlayer(&game->player);
@@ -951,79 +1017,34 @@ static void OnPlayerEnemyCollision(const Event* event, void* context) {
         game->gameState = GAME_STATE_OVER;
         
         // 게임 상태 변경 이벤트 발행
-        GameStateEventData* stateData = MemoryPool_Alloc(&g_gameStateEventPool);
-        if (stateData) {
-            stateData->oldState = GAME_STATE_PLAYING;
-            stateData->newState = GAME_STATE_OVER;
-            PublishEvent(EVENT_GAME_STATE_CHANGED, stateData);
-        }
-    }
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_collisionEventPool, data)) {
-        MemoryPool_Free(&g_collisionEventPool, data);
-    } else {
-        free(data);
+        GameStateEventData stateData = {0};
+        stateData.oldState = GAME_STATE_PLAYING;
+        stateData.newState = GAME_STATE_OVER;
+        PublishEvent(EVENT_GAME_STATE_CHANGED, &stateData, sizeof(stateData));
     }
 }
 
 void RegisterCollisionEventHandlers(Game* game) {
-    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, OnParticleEnemyCollision, game);
+    SubscribeToEvent(EVENT_ENEMY_DAMAGE_BATCH, OnEnemyDamageBatch, game);
     SubscribeToEvent(EVENT_COLLISION_PLAYER_ENEMY, OnPlayerEnemyCollision, game);
     SubscribeToEvent(EVENT_GAME_STATE_CHANGED, OnGameStateChanged, game);
 }
 
 // 적 이벤트 샘플 핸들러
 static void OnEnemySpawned(const Event* event, void* context) {
-    EnemyEventData* data = (EnemyEventData*)event->data;
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_enemyEventPool, data)) {
-        MemoryPool_Free(&g_enemyEventPool, data);
-    } else {
-        free(data);
-    }
 }
 
 static void OnEnemyDestroyed(const Event* event, void* context) {
-    EnemyEventData* data = (EnemyEventData*)event->data;
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_enemyEventPool, data)) {
-        MemoryPool_Free(&g_enemyEventPool, data);
-    } else {
-        free(data);
-    }
 }
 
-static void OnEnemyHealthChanged(const Event* event, void* context) {
-    EnemyHealthEventData* data = (EnemyHealthEventData*)event->data;
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_enemyHealthEventPool, data)) {
-        MemoryPool_Free(&g_enemyHealthEventPool, data);
-    } else {
-        free(data);
-    }
-}
-
-// 적 상태 변경 이벤트 핸들러
-static void OnEnemyStateChanged(const Event* event, void* context) {
-    EnemyStateEventData* data = (EnemyStateEventData*)event->data;
-    
-    // 메모리 풀 체크 후 반환
-    if (IsFromMemoryPool(&g_enemyStateEventPool, data)) {
-        MemoryPool_Free(&g_enemyStateEventPool, data);
-    } else {
-        free(data);
-    }
+// 적 상태 변경 이벤트 핸들러 (EventBatchData.items 는 EnemyStateEventData 배열)
+static void OnEnemyStateBatch(const Event* event, void* context) {
 }
 
 void RegisterEnemyEventHandlers(void) {
     SubscribeToEvent(EVENT_ENEMY_SPAWNED, OnEnemySpawned, NULL);
     SubscribeToEvent(EVENT_ENEMY_DESTROYED, OnEnemyDestroyed, NULL);
-    SubscribeToEvent(EVENT_ENEMY_HEALTH_CHANGED, OnEnemyHealthChanged, NULL);
-    SubscribeToEvent(EVENT_ENEMY_STATE_CHANGED, OnEnemyStateChanged, NULL);
+    SubscribeToEvent(EVENT_ENEMY_STATE_BATCH, OnEnemyStateBatch, NULL);
 }
 
 // Load a specific stage
@@ -1054,7 +1075,7 @@ void LoadStage(Game* game, int stageNumber) {
     game->currentStage.totalEnemiesSpawned = 0;
     
     // Clear existing enemies
-    game->enemyCount = 0;
+    ClearEnemies(game);
     
     // Apply stage modifiers
     if (game->currentStage.particleAttractionMultiplier > 0) {
@@ -1062,19 +1083,15 @@ void LoadStage(Game* game, int stageNumber) {
     }
     
     // Update particle colors to match stage theme
-    for (int i = 0; i < PARTICLE_COUNT; i++) {
-        game->particles[i].color = game->currentStage.particleColor;
-    }
+    game->particles.color = game->currentStage.particleColor;
     
     // Publish stage started event
-    StageChangeEventData* stageData = MemoryPool_Alloc(&g_stageChangeEventPool);
-    if (stageData) {
-        stageData->oldStageNumber = stageNumber - 1;
-        stageData->newStageNumber = stageNumber;
-        stageData->enemiesKilled = game->totalEnemiesKilled;
-        stageData->score = game->score;
-        PublishEvent(EVENT_STAGE_STARTED, stageData);
-    }
+    StageChangeEventData stageData = {0};
+    stageData.oldStageNumber = stageNumber - 1;
+    stageData.newStageNumber = stageNumber;
+    stageData.enemiesKilled = game->totalEnemiesKilled;
+    stageData.score = game->score;
+    PublishEvent(EVENT_STAGE_STARTED, &stageData, sizeof(stageData));
     
     // Set appropriate game state
     if (stageNumber == 6 || stageNumber == 10) {
@@ -1101,7 +1118,7 @@ void UpdateStageSystem(Game* game) {
     if (game->stageTimer - lastDebugTime >= 2.0f) {
         printf("UpdateStageSystem: stageTimer=%.1f, waveTimer=%.1f, currentWave=%d, totalEnemiesSpawned=%d, enemyCount=%d\n", 
                game->stageTimer, game->currentStage.waveTimer, game->currentStage.currentWave, 
-               game->currentStage.totalEnemiesSpawned, game->enemyCount);
+               game->currentStage.totalEnemiesSpawned, game->enemies.count);
         
         bool shouldSpawn = ShouldSpawnEnemy(&game->currentStage, game->stageTimer);
         printf("ShouldSpawnEnemy=%s, maxEnemiesAlive=%d\n", shouldSpawn ? "true" : "false", game->currentStage.maxEnemiesAlive);
@@ -1111,7 +1128,7 @@ void UpdateStageSystem(Game* game) {
     
     // Check if we need to spawn enemies
     if (ShouldSpawnEnemy(&game->currentStage, game->stageTimer) && 
-        game->enemyCount < game->currentStage.maxEnemiesAlive) {
+        game->enemies.count < game->currentStage.maxEnemiesAlive) {
         SpawnEnemyFromStage(game);
     }
     
@@ -1119,7 +1136,7 @@ void UpdateStageSystem(Game* game) {
     // static float lastDebugPrint = 0;
     // if (game->stageTimer - lastDebugPrint > 2.0f) {
     //     printf("DEBUG: Stage %d, Timer: %.1f, Enemies: %d, State: %d, Wave: %d\n", 
-    //            game->currentStageNumber, game->stageTimer, game->enemyCount, 
+    //            game->currentStageNumber, game->stageTimer, game->enemies.count, 
     //            game->currentStage.state, game->currentStage.currentWave);
     //     lastDebugPrint = game->stageTimer;
     // }
@@ -1135,7 +1152,8 @@ void SpawnEnemyFromStage(Game* game) {
     
     
     // Create enemy with stage modifiers
-    Enemy newEnemy = InitEnemyByType(type, game->screenWidth, game->screenHeight, game->player.position);
+    EnemyMotion motion;
+    Enemy newEnemy = InitEnemyByType(type, game->screenWidth, game->screenHeight, game->player.position, &motion);
     newEnemy.position = spawnPos;
     
     // Apply stage modifiers
@@ -1146,26 +1164,24 @@ void SpawnEnemyFromStage(Game* game) {
     newEnemy.radius *= game->currentStage.enemySizeMultiplier;
     
     // Add to game
-    game->enemies[game->enemyCount] = newEnemy;
+    EnemyHandle handle = EnemyStore_Add(&game->enemies, &newEnemy, &motion);
+    if (EnemyHandle_IsNull(handle)) return;
     game->currentStage.totalEnemiesSpawned++;
     
     // Publish enemy spawned event
-    EnemyEventData* data = MemoryPool_Alloc(&g_enemyEventPool);
-    if (data) {
-        data->enemyIndex = game->enemyCount;
-        data->enemyPtr = &game->enemies[game->enemyCount];
-        PublishEvent(EVENT_ENEMY_SPAWNED, data);
-    }
+    EnemyEventData data = {0};
+    data.enemy = handle;
+    PublishEvent(EVENT_ENEMY_SPAWNED, &data, sizeof(data));
     
-    game->enemyCount++;
-    game->lastEnemySpawnTime = GetTime();
+    game->lastEnemySpawnTime = Replay_GetTime();
 }
 
 // Spawn enemy by type (used for splitting enemies)
 void SpawnEnemyByType(Game* game, EnemyType type) {
-    if (game->enemyCount >= MAX_ENEMIES) return;
+    if (EnemyStore_IsFull(&game->enemies)) return;
     
-    Enemy newEnemy = InitEnemyByType(type, game->screenWidth, game->screenHeight, game->player.position);
+    EnemyMotion motion;
+    Enemy newEnemy = InitEnemyByType(type, game->screenWidth, game->screenHeight, game->player.position, &motion);
     
     // Apply stage modifiers if in a stage
     if (game->gameState == GAME_STATE_PLAYING) {
@@ -1175,17 +1191,18 @@ void SpawnEnemyByType(Game* game, EnemyType type) {
         newEnemy.velocity.y *= game->currentStage.enemySpeedMultiplier;
     }
     
-    game->enemies[game->enemyCount++] = newEnemy;
+    EnemyStore_Add(&game->enemies, &newEnemy, &motion);
 }
 
 // Handle enemy splitting
 void HandleEnemySplit(Game* game, Enemy* originalEnemy) {
     if (!ShouldEnemySplit(originalEnemy)) return;
-    if (game->enemyCount + 2 > MAX_ENEMIES) return;
+    if (game->enemies.count + 2 > game->enemies.capacity) return;
     
     // Create two smaller enemies
     for (int i = 0; i < 2; i++) {
-        Enemy splitEnemy = InitEnemyByType(ENEMY_TYPE_SPLITTER, game->screenWidth, game->screenHeight, game->player.position);
+        EnemyMotion motion;
+        Enemy splitEnemy = InitEnemyByType(ENEMY_TYPE_SPLITTER, game->screenWidth, game->screenHeight, game->player.position, &motion);
         
         // Position near original
         splitEnemy.position.x = originalEnemy->position.x + GetRandomValue(-30, 30);
@@ -1201,17 +1218,14 @@ void HandleEnemySplit(Game* game, Enemy* originalEnemy) {
         splitEnemy.velocity.x = GetRandomValue(-100, 100) / 50.0f;
         splitEnemy.velocity.y = GetRandomValue(-100, 100) / 50.0f;
         
-        game->enemies[game->enemyCount++] = splitEnemy;
+        EnemyHandle handle = EnemyStore_Add(&game->enemies, &splitEnemy, &motion);
         
         // Publish split event
-        SpecialAbilityEventData* data = MemoryPool_Alloc(&g_specialAbilityEventPool);
-        if (data) {
-            data->enemyIndex = game->enemyCount - 1;
-            data->enemyPtr = &game->enemies[game->enemyCount - 1];
-            data->abilityType = 1; // Split
-            data->position = splitEnemy.position;
-            PublishEvent(EVENT_ENEMY_SPLIT, data);
-        }
+        SpecialAbilityEventData data = {0};
+        data.enemy = handle;
+        data.abilityType = 1; // Split
+        data.position = splitEnemy.position;
+        PublishEvent(EVENT_ENEMY_SPLIT, &data, sizeof(data));
     }
 }
 
@@ -1220,30 +1234,58 @@ void HandleClusterExplosion(Game* game, Enemy* clusterEnemy) {
     if (clusterEnemy->type != ENEMY_TYPE_CLUSTER) return;
     
     // Check for nearby enemies to trigger chain reaction
-    for (int i = 0; i < game->enemyCount; i++) {
-        float distance = Vector2Distance(game->enemies[i].position, clusterEnemy->position);
+    for (int i = 0; i < game->enemies.count; i++) {
+        float distance = Vector2Distance(game->enemies.items[i].position, clusterEnemy->position);
         
         if (distance < CLUSTER_EXPLOSION_RADIUS && distance > 0) {
             // Damage nearby enemies
             float damage = (1.0f - distance / CLUSTER_EXPLOSION_RADIUS) * 50.0f;
-            DamageEnemy(&game->enemies[i], damage);
+            float oldHealth = game->enemies.items[i].health;
+            DamageEnemy(&game->enemies.items[i], damage);
+            RecordEnemyDamage(game, i, 0, damage, oldHealth);
             
             // Push them away
-            Vector2 pushDir = Vector2Subtract(game->enemies[i].position, clusterEnemy->position);
+            Vector2 pushDir = Vector2Subtract(game->enemies.items[i].position, clusterEnemy->position);
             pushDir = Vector2Normalize(pushDir);
-            game->enemies[i].velocity.x += pushDir.x * 5.0f;
-            game->enemies[i].velocity.y += pushDir.y * 5.0f;
+            game->enemies.items[i].velocity.x += pushDir.x * 5.0f;
+            game->enemies.items[i].velocity.y += pushDir.y * 5.0f;
         }
     }
     
+    // Blast nearby particles outward over a few frames
+    QueueRadialImpulse((RadialImpulse){
+        .center = clusterEnemy->position,
+        .radius = CLUSTER_EXPLOSION_RADIUS,
+        .minDistance = 1.0f,
+        .strength = CLUSTER_PARTICLE_IMPULSE,
+        .probability = 1.0f,
+        .duration = CLUSTER_IMPULSE_DURATION
+    });
+
     // Create explosion effect
-    ParticleEffectEventData* effectData = MemoryPool_Alloc(&g_particleEffectEventPool);
-    if (effectData) {
-        effectData->position = clusterEnemy->position;
-        effectData->effectType = 0; // Explosion
-        effectData->radius = CLUSTER_EXPLOSION_RADIUS;
-        effectData->color = MAGENTA;
-        PublishEvent(EVENT_PARTICLE_EFFECT, effectData);
+    ParticleEffectEventData effectData = {0};
+    effectData.position = clusterEnemy->position;
+    effectData.effectType = 0; // Explosion
+    effectData.radius = CLUSTER_EXPLOSION_RADIUS;
+    effectData.color = MAGENTA;
+    PublishEvent(EVENT_PARTICLE_EFFECT, &effectData, sizeof(effectData));
+}
+
+void RemoveEnemyAt(Game* game, int index) {
+    if (index < 0 || index >= game->enemies.count) return;
+
+    // 죽은 적의 중력원이 남지 않도록 함께 해제
+    Enemy* enemy = &game->enemies.items[index];
+    if (enemy->gravitySourceId != 0) {
+        UnregisterGravitySource(enemy->gravitySourceId);
+        enemy->gravitySourceId = 0;
+    }
+    EnemyStore_RemoveAt(&game->enemies, index);
+}
+
+void ClearEnemies(Game* game) {
+    while (game->enemies.count > 0) {
+        RemoveEnemyAt(game, game->enemies.count - 1);
     }
 }
 
@@ -1259,14 +1301,12 @@ void CheckStageCompletion(Game* game) {
         game->gameState = GAME_STATE_STAGE_COMPLETE;
         
         // Publish stage complete event
-        StageChangeEventData* data = MemoryPool_Alloc(&g_stageChangeEventPool);
-        if (data) {
-            data->oldStageNumber = game->currentStageNumber;
-            data->newStageNumber = game->currentStageNumber + 1;
-            data->enemiesKilled = game->enemiesKilledThisStage;
-            data->score = game->score;
-            PublishEvent(EVENT_STAGE_COMPLETED, data);
-        }
+        StageChangeEventData data = {0};
+        data.oldStageNumber = game->currentStageNumber;
+        data.newStageNumber = game->currentStageNumber + 1;
+        data.enemiesKilled = game->enemiesKilledThisStage;
+        data.score = game->score;
+        PublishEvent(EVENT_STAGE_COMPLETED, &data, sizeof(data));
         
         // Bonus score for stage completion
         game->score += 500 * game->currentStageNumber;
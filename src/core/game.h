@@ -3,7 +3,9 @@
 
 #include "../entities/player.h"
 #include "../entities/particle.h"
+#include "../entities/particle_buffer.h"
 #include "../entities/enemy.h"
+#include "../entities/enemy_store.h"
 #include "../entities/explosion.h"
 #include "../entities/managers/enemy_manager.h"
 #include "../entities/managers/particle_manager.h"
@@ -11,13 +13,22 @@
 #include "../entities/managers/item_manager.h"
 #include "event/event_system.h"
 #include "dev_test_mode.h"
+#include "spatial_grid.h"
+#include "gravity_field.h"
+#include "particle_pipeline.h"
+#include "fixed_step.h"
+#include "particle_raster.h"
 
 // Global screen dimensions
 extern int g_screenWidth;
 extern int g_screenHeight;
 
 // Constants
-#define PARTICLE_COUNT 100000  // Maximum number of particles
+#define DEFAULT_PARTICLE_COUNT 100000  // Particle count when --particles is not given
+#define MIN_PARTICLE_COUNT 1000        // Smallest accepted --particles value
+#define MAX_PARTICLE_COUNT 8000000     // Largest accepted --particles value (128 MB of particle data)
+#define DEFAULT_ENEMY_CAPACITY 50      // Enemy store size when --max-enemies is not given
+#define MAX_ENEMY_CAPACITY 65536       // Largest accepted --max-enemies value
 #define DEFAULT_ATTRACTION_FORCE 1.0f  // Default force for particle attraction
 #define BOOSTED_ATTRACTION_FORCE 5.0f  // Boosted force when space key is pressed
 #define MAX_NAME_LENGTH 16
@@ -48,9 +59,9 @@ typedef struct Game {
     
     // Game properties
     int moveSpeed;
-    float deltaTime;
+    float deltaTime;          // Frame time, or the fixed step length while the simulation runs
+    FixedStep clock;          // Fixed simulation rate; clock.alpha blends rendering between steps
     float lastEnemySpawnTime;  // Time when last enemy was spawned
-    int enemyCount;           // Current number of enemies
     int score;                // Player score
     GameState gameState;      // Current game state
     
@@ -62,8 +73,14 @@ typedef struct Game {
     
     // Game entities
     Player player;
-    Particle* particles;  // Dynamic array of particles
-    Enemy* enemies;  // Dynamic array of enemies
+    ParticleBuffer particles;  // SoA particle storage
+    SpatialGrid particleGrid;  // Particle positions bucketed by cell (exact-mode gravity and impulse culling)
+    GravityField gravityField;  // Baked gravity sampled by particles in GRAVITY_MODE_FIELD
+    ParticlePipeline particlePipeline;  // Fused per-frame force/integrate/contact pass
+    float* particlePreviousX;  // Particle positions before the last step (render interpolation)
+    float* particlePreviousY;
+    ParticleRaster particleRaster;  // CPU framebuffer the particles are drawn into
+    EnemyStore enemies;  // Live enemies (dense, swap-remove) addressed by EnemyHandle
     ExplosionParticle explosionParticles[MAX_EXPLOSION_PARTICLES];
     int explosionParticleCount;
     
@@ -88,7 +105,7 @@ typedef struct Game {
 } Game;
 
 // Game initialization and cleanup
-Game InitGame(int screenWidth, int screenHeight);
+Game InitGame(int screenWidth, int screenHeight, int particleCount, int enemyCapacity);
 void CleanupGame(Game* game);
 
 // Game loop functions
@@ -110,13 +127,20 @@ void SpawnEnemyByType(Game* game, EnemyType type);
 void SpawnEnemyFromStage(Game* game);
 void HandleEnemySplit(Game* game, Enemy* originalEnemy);
 void HandleClusterExplosion(Game* game, Enemy* clusterEnemy);
+// Remove game->enemies.items[index] and its gravity source (the last enemy moves into index)
+void RemoveEnemyAt(Game* game, int index);
+// Remove every enemy and its gravity source
+void ClearEnemies(Game* game);
 
 // Managers and physics functions
 void SpawnEnemyIfNeeded(Game* game);
 void UpdateAllEnemies(Game* game);
+// AI, movement and base update of every enemy, one type group at a time
+void UpdateEnemiesByType(Game* game);
 void UpdateAllParticles(Game* game, bool isSpacePressed);
 void UpdateAllExplosionParticles(Game* game);
-bool CheckCollisionEnemyParticle(Enemy enemy, Particle particle);
+bool CheckCollisionEnemyParticle(const Enemy* enemy, Vector2 particlePosition);
+void SetEnemyContactTargets(Game* game);
 void ProcessEnemyCollisions(Game* game);
 
 // 이벤트 핸들러 등록 함수
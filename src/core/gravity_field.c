@@ -0,0 +1,104 @@
+#include "gravity_field.h"
+#include "thread_pool.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Minimum node rows per thread when baking
+#define GRAVITY_FIELD_MIN_ROWS_PER_THREAD 8
+
+bool GravityField_Init(GravityField* field, int screenWidth, int screenHeight, float cellSize) {
+    memset(field, 0, sizeof(GravityField));
+    if (cellSize <= 0.0f) return false;
+
+    field->cellSize = cellSize;
+    field->invCellSize = 1.0f / cellSize;
+    // 화면 끝까지 덮도록 올림 + 1 (보간에 최소 2x2 노드 필요)
+    field->cols = (int)ceilf(screenWidth / cellSize) + 1;
+    field->rows = (int)ceilf(screenHeight / cellSize) + 1;
+    if (field->cols < 2) field->cols = 2;
+    if (field->rows < 2) field->rows = 2;
+
+    field->force = (Vector2*)calloc((size_t)field->cols * field->rows, sizeof(Vector2));
+    if (!field->force) {
+        GravityField_Destroy(field);
+        return false;
+    }
+    return true;
+}
+
+void GravityField_Destroy(GravityField* field) {
+    free(field->force);
+    memset(field, 0, sizeof(GravityField));
+}
+
+// Active sources of one bake with the node rectangle each radius covers
+typedef struct GravityFieldBake {
+    GravityField* field;
+    int sourceCount;
+    GravitySource sources[MAX_GRAVITY_SOURCES];
+    int rowBegin[MAX_GRAVITY_SOURCES];
+    int rowEnd[MAX_GRAVITY_SOURCES];
+    int colBegin[MAX_GRAVITY_SOURCES];
+    int colEnd[MAX_GRAVITY_SOURCES];
+} GravityFieldBake;
+
+static int ClampNode(int node, int count) {
+    if (node < 0) return 0;
+    if (node >= count) return count - 1;
+    return node;
+}
+
+// 노드 행 단위로 처리: 한 행은 한 스레드만 쓰고 중력원은 슬롯 순서로 더함
+static void BakeRows(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    GravityFieldBake* bake = (GravityFieldBake*)userData;
+    GravityField* field = bake->field;
+
+    for (int row = begin; row < end; row++) {
+        Vector2* nodes = &field->force[row * field->cols];
+        memset(nodes, 0, field->cols * sizeof(Vector2));
+        float y = row * field->cellSize;
+
+        for (int s = 0; s < bake->sourceCount; s++) {
+            if (row < bake->rowBegin[s] || row > bake->rowEnd[s]) continue;
+
+            const GravitySource source = bake->sources[s];
+            for (int col = bake->colBegin[s]; col <= bake->colEnd[s]; col++) {
+                Vector2 position = { col * field->cellSize, y };
+                if (!IsInGravityRange(position, source)) continue;
+
+                Vector2 force = CalculateGravityForce(position, source);
+                nodes[col].x += force.x;
+                nodes[col].y += force.y;
+            }
+        }
+    }
+}
+
+void GravityField_Bake(GravityField* field, const GravitySource* sources, int count) {
+    static GravityFieldBake bake;
+    bake.field = field;
+    bake.sourceCount = 0;
+
+    for (int i = 0; i < count && bake.sourceCount < MAX_GRAVITY_SOURCES; i++) {
+        const GravitySource* source = &sources[i];
+        if (!source->active || source->radius <= 0.0f) continue;
+
+        int s = bake.sourceCount++;
+        bake.sources[s] = *source;
+        bake.rowBegin[s] = ClampNode((int)ceilf((source->position.y - source->radius) * field->invCellSize), field->rows);
+        bake.rowEnd[s] = ClampNode((int)floorf((source->position.y + source->radius) * field->invCellSize), field->rows);
+        bake.colBegin[s] = ClampNode((int)ceilf((source->position.x - source->radius) * field->invCellSize), field->cols);
+        bake.colEnd[s] = ClampNode((int)floorf((source->position.x + source->radius) * field->invCellSize), field->cols);
+    }
+
+    ThreadPool_ParallelFor(field->rows, GRAVITY_FIELD_MIN_ROWS_PER_THREAD, BakeRows, &bake);
+    field->baked = true;
+}
+
+void GravityField_Apply(const GravityField* field, ParticleBuffer* particles, int begin, int end, float scale) {
+    for (int p = begin; p < end; p++) {
+        Vector2 force = GravityField_Sample(field, particles->x[p], particles->y[p]);
+        ParticleBuffer_AddVelocity(particles, p, force.x * scale, force.y * scale);
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef GRAVITY_FIELD_H
+#define GRAVITY_FIELD_H
+
+#include "raylib.h"
+#include "gravity_system.h"
+#include "../entities/particle_buffer.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Node spacing in pixels (half a spatial grid cell)
+#define GRAVITY_FIELD_CELL_SIZE 8.0f
+
+/**
+ * @brief Gravity baked onto a coarse vector grid
+ *
+ * Every active source is summed into the grid nodes its radius covers, and
+ * particles read the force back with bilinear interpolation, so the cost per
+ * particle is four node reads no matter how many sources overlap. Nodes sit
+ * on cell corners (node (c, r) is at c * cellSize, r * cellSize); positions
+ * outside the screen sample the nearest edge.
+ */
+typedef struct GravityField {
+    float cellSize;
+    float invCellSize;
+    int cols;           // Nodes per row (screenWidth / cellSize + 1)
+    int rows;
+    Vector2* force;     // cols * rows summed forces, row-major
+    uint32_t bakedVersion;  // Source version the nodes were baked from
+    bool baked;         // False until the first bake
+} GravityField;
+
+// 노드 배열 할당 (화면 크기 기준)
+bool GravityField_Init(GravityField* field, int screenWidth, int screenHeight, float cellSize);
+// 노드 배열 해제
+void GravityField_Destroy(GravityField* field);
+
+// Re-bake every node from the given sources (rows split across threads; inactive sources are skipped)
+void GravityField_Bake(GravityField* field, const GravitySource* sources, int count);
+
+// Add the sampled force times `scale` (FixedStep_Scale of the step) to the velocity of particles [begin, end)
+void GravityField_Apply(const GravityField* field, ParticleBuffer* particles, int begin, int end, float scale);
+
+// Bilinearly interpolated force at a position
+static inline Vector2 GravityField_Sample(const GravityField* field, float x, float y) {
+    float gx = x * field->invCellSize;
+    float gy = y * field->invCellSize;
+    if (gx < 0.0f) gx = 0.0f;
+    if (gy < 0.0f) gy = 0.0f;
+    if (gx > (float)(field->cols - 1)) gx = (float)(field->cols - 1);
+    if (gy > (float)(field->rows - 1)) gy = (float)(field->rows - 1);
+
+    int col = (int)gx;
+    int row = (int)gy;
+    if (col > field->cols - 2) col = field->cols - 2;
+    if (row > field->rows - 2) row = field->rows - 2;
+    float tx = gx - (float)col;
+    float ty = gy - (float)row;
+
+    const Vector2* top = &field->force[row * field->cols + col];
+    const Vector2* bottom = top + field->cols;
+    float fx0 = top[0].x + (top[1].x - top[0].x) * tx;
+    float fy0 = top[0].y + (top[1].y - top[0].y) * tx;
+    float fx1 = bottom[0].x + (bottom[1].x - bottom[0].x) * tx;
+    float fy1 = bottom[0].y + (bottom[1].y - bottom[0].y) * tx;
+    return (Vector2){ fx0 + (fx1 - fx0) * ty, fy0 + (fy1 - fy0) * ty };
+}
+
+#endif // GRAVITY_FIELD_H
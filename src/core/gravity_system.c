@@ -2,23 +2,41 @@
 #include "game.h"
 #include "../entities/particle.h"
 #include "../entities/enemy.h"
+#include "gravity_field.h"
+#include "thread_pool.h"
+#include "rng.h"
+#include "fixed_step.h"
+#include "../render/render.h"
 #include <string.h>
 #include <stdio.h>
 
-// Particle count (defined in game.h)
-#ifndef PARTICLE_COUNT
-#define PARTICLE_COUNT 100000
-#endif
-
 // Internal state
 static GravitySource g_gravitySources[MAX_GRAVITY_SOURCES];
 static int g_nextSourceId = 1; // Start at 1 (0 = invalid)
 static int g_activeSourceCount = 0;
+static GravityMode g_gravityMode = GRAVITY_MODE_EXACT;
+static uint32_t g_sourceVersion = 1; // Bumped on every source change (baked fields compare against it)
+
+// Queued radial impulses (applied by the next grid pass, kept while time remains)
+typedef struct QueuedImpulse {
+    RadialImpulse impulse;
+    float remaining;
+} QueuedImpulse;
+
+static QueuedImpulse g_impulses[MAX_RADIAL_IMPULSES];
+static int g_impulseCount = 0;
+static uint64_t g_impulsePassCount = 0; // Grid passes so far, keys the per-particle chance draws
+
+// Top bit keeps impulse RNG counters apart from ParticlePipeline radial force counters
+#define GRAVITY_IMPULSE_COUNTER_BASE (1ull << 63)
 
 void InitGravitySystem(void) {
     memset(g_gravitySources, 0, sizeof(g_gravitySources));
     g_nextSourceId = 1;
     g_activeSourceCount = 0;
+    g_sourceVersion++;
+    g_impulseCount = 0;
+    g_impulsePassCount = 0;
 }
 
 void CleanupGravitySystem(void) {
@@ -33,6 +51,7 @@ int RegisterGravitySource(GravitySource source) {
             source.sourceId = g_nextSourceId++;
             g_gravitySources[i] = source;
             g_activeSourceCount++;
+            g_sourceVersion++;
             return source.sourceId;
         }
     }
@@ -47,6 +66,7 @@ void UnregisterGravitySource(int sourceId) {
         if (g_gravitySources[i].sourceId == sourceId) {
             memset(&g_gravitySources[i], 0, sizeof(GravitySource));
             g_activeSourceCount--;
+            g_sourceVersion++;
             return;
         }
     }
@@ -55,7 +75,11 @@ void UnregisterGravitySource(int sourceId) {
 void UpdateGravitySource(int sourceId, Vector2 newPosition) {
     for (int i = 0; i < MAX_GRAVITY_SOURCES; i++) {
         if (g_gravitySources[i].sourceId == sourceId) {
-            g_gravitySources[i].position = newPosition;
+            if (g_gravitySources[i].position.x != newPosition.x ||
+                g_gravitySources[i].position.y != newPosition.y) {
+                g_gravitySources[i].position = newPosition;
+                g_sourceVersion++;
+            }
             return;
         }
     }
@@ -64,23 +88,263 @@ void UpdateGravitySource(int sourceId, Vector2 newPosition) {
 void SetGravitySourceActive(int sourceId, bool active) {
     for (int i = 0; i < MAX_GRAVITY_SOURCES; i++) {
         if (g_gravitySources[i].sourceId == sourceId) {
-            g_gravitySources[i].active = active;
+            if (g_gravitySources[i].active != active) {
+                g_gravitySources[i].active = active;
+                g_sourceVersion++;
+            }
             return;
         }
     }
 }
 
+void SetGravityMode(GravityMode mode) {
+    g_gravityMode = mode;
+}
+
+GravityMode GetGravityMode(void) {
+    return g_gravityMode;
+}
+
+void RefreshGravityField(GravityField* field) {
+    // 중력원이 그대로면 이전 베이크 재사용 (움직이는 중력원이 있으면 매 프레임 다시 구움)
+    if (field->baked && field->bakedVersion == g_sourceVersion) return;
+
+    // 빈 슬롯은 active == false 이므로 베이크에서 건너뜀
+    GravityField_Bake(field, g_gravitySources, MAX_GRAVITY_SOURCES);
+    field->bakedVersion = g_sourceVersion;
+}
+
+// 중력장 샘플링 연산자 인자 (ParticlePipeline_Run 까지 유효해야 하므로 정적)
+typedef struct GravityFieldSample {
+    const GravityField* field;
+    float scale;
+} GravityFieldSample;
+
+// 구워진 노드는 파이프라인 실행 동안 읽기 전용이므로 스레드 분할 가능
+static void SampleGravityField(ParticleBuffer* particles, int begin, int end, const void* params) {
+    const GravityFieldSample* sample = (const GravityFieldSample*)params;
+    GravityField_Apply(sample->field, particles, begin, end, sample->scale);
+}
+
+// Minimum grid rows per thread (one row is a full-width strip of cells)
+#define GRAVITY_MIN_ROWS_PER_THREAD 4
+
+// One source or impulse of a grid pass with the cell rectangle its radius covers
+typedef struct GravityGridEntry {
+    int rowBegin;
+    int rowEnd;
+    int colBegin;
+    int colEnd;
+    bool isImpulse;
+    GravitySource source;       // When !isImpulse
+    RadialImpulse impulse;      // When isImpulse
+    uint64_t counter;           // RNG counter for the impulse's per-particle chance
+} GravityGridEntry;
+
+typedef struct GravityGridPass {
+    ParticleBuffer* particles;
+    const SpatialGrid* grid;
+    float scale;                // Step length relative to the reference step
+    int entryCount;
+    GravityGridEntry entries[MAX_GRAVITY_SOURCES + MAX_RADIAL_IMPULSES];
+} GravityGridPass;
+
+// 위쪽 행 순으로 삽입 정렬 (같은 행이면 추가 순서 유지 → 스레드 수와 무관한 합산 순서)
+static void AddGridEntry(GravityGridPass* pass, GravityGridEntry entry, Vector2 center, float radius) {
+    const SpatialGrid* grid = pass->grid;
+    entry.rowBegin = SpatialGrid_Row(grid, center.y - radius);
+    entry.rowEnd = SpatialGrid_Row(grid, center.y + radius);
+    entry.colBegin = SpatialGrid_Col(grid, center.x - radius);
+    entry.colEnd = SpatialGrid_Col(grid, center.x + radius);
+
+    int e = pass->entryCount++;
+    while (e > 0 && pass->entries[e - 1].rowBegin > entry.rowBegin) {
+        pass->entries[e] = pass->entries[e - 1];
+        e--;
+    }
+    pass->entries[e] = entry;
+}
+
+// 방사형 임펄스: 거리 제곱으로 먼저 거르고 범위 안에서만 sqrt (중심에서 반경까지 선형 감쇠)
+static inline void ApplyImpulseToParticle(ParticleBuffer* particles, int p, const RadialImpulse* impulse,
+                                          uint64_t counter, float scale) {
+    float dx = particles->x[p] - impulse->center.x;
+    float dy = particles->y[p] - impulse->center.y;
+    float distSq = dx*dx + dy*dy;
+    if (distSq >= impulse->radius * impulse->radius) return;
+    if (distSq <= impulse->minDistance * impulse->minDistance) return;
+    // 파티클 인덱스를 레인으로 쓰는 카운터 기반 난수라 스레드 분할과 무관
+    if (impulse->probability < 1.0f &&
+        Rng_UniformAt(RNG_STREAM_PARTICLE_FORCE, (uint32_t)p, counter) >= impulse->probability) return;
+
+    float dist = sqrtf(distSq);
+    float push = (1.0f - dist / impulse->radius) * impulse->strength * scale / dist;
+    ParticleBuffer_AddVelocity(particles, p, dx * push, dy * push);
+}
+
+// 행 단위로 처리: 한 행의 파티클은 한 스레드만 만지므로 경쟁 없음
+static void ApplyGravityRows(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    GravityGridPass* pass = (GravityGridPass*)userData;
+    const SpatialGrid* grid = pass->grid;
+
+    for (int row = begin; row < end; row++) {
+        for (int e = 0; e < pass->entryCount; e++) {
+            const GravityGridEntry* entry = &pass->entries[e];
+            // 위쪽 행 기준으로 정렬되어 있으므로 이후 항목은 이 행에 닿지 않음
+            if (entry->rowBegin > row) break;
+            if (entry->rowEnd < row) continue;
+
+            int spanBegin, spanEnd;
+            SpatialGrid_RowSpan(grid, row, entry->colBegin, entry->colEnd, &spanBegin, &spanEnd);
+            if (entry->isImpulse) {
+                float scale = entry->impulse.instant ? 1.0f : pass->scale;
+                for (int k = spanBegin; k < spanEnd; k++) {
+                    ApplyImpulseToParticle(pass->particles, grid->sorted[k], &entry->impulse, entry->counter, scale);
+                }
+                continue;
+            }
+
+            const GravitySource source = entry->source;
+            for (int k = spanBegin; k < spanEnd; k++) {
+                int p = grid->sorted[k];
+                Vector2 position = ParticleBuffer_GetPosition(pass->particles, p);
+                if (!IsInGravityRange(position, source)) continue;
+
+                Vector2 force = CalculateGravityForce(position, source);
+                ParticleBuffer_AddVelocity(pass->particles, p, force.x * pass->scale, force.y * pass->scale);
+            }
+        }
+    }
+}
+
+// Sources (when includeSources) and queued impulses over the cells they cover
+static void RunGridPass(ParticleBuffer* particles, const SpatialGrid* grid, bool includeSources, float scale) {
+    // 그리드 할당에 실패했으면 셀 범위를 알 수 없음 (InitGame 이 이미 알림)
+    if (!grid->built) return;
+
+    static GravityGridPass pass;
+    pass.particles = particles;
+    pass.grid = grid;
+    pass.scale = scale;
+    pass.entryCount = 0;
+
+    if (includeSources) {
+        for (int i = 0; i < MAX_GRAVITY_SOURCES; i++) {
+            const GravitySource* source = &g_gravitySources[i];
+            if (source->sourceId == 0 || !source->active || source->radius <= 0.0f) continue;
+
+            GravityGridEntry entry = { .isImpulse = false, .source = *source };
+            AddGridEntry(&pass, entry, source->position, source->radius);
+        }
+    }
+    for (int i = 0; i < g_impulseCount; i++) {
+        const RadialImpulse* impulse = &g_impulses[i].impulse;
+        if (impulse->radius <= 0.0f) continue;
+
+        GravityGridEntry entry = {
+            .isImpulse = true,
+            .impulse = *impulse,
+            .counter = GRAVITY_IMPULSE_COUNTER_BASE + g_impulsePassCount * MAX_RADIAL_IMPULSES + (uint64_t)i
+        };
+        AddGridEntry(&pass, entry, impulse->center, impulse->radius);
+    }
+    g_impulsePassCount++;
+    if (pass.entryCount == 0) return;
+
+    // 마지막으로 닿는 행까지만 분할 (그 위쪽 행은 첫 비교에서 바로 끝남)
+    int lastRow = 0;
+    for (int e = 0; e < pass.entryCount; e++) {
+        if (pass.entries[e].rowEnd > lastRow) lastRow = pass.entries[e].rowEnd;
+    }
+    ThreadPool_ParallelFor(lastRow + 1, GRAVITY_MIN_ROWS_PER_THREAD, ApplyGravityRows, &pass);
+}
+
+// 적용이 끝난 임펄스의 남은 시간 차감, 만료된 것은 순서를 유지하며 제거
+static void ExpireRadialImpulses(float deltaTime) {
+    int kept = 0;
+    for (int i = 0; i < g_impulseCount; i++) {
+        g_impulses[i].remaining -= deltaTime;
+        if (g_impulses[i].remaining > 0.0f) {
+            g_impulses[kept++] = g_impulses[i];
+        }
+    }
+    g_impulseCount = kept;
+}
+
 void ApplyAllGravitySources(void* gamePtr, float deltaTime) {
     Game* game = (Game*)gamePtr;
 
-    // Early exit if no gravity sources
+    // Early exit if nothing pulls or pushes this frame
+    if (g_activeSourceCount == 0 && g_impulseCount == 0) return;
+
+    if (g_gravityMode == GRAVITY_MODE_FIELD) {
+        // 바뀐 중력원이 있으면 다시 굽고, 샘플링은 파티클 파이프라인의 힘 연산자로 실행
+        if (g_activeSourceCount > 0) {
+            static GravityFieldSample sample;
+            sample.field = &game->gravityField;
+            sample.scale = FixedStep_Scale(deltaTime);
+            RefreshGravityField(&game->gravityField);
+            ParticlePipeline_AddForce(&game->particlePipeline, SampleGravityField, &sample, true);
+        }
+        ApplyQueuedRadialImpulses(game, deltaTime);
+        return;
+    }
+
+    SpatialGrid_Update(&game->particleGrid, &game->particles);
+    RunGridPass(&game->particles, &game->particleGrid, true, FixedStep_Scale(deltaTime));
+    ExpireRadialImpulses(deltaTime);
+
+    // TODO Phase 4: Apply gravity to enemies
+    // TODO Phase 5: Apply gravity to player
+    // TODO Phase 5: Apply gravity to items
+}
+
+void ApplyQueuedRadialImpulses(void* gamePtr, float deltaTime) {
+    Game* game = (Game*)gamePtr;
+    if (g_impulseCount == 0) return;
+
+    SpatialGrid_Update(&game->particleGrid, &game->particles);
+    RunGridPass(&game->particles, &game->particleGrid, false, FixedStep_Scale(deltaTime));
+    ExpireRadialImpulses(deltaTime);
+}
+
+bool QueueRadialImpulse(RadialImpulse impulse) {
+    if (g_impulseCount >= MAX_RADIAL_IMPULSES) {
+        fprintf(stderr, "WARNING: Max radial impulses (%d) reached!\n", MAX_RADIAL_IMPULSES);
+        return false;
+    }
+    g_impulses[g_impulseCount].impulse = impulse;
+    g_impulses[g_impulseCount].remaining = impulse.duration;
+    g_impulseCount++;
+    return true;
+}
+
+bool ApplyRadialImpulse(Vector2 center, float radius, float strength) {
+    RadialImpulse impulse = {
+        .center = center,
+        .radius = radius,
+        .minDistance = 1.0f,
+        .strength = strength,
+        .probability = 1.0f,
+        .duration = 0.0f,
+        .instant = true
+    };
+    return QueueRadialImpulse(impulse);
+}
+
+int GetQueuedRadialImpulseCount(void) {
+    return g_impulseCount;
+}
+
+void ApplyGravityToParticles(ParticleBuffer* particles, int begin, int end) {
     if (g_activeSourceCount == 0) return;
 
-    // Apply gravity to all particles
-    for (int p = 0; p < PARTICLE_COUNT; p++) {
+    for (int p = begin; p < end; p++) {
         // Skip if particle shouldn't be affected (future feature)
         // if (!game->particles[p].affectedByGravity) continue;
 
+        Vector2 position = ParticleBuffer_GetPosition(particles, p);
         Vector2 totalForce = {0, 0};
 
         // Accumulate forces from all active sources
@@ -89,24 +353,19 @@ void ApplyAllGravitySources(void* gamePtr, float deltaTime) {
             if (!g_gravitySources[s].active) continue;
 
             // Quick range check
-            if (!IsInGravityRange(game->particles[p].position, g_gravitySources[s])) {
+            if (!IsInGravityRange(position, g_gravitySources[s])) {
                 continue;
             }
 
             // Calculate and accumulate force
-            Vector2 force = CalculateGravityForce(game->particles[p].position, g_gravitySources[s]);
+            Vector2 force = CalculateGravityForce(position, g_gravitySources[s]);
             totalForce.x += force.x;
             totalForce.y += force.y;
         }
 
         // Apply accumulated force to velocity
-        game->particles[p].velocity.x += totalForce.x;
-        game->particles[p].velocity.y += totalForce.y;
+        ParticleBuffer_AddVelocity(particles, p, totalForce.x, totalForce.y);
     }
-
-    // TODO Phase 4: Apply gravity to enemies
-    // TODO Phase 5: Apply gravity to player
-    // TODO Phase 5: Apply gravity to items
 }
 
 void DrawGravityFields(bool showLabels) {
@@ -125,13 +384,13 @@ void DrawGravityFields(bool showLabels) {
         }
 
         // Draw influence radius
-        DrawCircleLines((int)src->position.x, (int)src->position.y, src->radius, fieldColor);
-        DrawCircleV(src->position, 5.0f, fieldColor);
+        Render_DrawCircleLines((int)src->position.x, (int)src->position.y, src->radius, fieldColor);
+        Render_DrawCircleV(src->position, 5.0f, fieldColor);
 
         // Draw label if requested
         if (showLabels) {
             const char* typeStr = (src->type & GRAVITY_TYPE_ATTRACTION) ? "ATT" : "REP";
-            DrawText(TextFormat("%s %.0f", typeStr, src->strength),
+            Render_DrawText(TextFormat("%s %.0f", typeStr, src->strength),
                     (int)src->position.x + 10, (int)src->position.y - 10, 12, WHITE);
         }
     }
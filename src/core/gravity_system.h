@@ -2,6 +2,9 @@
 #define GRAVITY_SYSTEM_H
 
 #include "raylib.h"
+#include "../entities/particle_buffer.h"
+#include "spatial_grid.h"
+#include "../entities/enemy_handle.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <math.h>
@@ -18,6 +21,12 @@ typedef enum {
     GRAVITY_TYPE_DIRECTIONAL= 1 << 3,  // Future: Wind, conveyor belts
 } GravityType;
 
+// How ApplyAllGravitySources evaluates sources
+typedef enum {
+    GRAVITY_MODE_EXACT = 0,     // Every source per particle, culled by the particle grid
+    GRAVITY_MODE_FIELD          // Sources baked onto game->gravityField, sampled bilinearly
+} GravityMode;
+
 // Gravity source (what creates gravity)
 typedef struct {
     Vector2 position;      // Gravity center point
@@ -25,11 +34,25 @@ typedef struct {
     float strength;        // Force multiplier (base force * strength)
     GravityType type;      // Type of gravity
     bool active;           // Is this source currently active?
-    void* sourcePtr;       // Pointer to source object (Enemy*, etc) - for reference only
+    EnemyHandle sourceEnemy; // Enemy that owns this source (null handle for non-enemy sources)
     int sourceType;        // Source type: 0=enemy, 1=environment, 2=player_skill, 3=item
     int sourceId;          // Unique ID for source (for removal)
 } GravitySource;
 
+// Maximum queued radial impulses
+#define MAX_RADIAL_IMPULSES 32
+
+// Radial velocity impulse applied by the gravity pass (strength > 0 pushes away, < 0 pulls in)
+typedef struct {
+    Vector2 center;
+    float radius;          // No effect at or beyond this distance
+    float minDistance;     // No effect at or inside this distance
+    float strength;        // Impulse at the center, falls off linearly to 0 at radius
+    float probability;     // Chance per particle per pass (1.0 = always)
+    float duration;        // Seconds it keeps applying (0 = the next pass only)
+    bool instant;          // Added once at full strength (a kick) instead of scaling with the step length
+} RadialImpulse;
+
 // Gravity target (what receives gravity)
 typedef struct {
     Vector2* position;     // Pointer to target's position
@@ -48,9 +71,50 @@ void UnregisterGravitySource(int sourceId);
 void UpdateGravitySource(int sourceId, Vector2 newPosition); // For moving sources
 void SetGravitySourceActive(int sourceId, bool active);
 
-// Main update function (call once per frame)
+// Evaluation mode (exact by default; kept across InitGravitySystem)
+void SetGravityMode(GravityMode mode);
+GravityMode GetGravityMode(void);
+
+/**
+ * @brief Main update function (call once per frame)
+ *
+ * Exact mode refreshes game->particleGrid and applies every active source and
+ * queued impulse to the particles inside its radius. Only the grid cells a
+ * radius covers are visited, so the cost follows the number of particles
+ * inside fields rather than particles x slots. Sources are sorted by their
+ * top grid row; grid rows are split across threads and each row applies its
+ * overlapping sources in that order, so results do not depend on the thread
+ * count. Field mode refreshes game->gravityField and queues a force operator
+ * that samples it on game->particlePipeline, so the forces land in the next
+ * ParticlePipeline_Run (the velocity changes are not visible before it). Forces scale with FixedStep_Scale(deltaTime) and queued impulses
+ * are aged by deltaTime.
+ */
 void ApplyAllGravitySources(void* gamePtr, float deltaTime);
 
+/**
+ * @brief Queue a radial impulse for the next gravity pass
+ *
+ * Impulses go through the same grid culling as gravity sources, so only
+ * particles in the cells the radius covers are tested. A timed impulse is
+ * applied on every pass until its duration runs out. Returns false when the
+ * queue is full.
+ */
+bool QueueRadialImpulse(RadialImpulse impulse);
+// One-pass instant kick with full probability (pulses)
+bool ApplyRadialImpulse(Vector2 center, float radius, float strength);
+int GetQueuedRadialImpulseCount(void);
+
+// Queued impulses only (field mode, where the particle pipeline samples the baked gravity).
+// Forces are per reference step and scale with FixedStep_Scale(deltaTime), like gravity.
+void ApplyQueuedRadialImpulses(void* gamePtr, float deltaTime);
+
+// Re-bake the field if any source was added, removed, moved or toggled since its last bake
+struct GravityField;
+void RefreshGravityField(struct GravityField* field);
+
+// Reference path: all active sources against particles [begin, end) with no culling
+void ApplyGravityToParticles(ParticleBuffer* particles, int begin, int end);
+
 // Helper functions (inline for performance)
 static inline Vector2 CalculateGravityForce(Vector2 targetPos, GravitySource source) {
     float dx = source.position.x - targetPos.x;
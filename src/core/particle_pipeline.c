@@ -0,0 +1,251 @@
+#include "particle_pipeline.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool ParticlePipeline_Init(ParticlePipeline* pipeline, int screenWidth, int screenHeight) {
+    memset(pipeline, 0, sizeof(ParticlePipeline));
+
+    pipeline->invCellSize = 1.0f / PARTICLE_PIPELINE_CONTACT_CELL_SIZE;
+    pipeline->cols = (int)(screenWidth / PARTICLE_PIPELINE_CONTACT_CELL_SIZE) + 1;
+    pipeline->rows = (int)(screenHeight / PARTICLE_PIPELINE_CONTACT_CELL_SIZE) + 1;
+    pipeline->binStart = (int*)calloc(pipeline->cols * pipeline->rows + 1, sizeof(int));
+
+    return pipeline->binStart != NULL;
+}
+
+void ParticlePipeline_Destroy(ParticlePipeline* pipeline) {
+    free(pipeline->targets);
+    free(pipeline->binStart);
+    free(pipeline->binItems);
+    for (int i = 0; i < THREAD_POOL_MAX_THREADS; i++) {
+        free(pipeline->contacts[i].items);
+        free(pipeline->contacts[i].targetHits);
+    }
+    memset(pipeline, 0, sizeof(ParticlePipeline));
+}
+
+void ParticlePipeline_AddForce(ParticlePipeline* pipeline, ParticleForceFunc apply, const void* params, bool threadSafe) {
+    if (pipeline->forceCount >= PARTICLE_PIPELINE_MAX_FORCES) return;
+
+    ParticleForceOp* op = &pipeline->forces[pipeline->forceCount++];
+    op->apply = apply;
+    op->params = params;
+    op->threadSafe = threadSafe;
+}
+
+static inline int ContactCol(const ParticlePipeline* pipeline, float x) {
+    int col = (int)(x * pipeline->invCellSize);
+    if (col < 0) col = 0;
+    if (col >= pipeline->cols) col = pipeline->cols - 1;
+    return col;
+}
+
+static inline int ContactRow(const ParticlePipeline* pipeline, float y) {
+    int row = (int)(y * pipeline->invCellSize);
+    if (row < 0) row = 0;
+    if (row >= pipeline->rows) row = pipeline->rows - 1;
+    return row;
+}
+
+void ParticlePipeline_SetContactTargets(ParticlePipeline* pipeline, const ContactTarget* targets, int count) {
+    int cellCount = pipeline->cols * pipeline->rows;
+    memset(pipeline->binStart, 0, (cellCount + 1) * sizeof(int));
+    pipeline->targetCount = 0;
+    if (count <= 0) return;
+
+    if (count > pipeline->targetCapacity) {
+        ContactTarget* grown = (ContactTarget*)realloc(pipeline->targets, count * sizeof(ContactTarget));
+        if (!grown) return;
+        pipeline->targets = grown;
+        for (int w = 0; w < THREAD_POOL_MAX_THREADS; w++) {
+            int* hits = (int*)realloc(pipeline->contacts[w].targetHits, count * sizeof(int));
+            if (!hits) return;
+            pipeline->contacts[w].targetHits = hits;
+        }
+        pipeline->targetCapacity = count;
+    }
+    memcpy(pipeline->targets, targets, count * sizeof(ContactTarget));
+    pipeline->targetCount = count;
+
+    // 1차: 각 타깃이 겹치는 셀 수 세기
+    int total = 0;
+    for (int t = 0; t < count; t++) {
+        float reach = targets[t].radius + 1.0f;
+        int col0 = ContactCol(pipeline, targets[t].position.x - reach);
+        int col1 = ContactCol(pipeline, targets[t].position.x + reach);
+        int row0 = ContactRow(pipeline, targets[t].position.y - reach);
+        int row1 = ContactRow(pipeline, targets[t].position.y + reach);
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                pipeline->binStart[row * pipeline->cols + col + 1]++;
+            }
+        }
+        total += (row1 - row0 + 1) * (col1 - col0 + 1);
+    }
+    for (int c = 0; c < cellCount; c++) {
+        pipeline->binStart[c + 1] += pipeline->binStart[c];
+    }
+
+    if (total > pipeline->binItemCapacity) {
+        int* grown = (int*)realloc(pipeline->binItems, total * sizeof(int));
+        if (!grown) {
+            memset(pipeline->binStart, 0, (cellCount + 1) * sizeof(int));
+            pipeline->targetCount = 0;
+            return;
+        }
+        pipeline->binItems = grown;
+        pipeline->binItemCapacity = total;
+    }
+
+    // 2차: 셀별로 타깃 인덱스 채우기 (binStart 를 커서로 쓰고 끝나면 한 칸씩 되돌림)
+    for (int t = 0; t < count; t++) {
+        float reach = targets[t].radius + 1.0f;
+        int col0 = ContactCol(pipeline, targets[t].position.x - reach);
+        int col1 = ContactCol(pipeline, targets[t].position.x + reach);
+        int row0 = ContactRow(pipeline, targets[t].position.y - reach);
+        int row1 = ContactRow(pipeline, targets[t].position.y + reach);
+        for (int row = row0; row <= row1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                pipeline->binItems[pipeline->binStart[row * pipeline->cols + col]++] = t;
+            }
+        }
+    }
+    for (int c = cellCount; c > 0; c--) {
+        pipeline->binStart[c] = pipeline->binStart[c - 1];
+    }
+    pipeline->binStart[0] = 0;
+}
+
+static void PushContact(ContactList* list, int particle, int target) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 1024;
+        ParticleContact* grown = (ParticleContact*)realloc(list->items, capacity * sizeof(ParticleContact));
+        if (!grown) return;
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    list->items[list->count].particle = particle;
+    list->items[list->count].target = target;
+    list->count++;
+}
+
+// 이동이 끝난 블록의 파티클을 해당 셀의 타깃과 비교해 접촉 기록
+static void DetectContacts(ParticlePipeline* pipeline, ParticleBuffer* particles, int begin, int end, ContactList* list) {
+    for (int p = begin; p < end; p++) {
+        float x = particles->x[p];
+        float y = particles->y[p];
+        int cell = ContactRow(pipeline, y) * pipeline->cols + ContactCol(pipeline, x);
+
+        for (int k = pipeline->binStart[cell]; k < pipeline->binStart[cell + 1]; k++) {
+            int t = pipeline->binItems[k];
+            const ContactTarget* target = &pipeline->targets[t];
+            float dx = x - target->position.x;
+            float dy = y - target->position.y;
+            float distSq = dx*dx + dy*dy;
+            float reach = target->radius + 1.0f;
+            if (distSq > reach * reach) continue;
+
+            PushContact(list, p, t);
+            list->targetHits[t]++;
+
+            if (target->repelImpulse != 0.0f && distSq > 0.0f) {
+                float scale = target->repelImpulse / sqrtf(distSq);
+                ParticleBuffer_AddVelocity(particles, p, dx * scale, dy * scale);
+            }
+        }
+    }
+}
+
+typedef struct {
+    ParticlePipeline* pipeline;
+    ParticleBuffer* particles;
+} PipelineJob;
+
+static void RunPipelineRange(int begin, int end, int worker, void* userData) {
+    PipelineJob* job = (PipelineJob*)userData;
+    ParticlePipeline* pipeline = job->pipeline;
+    ParticleBuffer* particles = job->particles;
+    ContactList* contacts = &pipeline->contacts[worker];
+    bool hasTargets = pipeline->targetCount > 0;
+
+    for (int blockBegin = begin; blockBegin < end; blockBegin += PARTICLE_PIPELINE_BLOCK_SIZE) {
+        int blockEnd = blockBegin + PARTICLE_PIPELINE_BLOCK_SIZE;
+        if (blockEnd > end) blockEnd = end;
+
+        for (int f = 0; f < pipeline->forceCount; f++) {
+            pipeline->forces[f].apply(particles, blockBegin, blockEnd, pipeline->forces[f].params);
+        }
+
+        ParticleKernel_Step(particles, blockBegin, blockEnd, &pipeline->step);
+
+        if (hasTargets) {
+            DetectContacts(pipeline, particles, blockBegin, blockEnd, contacts);
+        }
+    }
+}
+
+static void ResetContacts(ParticlePipeline* pipeline) {
+    for (int i = 0; i < THREAD_POOL_MAX_THREADS; i++) {
+        pipeline->contacts[i].count = 0;
+        if (pipeline->targetCount > 0) {
+            memset(pipeline->contacts[i].targetHits, 0, pipeline->targetCount * sizeof(int));
+        }
+    }
+}
+
+void ParticlePipeline_Run(ParticlePipeline* pipeline, ParticleBuffer* particles) {
+    ResetContacts(pipeline);
+
+    bool threadSafe = true;
+    for (int f = 0; f < pipeline->forceCount; f++) {
+        threadSafe = threadSafe && pipeline->forces[f].threadSafe;
+    }
+
+    PipelineJob job = { pipeline, particles };
+    if (threadSafe) {
+        ThreadPool_ParallelFor(particles->count, PARTICLE_PIPELINE_MIN_PER_THREAD, RunPipelineRange, &job);
+    } else {
+        RunPipelineRange(0, particles->count, 0, &job);
+    }
+
+    pipeline->forceCount = 0;
+    pipeline->contactsReady = true;
+}
+
+static void DetectContactsRange(int begin, int end, int worker, void* userData) {
+    PipelineJob* job = (PipelineJob*)userData;
+    DetectContacts(job->pipeline, job->particles, begin, end, &job->pipeline->contacts[worker]);
+}
+
+void ParticlePipeline_DetectContacts(ParticlePipeline* pipeline, ParticleBuffer* particles) {
+    ResetContacts(pipeline);
+    if (pipeline->targetCount > 0) {
+        // 반발 임펄스는 자기 범위의 파티클에만 쓰므로 분할해도 안전
+        PipelineJob job = { pipeline, particles };
+        ThreadPool_ParallelFor(particles->count, PARTICLE_PIPELINE_MIN_PER_THREAD, DetectContactsRange, &job);
+    }
+    pipeline->contactsReady = true;
+}
+
+int ParticlePipeline_GetContactCount(const ParticlePipeline* pipeline) {
+    int total = 0;
+    for (int i = 0; i < THREAD_POOL_MAX_THREADS; i++) {
+        total += pipeline->contacts[i].count;
+    }
+    return total;
+}
+
+int ParticlePipeline_SumTargetHits(const ParticlePipeline* pipeline, int* hitCounts) {
+    int targetCount = pipeline->targetCount;
+    if (targetCount <= 0) return 0;
+
+    memcpy(hitCounts, pipeline->contacts[0].targetHits, targetCount * sizeof(int));
+    for (int w = 1; w < THREAD_POOL_MAX_THREADS; w++) {
+        const int* hits = pipeline->contacts[w].targetHits;
+        for (int t = 0; t < targetCount; t++) {
+            hitCounts[t] += hits[t];
+        }
+    }
+    return targetCount;
+}
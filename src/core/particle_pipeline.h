@@ -0,0 +1,108 @@
+#ifndef PARTICLE_PIPELINE_H
+#define PARTICLE_PIPELINE_H
+
+#include "raylib.h"
+#include "thread_pool.h"
+#include "rng.h"
+#include "../entities/particle_buffer.h"
+#include "../entities/particle_kernel.h"
+#include <stdbool.h>
+
+// Particles per cache block: x/y/vx/vy of one block take 32 KB, so every
+// operator in the chain hits L1/L2 instead of streaming the whole array again.
+#define PARTICLE_PIPELINE_BLOCK_SIZE 2048
+#define PARTICLE_PIPELINE_MIN_PER_THREAD 8192
+#define PARTICLE_PIPELINE_MAX_FORCES 16
+#define PARTICLE_PIPELINE_CONTACT_CELL_SIZE 16.0f
+
+/**
+ * @brief Force operator: adds velocity to particles [begin, end) before integration
+ *
+ * Operators must only touch the particles in their range. Set threadSafe to
+ * false if the operator uses shared state (e.g. GetRandomValue); the pipeline
+ * then walks the blocks on the main thread in particle order. Per-particle
+ * randomness should come from Rng_UniformAt with the particle index as lane.
+ */
+typedef void (*ParticleForceFunc)(ParticleBuffer* particles, int begin, int end, const void* params);
+
+typedef struct ParticleForceOp {
+    ParticleForceFunc apply;
+    const void* params;     // Must stay valid until ParticlePipeline_Run returns
+    bool threadSafe;
+} ParticleForceOp;
+
+// Circle particles are tested against after they move
+typedef struct ContactTarget {
+    Vector2 position;
+    float radius;           // Contact when distance <= radius + 1 (particle radius)
+    float repelImpulse;     // Velocity pushed away from the center on contact (0 = none)
+} ContactTarget;
+
+typedef struct ParticleContact {
+    int particle;
+    int target;
+} ParticleContact;
+
+// One worker's contacts plus its per-target hit counters (summed by ParticlePipeline_SumTargetHits)
+typedef struct ContactList {
+    ParticleContact* items;
+    int count;
+    int capacity;
+    int* targetHits;
+} ContactList;
+
+/**
+ * @brief Fused per-frame particle stage
+ *
+ * One cache-blocked traversal per frame: queued force operators, then
+ * attraction/friction/move (ParticleKernel_Step), then contact detection
+ * against targets binned by grid cell. Contacts are recorded per worker and
+ * read back in particle order, so results do not depend on thread count.
+ */
+typedef struct ParticlePipeline {
+    ParticleForceOp forces[PARTICLE_PIPELINE_MAX_FORCES];
+    int forceCount;
+
+    ParticleStepParams step;
+
+    // Contact targets binned by cell (CSR: binStart[cell]..binStart[cell + 1] into binItems)
+    ContactTarget* targets;
+    int targetCount;
+    int targetCapacity;
+    int cols;
+    int rows;
+    float invCellSize;
+    int* binStart;
+    int* binItems;
+    int binItemCapacity;
+
+    ContactList contacts[THREAD_POOL_MAX_THREADS];
+    bool contactsReady;     // Contacts from the last Run not yet consumed
+} ParticlePipeline;
+
+// 파이프라인 초기화/정리 (화면 크기 기준 접촉 셀 구성)
+bool ParticlePipeline_Init(ParticlePipeline* pipeline, int screenWidth, int screenHeight);
+void ParticlePipeline_Destroy(ParticlePipeline* pipeline);
+
+// Queue a force operator for the next Run (ignored when the list is full)
+void ParticlePipeline_AddForce(ParticlePipeline* pipeline, ParticleForceFunc apply, const void* params, bool threadSafe);
+// Replace the contact targets for the next Run
+void ParticlePipeline_SetContactTargets(ParticlePipeline* pipeline, const ContactTarget* targets, int count);
+
+// Run the fused stage over all particles, then clear queued forces
+void ParticlePipeline_Run(ParticlePipeline* pipeline, ParticleBuffer* particles);
+
+// Contact detection only, for particles that already moved this frame (same worker split as Run)
+void ParticlePipeline_DetectContacts(ParticlePipeline* pipeline, ParticleBuffer* particles);
+
+// Number of contacts recorded by the last Run
+int ParticlePipeline_GetContactCount(const ParticlePipeline* pipeline);
+/**
+ * @brief Reduce the per-worker hit counters into hitCounts[target]
+ *
+ * Integer sums taken in worker order, so the totals are identical for any
+ * thread count. Returns the number of targets written.
+ */
+int ParticlePipeline_SumTargetHits(const ParticlePipeline* pipeline, int* hitCounts);
+
+#endif // PARTICLE_PIPELINE_H
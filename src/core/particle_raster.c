@@ -0,0 +1,132 @@
+#include "particle_raster.h"
+#include "profiler.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool ParticleRaster_Init(ParticleRaster* raster, int width, int height) {
+    memset(raster, 0, sizeof(ParticleRaster));
+    if (width <= 0 || height <= 0) return false;
+
+    raster->width = width;
+    raster->height = height;
+    raster->pixels = (Color*)calloc((size_t)width * height, sizeof(Color));
+    return raster->pixels != NULL;
+}
+
+void ParticleRaster_Destroy(ParticleRaster* raster) {
+    free(raster->pixels);
+    free(raster->layers);
+    memset(raster, 0, sizeof(ParticleRaster));
+}
+
+// 스레드마다 레이어 하나 (해결 패스가 읽은 뒤 0 으로 되돌리므로 렌더 사이에는 항상 비어 있음)
+static bool EnsureLayers(ParticleRaster* raster, int count) {
+    if (count <= raster->layerCount) return true;
+
+    uint16_t* layers = (uint16_t*)calloc((size_t)count * raster->width * raster->height, sizeof(uint16_t));
+    if (!layers) return false;
+    free(raster->layers);
+    raster->layers = layers;
+    raster->layerCount = count;
+    return true;
+}
+
+// 겹친 파티클 n 개를 알파 블렌딩한 결과: 1 - (1 - a)^n
+static void BuildCoverage(ParticleRaster* raster, Color color) {
+    if (raster->hasCoverage && memcmp(&raster->coverageColor, &color, sizeof(Color)) == 0) return;
+
+    float transmit = 1.0f - (float)color.a / 255.0f;
+    float remaining = 1.0f;
+    raster->coverage[0] = 0;
+    for (int n = 1; n < 256; n++) {
+        remaining *= transmit;
+        raster->coverage[n] = (uint8_t)lroundf(255.0f * (1.0f - remaining));
+    }
+    raster->coverageColor = color;
+    raster->hasCoverage = true;
+}
+
+typedef struct RasterPass {
+    ParticleRaster* raster;
+    const ParticleRasterSource* source;
+    size_t layerSize;
+} RasterPass;
+
+static void SplatRange(int begin, int end, int worker, void* userData) {
+    RasterPass* pass = (RasterPass*)userData;
+    ParticleRaster* raster = pass->raster;
+    const ParticleRasterSource* source = pass->source;
+    uint16_t* layer = raster->layers + (size_t)worker * pass->layerSize;
+    const float width = (float)raster->width;
+    const float height = (float)raster->height;
+
+    PROFILE_WORK_BEGIN(splatStart);
+    for (int p = begin; p < end; p++) {
+        float x = source->x[p];
+        float y = source->y[p];
+        if (source->previousX) {
+            float px = source->previousX[p];
+            float py = source->previousY[p];
+            x = px + (x - px) * source->alpha;
+            y = py + (y - py) * source->alpha;
+        }
+        // NaN 도 여기서 걸러짐
+        if (!(x >= 0.0f && x < width && y >= 0.0f && y < height)) continue;
+
+        uint16_t* cell = &layer[(int)y * raster->width + (int)x];
+        *cell += (*cell != UINT16_MAX);
+    }
+    raster->layerUsed[worker] = true;
+    PROFILE_WORK_END(PROFILE_ZONE_PARTICLE_RASTER_WORK, splatStart);
+}
+
+static void ResolveRows(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    RasterPass* pass = (RasterPass*)userData;
+    ParticleRaster* raster = pass->raster;
+    Color color = pass->source->color;
+    Color empty = { 0, 0, 0, 0 };
+
+    // 이번 프레임에 쓰인 레이어만 합산
+    uint16_t* used[THREAD_POOL_MAX_THREADS];
+    int usedCount = 0;
+    for (int l = 0; l < raster->layerCount; l++) {
+        if (raster->layerUsed[l]) used[usedCount++] = raster->layers + (size_t)l * pass->layerSize;
+    }
+
+    PROFILE_WORK_BEGIN(resolveStart);
+    int first = begin * raster->width;
+    int last = end * raster->width;
+    for (int i = first; i < last; i++) {
+        unsigned int density = 0;
+        for (int l = 0; l < usedCount; l++) {
+            density += used[l][i];
+            used[l][i] = 0;
+        }
+        if (density == 0) {
+            raster->pixels[i] = empty;
+        } else {
+            color.a = raster->coverage[density > 255 ? 255 : density];
+            raster->pixels[i] = color;
+        }
+    }
+    PROFILE_WORK_END(PROFILE_ZONE_PARTICLE_RASTER_WORK, resolveStart);
+}
+
+void ParticleRaster_Render(ParticleRaster* raster, const ParticleRasterSource* source) {
+    if (!raster->pixels) return;
+
+    RasterPass pass = { raster, source, (size_t)raster->width * raster->height };
+    BuildCoverage(raster, source->color);
+    memset(raster->layerUsed, 0, sizeof(raster->layerUsed));
+
+    // 레이어를 스레드 수만큼 확보하지 못하면 메인 스레드 혼자 한 레이어에 기록
+    if (EnsureLayers(raster, ThreadPool_GetThreadCount())) {
+        ThreadPool_ParallelFor(source->count, PARTICLE_RASTER_MIN_PER_THREAD, SplatRange, &pass);
+    } else if (EnsureLayers(raster, 1)) {
+        SplatRange(0, source->count, 0, &pass);
+    }
+
+    ThreadPool_ParallelFor(raster->height, PARTICLE_RASTER_MIN_ROWS_PER_THREAD, ResolveRows, &pass);
+}
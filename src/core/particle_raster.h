@@ -0,0 +1,56 @@
+#ifndef PARTICLE_RASTER_H
+#define PARTICLE_RASTER_H
+
+#include "raylib.h"
+#include "thread_pool.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PARTICLE_RASTER_MIN_PER_THREAD 8192      // Particles per worker in the splat pass
+#define PARTICLE_RASTER_MIN_ROWS_PER_THREAD 32   // Framebuffer rows per worker in the resolve pass
+
+// Particle positions to rasterize, optionally blended between the last two steps
+typedef struct ParticleRasterSource {
+    const float* x;             // Current positions
+    const float* y;
+    const float* previousX;     // Positions before the last step (NULL = draw the current ones)
+    const float* previousY;
+    float alpha;                // Blend from previous (0) to current (1)
+    int count;
+    Color color;                // Shared particle color
+} ParticleRasterSource;
+
+/**
+ * @brief CPU framebuffer the particles are rasterized into
+ *
+ * Rendering is two ParallelFor passes. Splat: each worker counts its range
+ * of particles into its own density layer, so no two threads write the same
+ * memory. Resolve: framebuffer rows are split across workers; each sums the
+ * layers for its rows (zeroing them for the next frame) and blends the color
+ * as if that many pixels had been alpha-blended on top of each other. The
+ * result does not depend on the thread count and is uploaded as one texture.
+ */
+typedef struct ParticleRaster {
+    int width;
+    int height;
+    Color* pixels;              // RGBA8 row-major, transparent where no particle landed
+    uint16_t* layers;           // layerCount density layers of width * height (saturating counts)
+    int layerCount;
+    bool layerUsed[THREAD_POOL_MAX_THREADS];  // Layers written since the last resolve
+    uint8_t coverage[256];      // Alpha after n overlapping particles (n clamped to 255)
+    Color coverageColor;        // Color `coverage` was built for
+    bool hasCoverage;
+} ParticleRaster;
+
+// 프레임버퍼 할당 (밀도 레이어는 첫 렌더링 때 스레드 수만큼 할당)
+bool ParticleRaster_Init(ParticleRaster* raster, int width, int height);
+// 메모리 해제
+void ParticleRaster_Destroy(ParticleRaster* raster);
+// Rasterize every particle into raster->pixels (main thread only, like ThreadPool_ParallelFor)
+void ParticleRaster_Render(ParticleRaster* raster, const ParticleRasterSource* source);
+
+static inline Color ParticleRaster_GetPixel(const ParticleRaster* raster, int x, int y) {
+    return raster->pixels[y * raster->width + x];
+}
+
+#endif // PARTICLE_RASTER_H
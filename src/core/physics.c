@@ -3,185 +3,195 @@
 #include "../entities/explosion.h"
 #include "event/event_system.h"
 #include "event/event_types.h"
-#include "memory_pool.h"
+#include "fixed_step.h"
 #include "raymath.h"
 #include <stdlib.h>
+#include <string.h>
 
-// 충돌 이벤트 데이터를 위한 메모리 풀
-MemoryPool g_collisionEventPool;
-MemoryPool g_enemyEventPool;
-MemoryPool g_enemyHealthEventPool;
-MemoryPool g_gameStateEventPool;
-MemoryPool g_enemyStateEventPool;
-MemoryPool g_stageEventPool;
-MemoryPool g_specialAbilityEventPool;
-MemoryPool g_bossPhaseEventPool;
+float PARTICLE_ENEMY_DAMAGE = 0.001f;
 
-// External memory pools from item_manager.c
-extern MemoryPool g_itemEventPool;
-extern MemoryPool g_healthEventPool;
+bool CheckCollisionEnemyParticle(const Enemy* enemy, Vector2 particlePosition) {
+    return CheckCollisionCircles(enemy->position, enemy->radius, particlePosition, 1.0f);
+}
 
-static bool poolsInitialized = false;
+#define REPULSOR_PARTICLE_IMPULSE 3.0f
 
-float PARTICLE_ENEMY_DAMAGE = 0.001f;
+// 적 저장소 용량에 맞춘 프레임 작업 버퍼
+static int g_scratchCapacity = 0;
+static int* g_enemyHitCounts;           // 이번 프레임 적별 접촉 수 (워커별 카운터의 합)
+static EnemyHandle* g_countedEnemies;   // 접촉 수집 시점의 적 순서 (제거로 자리가 바뀌어도 추적)
+static ContactTarget* g_contactTargets;
+
+// 프레임 피해 기록: 같은 적의 여러 피해를 한 레코드로 합쳐 배치 이벤트 하나로 발행
+static EnemyDamageRecord* g_damageRecords;
+static int g_damageRecordCount = 0;
+static int* g_damageRecordOf;           // 적 슬롯 → 레코드 (-1 = 없음)
+
+static bool EnsureCollisionScratch(int capacity) {
+    if (capacity <= g_scratchCapacity) return true;
 
-// 메모리 풀 초기화
-void InitPhysicsMemoryPools(void) {
-    if (!poolsInitialized) {
-        MemoryPool_Init(&g_collisionEventPool, sizeof(CollisionEventData), 64);
-        MemoryPool_Init(&g_enemyEventPool, sizeof(EnemyEventData), 64);
-        MemoryPool_Init(&g_enemyHealthEventPool, sizeof(EnemyHealthEventData), 64);
-        MemoryPool_Init(&g_gameStateEventPool, sizeof(GameStateEventData), 16);
-        MemoryPool_Init(&g_enemyStateEventPool, sizeof(EnemyStateEventData), 64);
-        MemoryPool_Init(&g_stageEventPool, sizeof(StageChangeEventData), 16);
-        MemoryPool_Init(&g_specialAbilityEventPool, sizeof(SpecialAbilityEventData), 32);
-        MemoryPool_Init(&g_bossPhaseEventPool, sizeof(BossPhaseEventData), 16);
-        poolsInitialized = true;
+    int* hitCounts = (int*)realloc(g_enemyHitCounts, capacity * sizeof(int));
+    if (hitCounts) g_enemyHitCounts = hitCounts;
+    EnemyHandle* counted = (EnemyHandle*)realloc(g_countedEnemies, capacity * sizeof(EnemyHandle));
+    if (counted) g_countedEnemies = counted;
+    ContactTarget* targets = (ContactTarget*)realloc(g_contactTargets, capacity * sizeof(ContactTarget));
+    if (targets) g_contactTargets = targets;
+    EnemyDamageRecord* records = (EnemyDamageRecord*)realloc(g_damageRecords, capacity * sizeof(EnemyDamageRecord));
+    if (records) g_damageRecords = records;
+    int* recordOf = (int*)realloc(g_damageRecordOf, capacity * sizeof(int));
+    if (recordOf) g_damageRecordOf = recordOf;
+    if (!hitCounts || !counted || !targets || !records || !recordOf) return false;
+
+    for (int s = g_scratchCapacity; s < capacity; s++) {
+        g_damageRecordOf[s] = -1;
     }
+    g_scratchCapacity = capacity;
+    return true;
 }
 
-// 메모리 풀 정리
-void CleanupPhysicsMemoryPools(void) {
-    if (poolsInitialized) {
-        MemoryPool_Destroy(&g_collisionEventPool);
-        MemoryPool_Destroy(&g_enemyEventPool);
-        MemoryPool_Destroy(&g_enemyHealthEventPool);
-        MemoryPool_Destroy(&g_gameStateEventPool);
-        MemoryPool_Destroy(&g_enemyStateEventPool);
-        MemoryPool_Destroy(&g_stageEventPool);
-        MemoryPool_Destroy(&g_specialAbilityEventPool);
-        MemoryPool_Destroy(&g_bossPhaseEventPool);
-        poolsInitialized = false;
+void RecordEnemyDamage(Game* game, int enemyIndex, int hits, float damage, float oldHealth) {
+    if (enemyIndex < 0 || enemyIndex >= game->enemies.count) return;
+    if (!EnsureCollisionScratch(game->enemies.capacity)) return;
+
+    // 같은 프레임에 슬롯이 재사용됐으면 (분열 등) 새 레코드
+    EnemyHandle handle = game->enemies.handles[enemyIndex];
+    int r = g_damageRecordOf[handle.slot];
+    if (r < 0 || !EnemyHandle_Equals(g_damageRecords[r].enemy, handle)) {
+        if (g_damageRecordCount >= g_scratchCapacity) return;
+        r = g_damageRecordCount++;
+        g_damageRecordOf[handle.slot] = r;
+        g_damageRecords[r] = (EnemyDamageRecord){
+            .enemy = handle,
+            .oldHealth = oldHealth
+        };
     }
+    g_damageRecords[r].hits += hits;
+    g_damageRecords[r].damage += damage;
+    g_damageRecords[r].newHealth = game->enemies.items[enemyIndex].health;
 }
 
-bool CheckCollisionEnemyParticle(Enemy enemy, Particle particle) {
-    return CheckCollisionCircles(enemy.position, enemy.radius, particle.position, 1.0f);
+static void MarkDamageRecordDestroyed(EnemyHandle handle) {
+    int r = g_damageRecordOf[handle.slot];
+    if (r >= 0 && EnemyHandle_Equals(g_damageRecords[r].enemy, handle)) {
+        g_damageRecords[r].destroyed = true;
+    }
+}
+
+static void PublishDamageBatch(void) {
+    if (g_damageRecordCount == 0) return;
+
+    // 레코드는 핸들로 적을 가리키므로 제거/이동 후에도 그대로 발행
+    PublishEventBatch(EVENT_ENEMY_DAMAGE_BATCH, g_damageRecords, sizeof(EnemyDamageRecord), g_damageRecordCount);
+
+    for (int r = 0; r < g_damageRecordCount; r++) {
+        g_damageRecordOf[g_damageRecords[r].enemy.slot] = -1;
+    }
+    g_damageRecordCount = 0;
+}
+
+// 파티클 패스가 이동 직후 검사할 적 원 목록 설정
+void SetEnemyContactTargets(Game* game) {
+    int count = EnsureCollisionScratch(game->enemies.capacity) ? game->enemies.count : 0;
+    float repelImpulse = REPULSOR_PARTICLE_IMPULSE * FixedStep_Scale(game->deltaTime);
+
+    for (int e = 0; e < count; e++) {
+        g_contactTargets[e].position = game->enemies.items[e].position;
+        g_contactTargets[e].radius = game->enemies.items[e].radius;
+        g_contactTargets[e].repelImpulse = (game->enemies.items[e].type == ENEMY_TYPE_REPULSOR) ? repelImpulse : 0.0f;
+    }
+    ParticlePipeline_SetContactTargets(&game->particlePipeline, g_contactTargets, count);
+}
+
+// 접촉 수집 단계: 파티클 패스가 워커별로 센 적별 접촉 수를 워커 순서로 합산
+// (반발 임펄스는 패스에서 이미 적용됨). 패스 없이 호출된 경우에는 접촉 검사만
+// 같은 방식으로 병렬 실행한다.
+static int GatherEnemyContacts(Game* game, int* hitCounts) {
+    ParticlePipeline* pipeline = &game->particlePipeline;
+    if (!pipeline->contactsReady) {
+        SetEnemyContactTargets(game);
+        ParticlePipeline_DetectContacts(pipeline, &game->particles);
+    }
+
+    int counted = ParticlePipeline_SumTargetHits(pipeline, hitCounts);
+    pipeline->contactsReady = false;
+    return counted;
 }
 
 // Enhanced collision processing for different enemy types
 void ProcessEnemyCollisions(Game* game) {
-    // 필요 시 메모리 풀 초기화
-    if (!poolsInitialized) {
-        InitPhysicsMemoryPools();
+    if (game->enemies.count == 0) {
+        game->particlePipeline.contactsReady = false;
+        return;
     }
 
-    int e = 0;
-    while (e < game->enemyCount) {
-        float prevHealth = game->enemies[e].health;
-        int collisionCount = 0;
-        float totalDamage = 0.0f;
+    if (!EnsureCollisionScratch(game->enemies.capacity)) return;
+
+    // 병렬 수집 → 적용 단계는 직렬: 피해는 정수 접촉 수에서 계산하므로 스레드 수와 무관
+    int countedEnemies = GatherEnemyContacts(game, g_enemyHitCounts);
+
+    // 제거는 swap-remove 라 자리가 바뀌므로 집계 시점의 핸들로 순회
+    // (분열로 새로 생긴 적은 다음 프레임부터 처리)
+    int enemyCount = game->enemies.count;
+    memcpy(g_countedEnemies, game->enemies.handles, enemyCount * sizeof(EnemyHandle));
+
+    for (int c = 0; c < enemyCount; c++) {
+        int e = EnemyStore_IndexOf(&game->enemies, g_countedEnemies[c]);
+        if (e < 0) continue;    // 이번 프레임에 이미 제거됨
+
+        float prevHealth = game->enemies.items[e].health;
+        int collisionCount = (c < countedEnemies) ? g_enemyHitCounts[c] : 0;
         
         // Check if enemy has special collision properties
-        bool isRepulsor = (game->enemies[e].type == ENEMY_TYPE_REPULSOR);
-        bool hasShield = HasState(game->enemies[e].stateFlags, ENEMY_STATE_SHIELDED) &&
-                         game->enemies[e].stateData.shieldHealth > 0;
-        
-        // Batch processing for particles
-        const int BATCH_SIZE = 1000;
+        bool hasShield = HasState(game->enemies.items[e].stateFlags, ENEMY_STATE_SHIELDED) &&
+                         game->enemies.items[e].stateData.shieldHealth > 0;
         
-        for (int batchStart = 0; batchStart < PARTICLE_COUNT; batchStart += BATCH_SIZE) {
-            int batchEnd = batchStart + BATCH_SIZE;
-            if (batchEnd > PARTICLE_COUNT) batchEnd = PARTICLE_COUNT;
-            
-            for (int p = batchStart; p < batchEnd; p++) {
-                // Quick distance check
-                float dx = game->enemies[e].position.x - game->particles[p].position.x;
-                float dy = game->enemies[e].position.y - game->particles[p].position.y;
-                float distSquared = dx*dx + dy*dy;
-                float radiusSum = game->enemies[e].radius + 1.0f;
-                
-                // Skip if too far
-                if (distSquared > radiusSum * radiusSum) continue;
-                
-                // Check actual collision
-                if (CheckCollisionEnemyParticle(game->enemies[e], game->particles[p])) {
-                    // Calculate damage based on enemy type
-                    float damage = PARTICLE_ENEMY_DAMAGE;
-                    
-                    // Modify damage based on enemy properties
-                    if (hasShield) {
-                        damage *= 0.5f; // Shield reduces damage
-                    }
-                    if (game->enemies[e].type == ENEMY_TYPE_BOSS_1 || 
-                        game->enemies[e].type == ENEMY_TYPE_BOSS_FINAL) {
-                        damage *= 0.3f; // Bosses take less damage
-                    }
-                    if (HasState(game->enemies[e].stateFlags, ENEMY_STATE_INVULNERABLE)) {
-                        damage = 0.0f; // No damage during invulnerability
-                    }
-                    
-                    totalDamage += damage;
-                    collisionCount++;
-                    
-                    // Apply particle physics based on enemy type
-                    if (isRepulsor) {
-                        // Repel the particle
-                        Vector2 repelDir = Vector2Subtract(game->particles[p].position, game->enemies[e].position);
-                        repelDir = Vector2Normalize(repelDir);
-                        game->particles[p].velocity.x += repelDir.x * 3.0f;
-                        game->particles[p].velocity.y += repelDir.y * 3.0f;
-                    }
-                }
-            }
+        // Calculate damage per contact based on enemy type (per 60Hz step, scaled to the step length)
+        float damage = PARTICLE_ENEMY_DAMAGE * FixedStep_Scale(game->deltaTime);
+        if (hasShield) {
+            damage *= 0.5f; // Shield reduces damage
+        }
+        if (game->enemies.items[e].type == ENEMY_TYPE_BOSS_1 || 
+            game->enemies.items[e].type == ENEMY_TYPE_BOSS_FINAL) {
+            damage *= 0.3f; // Bosses take less damage
+        }
+        if (HasState(game->enemies.items[e].stateFlags, ENEMY_STATE_INVULNERABLE)) {
+            damage = 0.0f; // No damage during invulnerability
         }
+        float totalDamage = damage * collisionCount;
         
         // Apply damage
         if (totalDamage > 0) {
-            DamageEnemy(&game->enemies[e], totalDamage);
+            DamageEnemy(&game->enemies.items[e], totalDamage);
         }
         
-        // Emit collision event if hits occurred
-        if (collisionCount > 0) {
-            CollisionEventData* collisionData = MemoryPool_Alloc(&g_collisionEventPool);
-            if (collisionData) {
-                collisionData->entityAIndex = -1;
-                collisionData->entityBIndex = e;
-                collisionData->entityAPtr = NULL;
-                collisionData->entityBPtr = &game->enemies[e];
-                collisionData->entityAType = 0; // Particle
-                collisionData->entityBType = 1; // Enemy
-                collisionData->impact = totalDamage;
-                PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, collisionData);
-            }
+        // Record hits and health change for the frame's damage batch
+        if (collisionCount > 0 || game->enemies.items[e].health != prevHealth) {
+            RecordEnemyDamage(game, e, collisionCount, totalDamage, prevHealth);
         }
         
-        // Emit health change event
-        if (game->enemies[e].health != prevHealth) {
-            EnemyHealthEventData* data = MemoryPool_Alloc(&g_enemyHealthEventPool);
-            if (data) {
-                data->enemyIndex = e;
-                data->oldHealth = prevHealth;
-                data->newHealth = game->enemies[e].health;
-                data->enemyPtr = &game->enemies[e];
-                PublishEvent(EVENT_ENEMY_HEALTH_CHANGED, data);
-            }
-            
+        if (game->enemies.items[e].health != prevHealth) {
             // Check for boss phase changes
-            if (game->enemies[e].type == ENEMY_TYPE_BOSS_1 ||
-                game->enemies[e].type == ENEMY_TYPE_BOSS_FINAL) {
-                int oldPhase = game->enemies[e].stateData.phase;
-                float healthPercent = game->enemies[e].health / game->enemies[e].maxHealth;
+            if (game->enemies.items[e].type == ENEMY_TYPE_BOSS_1 ||
+                game->enemies.items[e].type == ENEMY_TYPE_BOSS_FINAL) {
+                int oldPhase = game->enemies.items[e].stateData.phase;
+                float healthPercent = game->enemies.items[e].health / game->enemies.items[e].maxHealth;
 
                 // Emit boss phase event if phase changed
-                if (oldPhase != game->enemies[e].stateData.phase) {
-                    BossPhaseEventData* phaseData = MemoryPool_Alloc(&g_bossPhaseEventPool);
-                    if (phaseData) {
-                        phaseData->enemyIndex = e;
-                        phaseData->enemyPtr = &game->enemies[e];
-                        phaseData->oldPhase = oldPhase;
-                        phaseData->newPhase = game->enemies[e].stateData.phase;
-                        phaseData->healthPercentage = healthPercent;
-                        PublishEvent(EVENT_BOSS_PHASE_CHANGED, phaseData);
-                    }
+                if (oldPhase != game->enemies.items[e].stateData.phase) {
+                    BossPhaseEventData phaseData = {0};
+                    phaseData.enemy = g_countedEnemies[c];
+                    phaseData.oldPhase = oldPhase;
+                    phaseData.newPhase = game->enemies.items[e].stateData.phase;
+                    phaseData.healthPercentage = healthPercent;
+                    PublishEvent(EVENT_BOSS_PHASE_CHANGED, &phaseData, sizeof(phaseData));
                 }
             }
         }
         
         // Handle enemy destruction
-        if (game->enemies[e].health <= 0.0f) {
+        if (game->enemies.items[e].health <= 0.0f) {
             // Special handling for different enemy types
-            Enemy* dyingEnemy = &game->enemies[e];
+            Enemy* dyingEnemy = &game->enemies.items[e];
             
             // Handle splitting enemies
             if (dyingEnemy->type == ENEMY_TYPE_SPLITTER) {
@@ -222,20 +232,15 @@ void ProcessEnemyCollisions(Game* game) {
             game->enemiesKilledThisStage++;
             
             // Emit enemy destroyed event
-            EnemyEventData* data = MemoryPool_Alloc(&g_enemyEventPool);
-            if (data) {
-                data->enemyIndex = e;
-                data->enemyPtr = dyingEnemy;
-                PublishEvent(EVENT_ENEMY_DESTROYED, data);
-            }
+            EnemyEventData data = {0};
+            data.enemy = g_countedEnemies[c];
+            PublishEvent(EVENT_ENEMY_DESTROYED, &data, sizeof(data));
             
-            // Remove enemy by shifting array
-            for (int j = e; j < game->enemyCount - 1; j++) {
-                game->enemies[j] = game->enemies[j+1];
-            }
-            game->enemyCount--;
-            continue;
+            // Swap-remove: O(1), queued events keep a handle that now reads as removed
+            MarkDamageRecordDestroyed(g_countedEnemies[c]);
+            RemoveEnemyAt(game, e);
         }
-        e++;
     }
+
+    PublishDamageBatch();
 }
\ No newline at end of file
@@ -8,11 +8,10 @@
 #include "../entities/explosion.h"
 
 // Physics functions
-bool CheckCollisionEnemyParticle(Enemy enemy, Particle particle);
+bool CheckCollisionEnemyParticle(const Enemy* enemy, Vector2 particlePosition);
+void SetEnemyContactTargets(Game* game);
 void ProcessEnemyCollisions(Game* game);
-
-// 메모리 풀 관리 함수
-void InitPhysicsMemoryPools(void);
-void CleanupPhysicsMemoryPools(void);
+// Add damage to the current frame's EVENT_ENEMY_DAMAGE_BATCH record for this enemy
+void RecordEnemyDamage(Game* game, int enemyIndex, int hits, float damage, float oldHealth);
 
 #endif // PHYSICS_H
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "profiler.h"
+#include "thread_pool.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+// windows.h 는 raylib.h 와 이름이 충돌하므로 필요한 함수만 선언
+__declspec(dllimport) int __stdcall QueryPerformanceCounter(long long* count);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long* frequency);
+#else
+#include <time.h>
+#endif
+
+static const char* ZONE_NAMES[PROFILE_ZONE_COUNT] = {
+    "stage",
+    "player",
+    "enemy AI",
+    "gravity",
+    "particles",
+    "collisions",
+    "items",
+    "explosions",
+    "event queue",
+    "draw",
+    "raster",
+    "raster work",
+    "capture"
+};
+
+// 워커별 누적 시간 (캐시 라인 공유를 피하도록 여유 공간 확보)
+typedef struct WorkSlot {
+    uint64_t ns[PROFILE_ZONE_COUNT];
+    uint64_t padding[8];
+} WorkSlot;
+
+static struct {
+    ProfileFrame history[PROFILER_HISTORY_FRAMES];
+    int historyHead;            // Next slot to write
+    int historyCount;
+    ProfileFrame current;
+    bool inFrame;
+    uint64_t frameIndex;
+    int openSpans[PROFILER_MAX_DEPTH];   // Index into current.spans, -1 if dropped
+    int depth;
+    WorkSlot work[THREAD_POOL_MAX_THREADS];
+} profiler;
+
+uint64_t Profiler_NowNs(void) {
+#ifdef _WIN32
+    long long count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)count * 1e9 / (double)frequency);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+const char* Profiler_GetZoneName(ProfileZone zone) {
+    if (zone >= 0 && zone < PROFILE_ZONE_COUNT) {
+        return ZONE_NAMES[zone];
+    }
+    return "frame";
+}
+
+void Profiler_BeginFrame(void) {
+    ProfileFrame* frame = &profiler.current;
+    frame->index = profiler.frameIndex++;
+    frame->spanCount = 0;
+    frame->workMask = 0;
+    memset(frame->zoneNs, 0, sizeof(frame->zoneNs));
+    memset(profiler.work, 0, sizeof(profiler.work));
+    profiler.depth = 0;
+    profiler.inFrame = true;
+    frame->startNs = Profiler_NowNs();
+}
+
+void Profiler_EndFrame(void) {
+    if (!profiler.inFrame) return;
+
+    ProfileFrame* frame = &profiler.current;
+    frame->endNs = Profiler_NowNs();
+
+    // 닫히지 않은 구간은 프레임 끝에서 닫음
+    while (profiler.depth > 0) {
+        int span = profiler.openSpans[--profiler.depth];
+        if (span >= 0) {
+            frame->spans[span].endNs = frame->endNs;
+            frame->zoneNs[frame->spans[span].zone] += frame->endNs - frame->spans[span].startNs;
+        }
+    }
+
+    // 워커 누적 시간 합산
+    for (int w = 0; w < THREAD_POOL_MAX_THREADS; w++) {
+        for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+            if (profiler.work[w].ns[z] > 0) {
+                frame->zoneNs[z] += profiler.work[w].ns[z];
+                frame->workMask |= 1u << z;
+            }
+        }
+    }
+
+    profiler.history[profiler.historyHead] = *frame;
+    profiler.historyHead = (profiler.historyHead + 1) % PROFILER_HISTORY_FRAMES;
+    if (profiler.historyCount < PROFILER_HISTORY_FRAMES) {
+        profiler.historyCount++;
+    }
+    profiler.inFrame = false;
+}
+
+void Profiler_BeginZone(ProfileZone zone) {
+    if (!profiler.inFrame || profiler.depth >= PROFILER_MAX_DEPTH) return;
+
+    ProfileFrame* frame = &profiler.current;
+    int span = -1;
+    if (frame->spanCount < PROFILER_MAX_SPANS_PER_FRAME) {
+        span = frame->spanCount++;
+        frame->spans[span].zone = (uint8_t)zone;
+        frame->spans[span].depth = (uint8_t)profiler.depth;
+        frame->spans[span].startNs = Profiler_NowNs();
+        frame->spans[span].endNs = frame->spans[span].startNs;
+    }
+    profiler.openSpans[profiler.depth++] = span;
+}
+
+void Profiler_EndZone(ProfileZone zone) {
+    if (!profiler.inFrame || profiler.depth == 0) return;
+
+    ProfileFrame* frame = &profiler.current;
+    int span = profiler.openSpans[--profiler.depth];
+    if (span < 0) return;   // Span buffer was full when the zone began
+
+    ProfileSpan* s = &frame->spans[span];
+    if (s->zone != (uint8_t)zone) {
+        printf("Profiler: zone '%s' ended while '%s' is open\n",
+               Profiler_GetZoneName(zone), Profiler_GetZoneName((ProfileZone)s->zone));
+    }
+    s->endNs = Profiler_NowNs();
+    frame->zoneNs[s->zone] += s->endNs - s->startNs;
+}
+
+void Profiler_AddWork(ProfileZone zone, uint64_t ns) {
+    if (zone < 0 || zone >= PROFILE_ZONE_COUNT) return;
+    int worker = ThreadPool_GetCurrentWorker();
+    if (worker < 0) worker = 0;
+    profiler.work[worker].ns[zone] += ns;
+}
+
+int Profiler_GetFrameCount(void) {
+    return profiler.historyCount;
+}
+
+const ProfileFrame* Profiler_GetFrame(int framesAgo) {
+    if (framesAgo < 0 || framesAgo >= profiler.historyCount) return NULL;
+    int slot = (profiler.historyHead - 1 - framesAgo + PROFILER_HISTORY_FRAMES) % PROFILER_HISTORY_FRAMES;
+    return &profiler.history[slot];
+}
+
+float Profiler_GetAverageMs(ProfileZone zone, int frames) {
+    if (frames > profiler.historyCount) frames = profiler.historyCount;
+    if (frames <= 0) return 0.0f;
+
+    uint64_t total = 0;
+    for (int i = 0; i < frames; i++) {
+        const ProfileFrame* frame = Profiler_GetFrame(i);
+        if (zone >= 0 && zone < PROFILE_ZONE_COUNT) {
+            total += frame->zoneNs[zone];
+        } else {
+            total += frame->endNs - frame->startNs;
+        }
+    }
+    return (float)((double)total / (double)frames * 1e-6);
+}
+
+bool Profiler_WriteChromeTrace(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("Profiler: cannot write trace to %s\n", path);
+        return false;
+    }
+
+    // 가장 오래된 프레임 시작을 0 으로 (마이크로초 단위)
+    int frames = profiler.historyCount;
+    uint64_t origin = (frames > 0) ? Profiler_GetFrame(frames - 1)->startNs : 0;
+    bool first = true;
+
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (int i = frames - 1; i >= 0; i--) {
+        const ProfileFrame* frame = Profiler_GetFrame(i);
+        double frameTs = (double)(frame->startNs - origin) * 1e-3;
+
+        fprintf(file, "%s{\"name\":\"frame %llu\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                      "\"ts\":%.3f,\"dur\":%.3f}",
+                first ? "" : ",\n", (unsigned long long)frame->index,
+                frameTs, (double)(frame->endNs - frame->startNs) * 1e-3);
+        first = false;
+
+        for (int s = 0; s < frame->spanCount; s++) {
+            const ProfileSpan* span = &frame->spans[s];
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+                          "\"ts\":%.3f,\"dur\":%.3f}",
+                    ZONE_NAMES[span->zone],
+                    (double)(span->startNs - origin) * 1e-3,
+                    (double)(span->endNs - span->startNs) * 1e-3);
+        }
+
+        // 여러 스레드에 걸친 누적 시간은 카운터로 기록
+        for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+            if (!(frame->workMask & (1u << z))) continue;
+            fprintf(file, ",\n{\"name\":\"%s cpu ms\",\"cat\":\"work\",\"ph\":\"C\",\"pid\":1,"
+                          "\"ts\":%.3f,\"args\":{\"ms\":%.4f}}",
+                    ZONE_NAMES[z], frameTs, (double)frame->zoneNs[z] * 1e-6);
+        }
+    }
+    fprintf(file, "\n]}\n");
+    fclose(file);
+
+    printf("Profiler: wrote %d frames to %s\n", frames, path);
+    return true;
+}
+
+void Profiler_Reset(void) {
+    profiler.historyHead = 0;
+    profiler.historyCount = 0;
+    profiler.inFrame = false;
+    profiler.depth = 0;
+}
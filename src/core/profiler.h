@@ -0,0 +1,112 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Scoped frame profiler
+ *
+ * PROFILE_BEGIN/PROFILE_END mark a phase on the main thread. Zones may nest
+ * and the same zone may run several times per frame; the frame keeps every
+ * span for the trace and a per-zone total for the overlay. Work spread over
+ * ParallelFor workers is summed with PROFILE_WORK_BEGIN/END instead, which
+ * reports CPU time across threads rather than a span.
+ *
+ * The last PROFILER_HISTORY_FRAMES frames are kept in a ring buffer and can
+ * be written as Chrome trace_event JSON (chrome://tracing, Perfetto).
+ *
+ * Build with -DPROFILER_ENABLED=0 to compile every macro to nothing.
+ */
+
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#define PROFILER_HISTORY_FRAMES 240
+#define PROFILER_MAX_SPANS_PER_FRAME 64
+#define PROFILER_MAX_DEPTH 16
+
+typedef enum ProfileZone {
+    PROFILE_ZONE_STAGE = 0,     // UpdateStageSystem
+    PROFILE_ZONE_PLAYER,        // UpdatePlayer
+    PROFILE_ZONE_ENEMY_AI,      // Enemy AI, movement and spawning
+    PROFILE_ZONE_GRAVITY,       // Grid-culled gravity pass (nested in PROFILE_ZONE_PARTICLES)
+    PROFILE_ZONE_PARTICLES,     // UpdateAllParticles (fused pass)
+    PROFILE_ZONE_COLLISIONS,    // Enemy-particle and player-enemy collisions
+    PROFILE_ZONE_ITEMS,         // Item update and pickup
+    PROFILE_ZONE_EXPLOSIONS,    // Explosion particles
+    PROFILE_ZONE_EVENTS,        // ProcessEventQueue
+    PROFILE_ZONE_DRAW,          // DrawGame
+    PROFILE_ZONE_PARTICLE_RASTER,  // CPU particle rasterizer span (nested in PROFILE_ZONE_DRAW)
+    PROFILE_ZONE_PARTICLE_RASTER_WORK,  // Rasterizer CPU time summed over workers (PROFILE_WORK_*)
+    PROFILE_ZONE_CAPTURE,       // Copying the frame into the capture ring (--capture)
+    PROFILE_ZONE_COUNT
+} ProfileZone;
+
+typedef struct ProfileSpan {
+    uint8_t zone;
+    uint8_t depth;
+    uint64_t startNs;
+    uint64_t endNs;
+} ProfileSpan;
+
+typedef struct ProfileFrame {
+    uint64_t index;
+    uint64_t startNs;
+    uint64_t endNs;
+    ProfileSpan spans[PROFILER_MAX_SPANS_PER_FRAME];
+    int spanCount;
+    uint64_t zoneNs[PROFILE_ZONE_COUNT];    // Total per zone (spans + accumulated work)
+    uint32_t workMask;                      // Zones that received Profiler_AddWork time
+} ProfileFrame;
+
+// 단조 증가 시계 (나노초)
+uint64_t Profiler_NowNs(void);
+
+// 프레임 경계 (메인 루프 시작/끝에서 호출)
+void Profiler_BeginFrame(void);
+void Profiler_EndFrame(void);
+
+// 메인 스레드 구간 (중첩 가능)
+void Profiler_BeginZone(ProfileZone zone);
+void Profiler_EndZone(ProfileZone zone);
+
+// Add CPU time to a zone from any thread (inside or outside ParallelFor)
+void Profiler_AddWork(ProfileZone zone, uint64_t ns);
+
+const char* Profiler_GetZoneName(ProfileZone zone);
+
+// Completed frames in the ring buffer (at most PROFILER_HISTORY_FRAMES)
+int Profiler_GetFrameCount(void);
+// 0 = most recent completed frame; NULL if out of range
+const ProfileFrame* Profiler_GetFrame(int framesAgo);
+// Average milliseconds per frame for a zone (or the whole frame with zone = PROFILE_ZONE_COUNT)
+float Profiler_GetAverageMs(ProfileZone zone, int frames);
+
+/**
+ * @brief Write the recorded frames as Chrome trace_event JSON
+ * @return true if the file was written
+ */
+bool Profiler_WriteChromeTrace(const char* path);
+
+// 기록된 프레임 모두 삭제
+void Profiler_Reset(void);
+
+#if PROFILER_ENABLED
+#define PROFILE_FRAME_BEGIN() Profiler_BeginFrame()
+#define PROFILE_FRAME_END() Profiler_EndFrame()
+#define PROFILE_BEGIN(zone) Profiler_BeginZone(zone)
+#define PROFILE_END(zone) Profiler_EndZone(zone)
+#define PROFILE_WORK_BEGIN(var) uint64_t var = Profiler_NowNs()
+#define PROFILE_WORK_END(zone, var) Profiler_AddWork((zone), Profiler_NowNs() - (var))
+#else
+#define PROFILE_FRAME_BEGIN() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define PROFILE_BEGIN(zone) ((void)0)
+#define PROFILE_END(zone) ((void)0)
+#define PROFILE_WORK_BEGIN(var) ((void)0)
+#define PROFILE_WORK_END(zone, var) ((void)0)
+#endif
+
+#endif // PROFILER_H
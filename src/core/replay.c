@@ -0,0 +1,233 @@
+#include "replay.h"
+#include "profiler.h"
+#include "raylib.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ReplayKey 순서와 같은 raylib 키 코드
+static const int REPLAY_KEY_CODES[REPLAY_KEY_COUNT] = {
+    KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT,
+    KEY_W, KEY_A, KEY_S, KEY_D,
+    KEY_SPACE, KEY_LEFT_SHIFT, KEY_ENTER, KEY_ESCAPE, KEY_BACKSPACE
+};
+
+typedef struct ReplayFrame {
+    uint16_t keys;
+    float deltaTime;
+} ReplayFrame;
+
+// 파일에 기록되는 프레임 하나의 크기 (keys, deltaTime 을 따로 쓰므로 구조체 패딩 없음)
+#define REPLAY_FRAME_SIZE (sizeof(uint16_t) + sizeof(float))
+
+static struct {
+    ReplayMode mode;
+    FILE* file;
+    ReplayHeader header;
+    uint32_t frameIndex;
+    uint16_t keys;              // 이번 프레임 키 상태
+    uint16_t previousKeys;      // 지난 프레임 키 상태 (Pressed/Released 판정)
+    float deltaTime;
+    double time;                // 누적 게임 시간
+    float* frameMs;             // 재생 중 프레임별 실제 소요 시간
+    uint64_t lastFrameNs;
+} replay;
+
+int Replay_KeyBit(int key) {
+    for (int i = 0; i < REPLAY_KEY_COUNT; i++) {
+        if (REPLAY_KEY_CODES[i] == key) return i;
+    }
+    return -1;
+}
+
+static void ResetState(ReplayMode mode) {
+    replay.mode = mode;
+    replay.frameIndex = 0;
+    replay.keys = 0;
+    replay.previousKeys = 0;
+    replay.deltaTime = 0.0f;
+    replay.time = 0.0;
+    replay.lastFrameNs = 0;
+}
+
+bool Replay_StartRecording(const char* path, const ReplayHeader* header) {
+    Replay_Stop();
+
+    replay.file = fopen(path, "wb");
+    if (!replay.file) {
+        printf("Replay: cannot open %s for writing\n", path);
+        return false;
+    }
+
+    replay.header = *header;
+    replay.header.magic = REPLAY_MAGIC;
+    replay.header.version = REPLAY_VERSION;
+    replay.header.frameCount = 0;
+    fwrite(&replay.header, sizeof(ReplayHeader), 1, replay.file);
+
+    ResetState(REPLAY_MODE_RECORD);
+    printf("Replay: recording to %s\n", path);
+    return true;
+}
+
+bool Replay_StartPlayback(const char* path, ReplayHeader* header) {
+    Replay_Stop();
+
+    replay.file = fopen(path, "rb");
+    if (!replay.file) {
+        printf("Replay: cannot open %s\n", path);
+        return false;
+    }
+
+    if (fread(&replay.header, sizeof(ReplayHeader), 1, replay.file) != 1 ||
+        replay.header.magic != REPLAY_MAGIC || replay.header.version != REPLAY_VERSION) {
+        printf("Replay: %s is not a version %d replay file\n", path, REPLAY_VERSION);
+        fclose(replay.file);
+        replay.file = NULL;
+        return false;
+    }
+
+    // 헤더의 프레임 수는 파일에 실제로 들어 있는 프레임 수를 넘지 않도록 제한
+    long dataStart = ftell(replay.file);
+    fseek(replay.file, 0, SEEK_END);
+    long dataEnd = ftell(replay.file);
+    fseek(replay.file, dataStart, SEEK_SET);
+    uint32_t storedFrames = (dataEnd > dataStart) ? (uint32_t)((dataEnd - dataStart) / REPLAY_FRAME_SIZE) : 0;
+    if (replay.header.frameCount > storedFrames) {
+        printf("Replay: %s header claims %u frames but holds %u\n", path, replay.header.frameCount, storedFrames);
+        replay.header.frameCount = storedFrames;
+    }
+
+    replay.frameMs = (float*)malloc(((size_t)replay.header.frameCount + 1) * sizeof(float));
+    if (!replay.frameMs) {
+        printf("Replay: out of memory for %u frame times\n", replay.header.frameCount);
+        fclose(replay.file);
+        replay.file = NULL;
+        return false;
+    }
+    *header = replay.header;
+    ResetState(REPLAY_MODE_PLAYBACK);
+    printf("Replay: playing %u frames from %s\n", replay.header.frameCount, path);
+    return true;
+}
+
+static int CompareFloat(const void* a, const void* b) {
+    float fa = *(const float*)a;
+    float fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+// 재생한 프레임들의 실제 소요 시간 통계
+static void PrintPlaybackStats(void) {
+    int count = (int)replay.frameIndex;
+    if (count == 0 || !replay.frameMs) return;
+
+    // 마지막 프레임은 다음 BeginFrame 이 없으므로 종료 시점까지로 계산
+    replay.frameMs[count - 1] = (float)((double)(Profiler_NowNs() - replay.lastFrameNs) * 1e-6);
+
+    double total = 0.0;
+    for (int i = 0; i < count; i++) total += replay.frameMs[i];
+    qsort(replay.frameMs, count, sizeof(float), CompareFloat);
+
+    printf("Replay: %d frames in %.3f s, frame ms mean %.3f  min %.3f  median %.3f  p99 %.3f  max %.3f\n",
+           count, total * 1e-3, total / count,
+           replay.frameMs[0], replay.frameMs[count / 2],
+           replay.frameMs[(count * 99 + 99) / 100 - 1], replay.frameMs[count - 1]);
+}
+
+void Replay_Stop(void) {
+    if (replay.mode == REPLAY_MODE_RECORD && replay.file) {
+        // 헤더의 프레임 수 갱신
+        replay.header.frameCount = replay.frameIndex;
+        fseek(replay.file, (long)offsetof(ReplayHeader, frameCount), SEEK_SET);
+        fwrite(&replay.header.frameCount, sizeof(uint32_t), 1, replay.file);
+        printf("Replay: recorded %u frames\n", replay.frameIndex);
+    } else if (replay.mode == REPLAY_MODE_PLAYBACK) {
+        PrintPlaybackStats();
+    }
+
+    if (replay.file) {
+        fclose(replay.file);
+        replay.file = NULL;
+    }
+    free(replay.frameMs);
+    replay.frameMs = NULL;
+    replay.mode = REPLAY_MODE_OFF;
+}
+
+ReplayMode Replay_GetMode(void) {
+    return replay.mode;
+}
+
+uint32_t Replay_GetFrameIndex(void) {
+    return replay.frameIndex;
+}
+
+bool Replay_IsFinished(void) {
+    return replay.mode == REPLAY_MODE_PLAYBACK && replay.frameIndex >= replay.header.frameCount;
+}
+
+void Replay_BeginFrame(void) {
+    if (replay.mode == REPLAY_MODE_OFF) return;
+
+    ReplayFrame frame = {0};
+    replay.previousKeys = replay.keys;
+
+    if (replay.mode == REPLAY_MODE_RECORD) {
+        for (int i = 0; i < REPLAY_KEY_COUNT; i++) {
+            if (IsKeyDown(REPLAY_KEY_CODES[i])) frame.keys |= (uint16_t)(1u << i);
+        }
+        frame.deltaTime = GetFrameTime();
+        fwrite(&frame.keys, sizeof(frame.keys), 1, replay.file);
+        fwrite(&frame.deltaTime, sizeof(frame.deltaTime), 1, replay.file);
+    } else {
+        if (replay.frameIndex >= replay.header.frameCount) return;
+        if (fread(&frame.keys, sizeof(frame.keys), 1, replay.file) != 1 ||
+            fread(&frame.deltaTime, sizeof(frame.deltaTime), 1, replay.file) != 1) {
+            printf("Replay: file ends after %u of %u frames\n", replay.frameIndex, replay.header.frameCount);
+            replay.header.frameCount = replay.frameIndex;
+            return;
+        }
+
+        uint64_t now = Profiler_NowNs();
+        if (replay.frameIndex > 0) {
+            replay.frameMs[replay.frameIndex - 1] = (float)((double)(now - replay.lastFrameNs) * 1e-6);
+        }
+        replay.lastFrameNs = now;
+    }
+
+    replay.keys = frame.keys;
+    replay.deltaTime = frame.deltaTime;
+    replay.time += frame.deltaTime;
+    replay.frameIndex++;
+}
+
+static bool IsBitSet(uint16_t keys, int key) {
+    int bit = Replay_KeyBit(key);
+    return bit >= 0 && (keys & (1u << bit));
+}
+
+bool Replay_IsKeyDown(int key) {
+    if (replay.mode == REPLAY_MODE_OFF) return IsKeyDown(key);
+    return IsBitSet(replay.keys, key);
+}
+
+bool Replay_IsKeyPressed(int key) {
+    if (replay.mode == REPLAY_MODE_OFF) return IsKeyPressed(key);
+    return IsBitSet(replay.keys, key) && !IsBitSet(replay.previousKeys, key);
+}
+
+bool Replay_IsKeyReleased(int key) {
+    if (replay.mode == REPLAY_MODE_OFF) return IsKeyReleased(key);
+    return !IsBitSet(replay.keys, key) && IsBitSet(replay.previousKeys, key);
+}
+
+float Replay_GetFrameTime(void) {
+    if (replay.mode == REPLAY_MODE_OFF) return GetFrameTime();
+    return replay.deltaTime;
+}
+
+double Replay_GetTime(void) {
+    if (replay.mode == REPLAY_MODE_OFF) return GetTime();
+    return replay.time;
+}
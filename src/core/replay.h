@@ -0,0 +1,94 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Input recording and replay
+ *
+ * Gameplay code reads keys and time through Replay_* instead of raylib.
+ * With replay off these forward to raylib unchanged. While recording, the
+ * keys the game uses are sampled once per frame into a bitmask and written
+ * together with the frame's delta time; during playback the same masks and
+ * deltas are read back, so a seeded session re-simulates identically
+ * (text entry and the test mode mouse are not recorded).
+ *
+ * File layout (little-endian): ReplayHeader, then per frame a uint16_t key
+ * mask and a float delta time.
+ */
+
+#define REPLAY_MAGIC 0x50525350u    // "PSRP"
+#define REPLAY_VERSION 4
+
+typedef enum ReplayMode {
+    REPLAY_MODE_OFF = 0,
+    REPLAY_MODE_RECORD,
+    REPLAY_MODE_PLAYBACK
+} ReplayMode;
+
+// Keys captured per frame (one bit each)
+typedef enum ReplayKey {
+    REPLAY_KEY_UP = 0,
+    REPLAY_KEY_DOWN,
+    REPLAY_KEY_LEFT,
+    REPLAY_KEY_RIGHT,
+    REPLAY_KEY_W,
+    REPLAY_KEY_A,
+    REPLAY_KEY_S,
+    REPLAY_KEY_D,
+    REPLAY_KEY_SPACE,
+    REPLAY_KEY_LEFT_SHIFT,
+    REPLAY_KEY_ENTER,
+    REPLAY_KEY_ESCAPE,
+    REPLAY_KEY_BACKSPACE,
+    REPLAY_KEY_COUNT
+} ReplayKey;
+
+// Everything needed to start the same session again
+typedef struct ReplayHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t seed;
+    int32_t startingStage;      // 0 = normal start
+    int32_t testMode;
+    int32_t particleCount;
+    int32_t enemyCapacity;
+    int32_t gravityMode;        // GravityMode the session ran with
+    int32_t simRate;            // Fixed simulation steps per second
+    uint32_t frameCount;        // Filled in when recording stops
+} ReplayHeader;
+
+// 녹화 시작 (header 의 frameCount 는 무시되고 종료 시 기록)
+bool Replay_StartRecording(const char* path, const ReplayHeader* header);
+// 재생 시작, 파일 헤더를 header 에 반환
+bool Replay_StartPlayback(const char* path, ReplayHeader* header);
+// 녹화 파일 마무리 / 재생 종료
+void Replay_Stop(void);
+
+ReplayMode Replay_GetMode(void);
+// Frames recorded or played back so far
+uint32_t Replay_GetFrameIndex(void);
+// true once playback has consumed every recorded frame
+bool Replay_IsFinished(void);
+
+/**
+ * @brief Latch this frame's input and delta time (call once at the top of each frame)
+ *
+ * Record: samples raylib and appends the frame. Playback: reads the next frame.
+ */
+void Replay_BeginFrame(void);
+
+// Key queries for gameplay code (raylib key codes; unrecorded keys read as up)
+bool Replay_IsKeyDown(int key);
+bool Replay_IsKeyPressed(int key);
+bool Replay_IsKeyReleased(int key);
+
+// Frame delta and elapsed game time (recorded values while recording/replaying)
+float Replay_GetFrameTime(void);
+double Replay_GetTime(void);
+
+// Convert between raylib key codes and mask bits (-1 if the key is not recorded)
+int Replay_KeyBit(int key);
+
+#endif // REPLAY_H
@@ -0,0 +1,167 @@
+#include "rng.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RNG_SSE2 1
+#endif
+
+// Philox4x32 상수 (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3")
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+static uint64_t g_rngSeed = 0x853C49E6748FEA9Bull;
+
+void Rng_SetSeed(uint64_t seed) {
+    g_rngSeed = seed;
+}
+
+uint64_t Rng_GetSeed(void) {
+    return g_rngSeed;
+}
+
+// 카운터 배치: {counter 하위, counter 상위, lane, stream}, 키: 시드
+static inline void PhiloxBlock(uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3, uint32_t out[4]) {
+    uint32_t k0 = (uint32_t)g_rngSeed;
+    uint32_t k1 = (uint32_t)(g_rngSeed >> 32);
+
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c0 = n0;
+        c1 = (uint32_t)p1;
+        c2 = n2;
+        c3 = (uint32_t)p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+void Rng_Block(RngStream stream, uint32_t lane, uint64_t counter, uint32_t out[4]) {
+    PhiloxBlock((uint32_t)counter, (uint32_t)(counter >> 32), lane, (uint32_t)stream, out);
+}
+
+float Rng_UniformAt(RngStream stream, uint32_t lane, uint64_t counter) {
+    uint32_t words[4];
+    Rng_Block(stream, lane, counter, words);
+    return Rng_ToUnitFloat(words[0]);
+}
+
+#ifdef RNG_SSE2
+// 4개 레인의 32x32 곱셈 → 상위/하위 32비트
+static inline void MulHiLo4(__m128i a, __m128i m, __m128i* hi, __m128i* lo) {
+    __m128i even = _mm_mul_epu32(a, m);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    *lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                             _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    *hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 3, 1)),
+                             _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 3, 1)));
+}
+
+static inline __m128 ToUnitFloat4(__m128i words) {
+    return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(words, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+}
+
+// 연속된 카운터 4개의 블록을 한 번에 계산해 16개 값 출력 (out[4*b + w] = 블록 b 의 w 번째 워드)
+static void FillBlocks4(uint32_t stream, uint32_t lane, uint64_t counter, float* out, float min, float scale) {
+    __m128i c0 = _mm_setr_epi32((int)(uint32_t)counter, (int)(uint32_t)(counter + 1),
+                                (int)(uint32_t)(counter + 2), (int)(uint32_t)(counter + 3));
+    __m128i c1 = _mm_setr_epi32((int)(uint32_t)(counter >> 32), (int)(uint32_t)((counter + 1) >> 32),
+                                (int)(uint32_t)((counter + 2) >> 32), (int)(uint32_t)((counter + 3) >> 32));
+    __m128i c2 = _mm_set1_epi32((int)lane);
+    __m128i c3 = _mm_set1_epi32((int)stream);
+    __m128i m0 = _mm_set1_epi32((int)PHILOX_M0);
+    __m128i m1 = _mm_set1_epi32((int)PHILOX_M1);
+    uint32_t k0 = (uint32_t)g_rngSeed;
+    uint32_t k1 = (uint32_t)(g_rngSeed >> 32);
+
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        __m128i hi0, lo0, hi1, lo1;
+        MulHiLo4(c0, m0, &hi0, &lo0);
+        MulHiLo4(c2, m1, &hi1, &lo1);
+        c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), _mm_set1_epi32((int)k0));
+        c1 = lo1;
+        c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), _mm_set1_epi32((int)k1));
+        c3 = lo0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    __m128 f0 = ToUnitFloat4(c0);
+    __m128 f1 = ToUnitFloat4(c1);
+    __m128 f2 = ToUnitFloat4(c2);
+    __m128 f3 = ToUnitFloat4(c3);
+    _MM_TRANSPOSE4_PS(f0, f1, f2, f3);
+
+    __m128 vmin = _mm_set1_ps(min);
+    __m128 vscale = _mm_set1_ps(scale);
+    _mm_storeu_ps(out + 0, _mm_add_ps(vmin, _mm_mul_ps(f0, vscale)));
+    _mm_storeu_ps(out + 4, _mm_add_ps(vmin, _mm_mul_ps(f1, vscale)));
+    _mm_storeu_ps(out + 8, _mm_add_ps(vmin, _mm_mul_ps(f2, vscale)));
+    _mm_storeu_ps(out + 12, _mm_add_ps(vmin, _mm_mul_ps(f3, vscale)));
+}
+#endif
+
+void Rng_FillUniform(RngStream stream, uint32_t lane, uint64_t firstCounter,
+                     float* out, int count, float min, float max) {
+    float scale = max - min;
+    uint64_t counter = firstCounter;
+    int i = 0;
+
+#ifdef RNG_SSE2
+    for (; i + 16 <= count; i += 16, counter += 4) {
+        FillBlocks4((uint32_t)stream, lane, counter, out + i, min, scale);
+    }
+#endif
+
+    for (; i < count; i += 4, counter++) {
+        uint32_t words[4];
+        Rng_Block(stream, lane, counter, words);
+        for (int w = 0; w < 4 && i + w < count; w++) {
+            out[i + w] = min + Rng_ToUnitFloat(words[w]) * scale;
+        }
+    }
+}
+
+void Rng_Init(Rng* rng, RngStream stream, uint32_t lane) {
+    rng->stream = (uint32_t)stream;
+    rng->lane = lane;
+    rng->counter = 0;
+    rng->next = 4;
+}
+
+uint32_t Rng_NextU32(Rng* rng) {
+    if (rng->next >= 4) {
+        Rng_Block((RngStream)rng->stream, rng->lane, rng->counter++, rng->words);
+        rng->next = 0;
+    }
+    return rng->words[rng->next++];
+}
+
+float Rng_NextFloat(Rng* rng) {
+    return Rng_ToUnitFloat(Rng_NextU32(rng));
+}
+
+int Rng_NextInt(Rng* rng, int min, int max) {
+    if (min > max) {
+        int swap = min;
+        min = max;
+        max = swap;
+    }
+    // 나머지 연산 대신 64비트 곱의 상위 32비트로 범위 축소
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+    return (int)((int64_t)min + (int64_t)(((uint64_t)Rng_NextU32(rng) * range) >> 32));
+}
+
+bool Rng_Chance(Rng* rng, float probability) {
+    return Rng_NextFloat(rng) < probability;
+}
@@ -0,0 +1,68 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Counter-based random numbers (Philox4x32-10)
+ *
+ * Every value is a pure function of (seed, stream, lane, counter), so there is
+ * no shared generator state: parallel loops can draw numbers for particle i
+ * from lane i without locks, and the result does not depend on thread count
+ * or evaluation order. One block evaluation yields four 32-bit values.
+ */
+
+// Independent streams per subsystem (the stream id is part of the counter)
+typedef enum RngStream {
+    RNG_STREAM_PARTICLE_INIT = 0,   // Initial particle positions/velocities
+    RNG_STREAM_PARTICLE_FORCE,      // Per-particle chance in force operators
+    RNG_STREAM_GAMEPLAY,            // Sequential draws on the main thread
+    RNG_STREAM_COUNT
+} RngStream;
+
+// Sequential generator over one (stream, lane), for code that draws a few numbers at a time
+typedef struct Rng {
+    uint32_t stream;
+    uint32_t lane;
+    uint64_t counter;       // Next block to evaluate
+    uint32_t words[4];      // Current block
+    int next;               // Next unused word in `words` (4 = exhausted)
+} Rng;
+
+// 전역 시드 설정/조회 (모든 스트림이 공유)
+void Rng_SetSeed(uint64_t seed);
+uint64_t Rng_GetSeed(void);
+
+// Raw Philox block for (stream, lane, counter) under the current seed
+void Rng_Block(RngStream stream, uint32_t lane, uint64_t counter, uint32_t out[4]);
+
+// Uniform float in [0, 1) from the first word of block (stream, lane, counter)
+float Rng_UniformAt(RngStream stream, uint32_t lane, uint64_t counter);
+
+/**
+ * @brief Fill out[0..count) with uniform floats in [min, max)
+ *
+ * out[i] is word i % 4 of block (stream, lane, firstCounter + i / 4), so any
+ * sub-range can be regenerated independently. Four blocks are evaluated at a
+ * time with SSE2 when available; the scalar path produces identical values.
+ */
+void Rng_FillUniform(RngStream stream, uint32_t lane, uint64_t firstCounter,
+                     float* out, int count, float min, float max);
+
+// 순차 생성기 (stream, lane 조합마다 독립)
+void Rng_Init(Rng* rng, RngStream stream, uint32_t lane);
+uint32_t Rng_NextU32(Rng* rng);
+// Uniform float in [0, 1)
+float Rng_NextFloat(Rng* rng);
+// Uniform int in [min, max] (same contract as GetRandomValue)
+int Rng_NextInt(Rng* rng, int min, int max);
+// true with the given probability
+bool Rng_Chance(Rng* rng, float probability);
+
+// Convert a 32-bit word to a float in [0, 1) (top 24 bits, exact in float)
+static inline float Rng_ToUnitFloat(uint32_t word) {
+    return (float)(word >> 8) * (1.0f / 16777216.0f);
+}
+
+#endif // RNG_H
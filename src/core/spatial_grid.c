@@ -0,0 +1,152 @@
+#include "spatial_grid.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool SpatialGrid_Init(SpatialGrid* grid, int screenWidth, int screenHeight, float cellSize, int particleCount) {
+    memset(grid, 0, sizeof(SpatialGrid));
+    if (cellSize <= 0.0f || particleCount < 0) return false;
+
+    grid->cellSize = cellSize;
+    grid->invCellSize = 1.0f / cellSize;
+    grid->cols = (int)(screenWidth / cellSize) + 1;
+    grid->rows = (int)(screenHeight / cellSize) + 1;
+    grid->cellCount = grid->cols * grid->rows;
+    grid->particleCount = particleCount;
+
+    size_t particleBytes = (size_t)(particleCount > 0 ? particleCount : 1) * sizeof(int);
+    grid->cellStart = (int*)calloc(grid->cellCount + 1, sizeof(int));
+    grid->sorted = (int*)malloc(particleBytes);
+    grid->slotOf = (int*)malloc(particleBytes);
+    grid->cellOf = (int*)malloc(particleBytes);
+    grid->nextCell = (int*)malloc(particleBytes);
+
+    if (!grid->cellStart || !grid->sorted || !grid->slotOf || !grid->cellOf || !grid->nextCell) {
+        SpatialGrid_Destroy(grid);
+        return false;
+    }
+    return true;
+}
+
+void SpatialGrid_Destroy(SpatialGrid* grid) {
+    free(grid->cellStart);
+    free(grid->sorted);
+    free(grid->slotOf);
+    free(grid->cellOf);
+    free(grid->nextCell);
+    memset(grid, 0, sizeof(SpatialGrid));
+}
+
+static void ComputeCells(SpatialGrid* grid, const ParticleBuffer* particles, int* cells) {
+    for (int p = 0; p < grid->particleCount; p++) {
+        cells[p] = SpatialGrid_CellOf(grid, particles->x[p], particles->y[p]);
+    }
+}
+
+// cellOf 기준 카운팅 정렬 (cellStart, sorted, slotOf 재작성)
+static void CountingSort(SpatialGrid* grid) {
+    int* cellStart = grid->cellStart;
+    memset(cellStart, 0, (grid->cellCount + 1) * sizeof(int));
+
+    for (int p = 0; p < grid->particleCount; p++) {
+        cellStart[grid->cellOf[p] + 1]++;
+    }
+    for (int c = 0; c < grid->cellCount; c++) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    // nextCell 을 셀별 쓰기 커서로 재사용
+    int* cursor = grid->nextCell;
+    memcpy(cursor, cellStart, grid->cellCount * sizeof(int));
+    for (int p = 0; p < grid->particleCount; p++) {
+        int slot = cursor[grid->cellOf[p]]++;
+        grid->sorted[slot] = p;
+        grid->slotOf[p] = slot;
+    }
+}
+
+void SpatialGrid_Rebuild(SpatialGrid* grid, const ParticleBuffer* particles) {
+    ComputeCells(grid, particles, grid->cellOf);
+    CountingSort(grid);
+    grid->built = true;
+    grid->lastMoved = grid->particleCount;
+    grid->lastRebuilt = true;
+}
+
+static inline void SwapSlots(SpatialGrid* grid, int slotA, int slotB) {
+    int a = grid->sorted[slotA];
+    int b = grid->sorted[slotB];
+    grid->sorted[slotA] = b;
+    grid->sorted[slotB] = a;
+    grid->slotOf[b] = slotA;
+    grid->slotOf[a] = slotB;
+}
+
+/**
+ * Move one particle between cells by rotating it across the cell boundaries
+ * in between: swap it to the edge of its cell, shift that boundary by one,
+ * repeat. Costs one swap per cell crossed, nothing else in `sorted` moves.
+ */
+static void MoveParticleCell(SpatialGrid* grid, int particle, int fromCell, int toCell) {
+    int slot = grid->slotOf[particle];
+
+    if (fromCell < toCell) {
+        for (int c = fromCell; c < toCell; c++) {
+            int last = grid->cellStart[c + 1] - 1;
+            SwapSlots(grid, slot, last);
+            grid->cellStart[c + 1]--;
+            slot = last;
+        }
+    } else {
+        for (int c = fromCell; c > toCell; c--) {
+            int first = grid->cellStart[c];
+            SwapSlots(grid, slot, first);
+            grid->cellStart[c]++;
+            slot = first;
+        }
+    }
+    grid->cellOf[particle] = toCell;
+}
+
+void SpatialGrid_Update(SpatialGrid* grid, const ParticleBuffer* particles) {
+    // Init 이 실패한 그리드는 할당된 배열이 없음
+    if (!grid->cellStart) return;
+    if (!grid->built) {
+        SpatialGrid_Rebuild(grid, particles);
+        return;
+    }
+
+    // 새 셀 계산과 함께 증분 갱신 비용(경계 회전 횟수) 추정
+    ComputeCells(grid, particles, grid->nextCell);
+    int moved = 0;
+    long long rotations = 0;
+    for (int p = 0; p < grid->particleCount; p++) {
+        int delta = grid->nextCell[p] - grid->cellOf[p];
+        if (delta != 0) {
+            moved++;
+            rotations += delta > 0 ? delta : -delta;
+        }
+    }
+
+    grid->lastMoved = moved;
+    if (moved == 0) {
+        grid->lastRebuilt = false;
+        return;
+    }
+
+    // 회전(스왑)은 임의 접근이라 순차 재구성보다 원소당 몇 배 비쌈 → 파티클 수의 절반을 넘으면 재구성
+    if (rotations * 2 > grid->particleCount) {
+        int* swap = grid->cellOf;
+        grid->cellOf = grid->nextCell;
+        grid->nextCell = swap;
+        CountingSort(grid);
+        grid->lastRebuilt = true;
+        return;
+    }
+
+    for (int p = 0; p < grid->particleCount; p++) {
+        if (grid->nextCell[p] != grid->cellOf[p]) {
+            MoveParticleCell(grid, p, grid->cellOf[p], grid->nextCell[p]);
+        }
+    }
+    grid->lastRebuilt = false;
+}
@@ -0,0 +1,75 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "raylib.h"
+#include "../entities/particle_buffer.h"
+#include <stdbool.h>
+
+// Cell edge length in pixels (close to the smallest enemy radius)
+#define PARTICLE_GRID_CELL_SIZE 16.0f
+
+/**
+ * @brief Uniform grid over particle positions in CSR layout
+ *
+ * Particle indices are sorted by cell (row-major), so each cell is a
+ * contiguous span of `sorted`, and a run of cells in one grid row is also
+ * contiguous. The grid is rebuilt with a counting sort, or patched in place
+ * when only a few particles changed cells since the last update.
+ */
+typedef struct SpatialGrid {
+    float cellSize;
+    float invCellSize;
+    int cols;
+    int rows;
+    int cellCount;
+    int particleCount;
+    int* cellStart;     // cellCount + 1 offsets into sorted
+    int* sorted;        // Particle indices grouped by cell
+    int* slotOf;        // Particle index -> position in sorted
+    int* cellOf;        // Particle index -> cell the grid currently files it under
+    int* nextCell;      // Scratch: cell computed this update
+    bool built;         // False until the first full rebuild
+    int lastMoved;      // Particles that changed cells in the last update
+    bool lastRebuilt;   // Whether the last update did a full rebuild
+} SpatialGrid;
+
+// 그리드 메모리 할당 (화면 크기와 파티클 수 기준)
+bool SpatialGrid_Init(SpatialGrid* grid, int screenWidth, int screenHeight, float cellSize, int particleCount);
+// 그리드 메모리 해제
+void SpatialGrid_Destroy(SpatialGrid* grid);
+// 현재 파티클 위치로 그리드 갱신 (이동량이 적으면 증분 갱신, 많으면 전체 재구성, Init 실패한 그리드는 무시)
+void SpatialGrid_Update(SpatialGrid* grid, const ParticleBuffer* particles);
+// 카운팅 정렬로 전체 재구성
+void SpatialGrid_Rebuild(SpatialGrid* grid, const ParticleBuffer* particles);
+
+// Cell column/row containing a coordinate (clamped to the grid)
+static inline int SpatialGrid_Col(const SpatialGrid* grid, float x) {
+    int col = (int)(x * grid->invCellSize);
+    if (col < 0) col = 0;
+    if (col >= grid->cols) col = grid->cols - 1;
+    return col;
+}
+
+static inline int SpatialGrid_Row(const SpatialGrid* grid, float y) {
+    int row = (int)(y * grid->invCellSize);
+    if (row < 0) row = 0;
+    if (row >= grid->rows) row = grid->rows - 1;
+    return row;
+}
+
+static inline int SpatialGrid_CellOf(const SpatialGrid* grid, float x, float y) {
+    return SpatialGrid_Row(grid, y) * grid->cols + SpatialGrid_Col(grid, x);
+}
+
+/**
+ * @brief Span of `sorted` covering columns [colBegin, colEnd] of one row
+ *
+ * Iterate grid->sorted[*begin .. *end) to visit every particle in those cells.
+ */
+static inline void SpatialGrid_RowSpan(const SpatialGrid* grid, int row, int colBegin, int colEnd,
+                                       int* begin, int* end) {
+    *begin = grid->cellStart[row * grid->cols + colBegin];
+    *end = grid->cellStart[row * grid->cols + colEnd + 1];
+}
+
+#endif // SPATIAL_GRID_H
@@ -0,0 +1,222 @@
+#include "thread_pool.h"
+#include <stdio.h>
+
+// 웹 빌드는 pthread 없이 빌드되므로 항상 메인 스레드에서 실행
+#if !defined(PLATFORM_WEB)
+#include <pthread.h>
+#define THREAD_POOL_HAS_THREADS 1
+#endif
+
+#if defined(_MSC_VER)
+#define THREAD_POOL_TLS __declspec(thread)
+#elif defined(THREAD_POOL_HAS_THREADS)
+#define THREAD_POOL_TLS __thread
+#else
+#define THREAD_POOL_TLS
+#endif
+
+// 호출 스레드의 워커 인덱스 (병렬 구간 밖의 메인 스레드는 -1)
+static THREAD_POOL_TLS int currentWorker = -1;
+static ThreadPoolJoinHook joinHook = NULL;
+
+// 메인 스레드에서 범위 하나를 처리 (그동안 현재 워커는 0)
+static void RunOnMainThread(ParallelForFunc func, int begin, int end, void* userData) {
+    currentWorker = 0;
+    func(begin, end, 0, userData);
+    currentWorker = -1;
+}
+
+static void FinishParallelFor(void) {
+    if (joinHook) {
+        joinHook();
+    }
+}
+
+int ThreadPool_GetCurrentWorker(void) {
+    return currentWorker;
+}
+
+void ThreadPool_SetJoinHook(ThreadPoolJoinHook hook) {
+    joinHook = hook;
+}
+
+#if defined(THREAD_POOL_HAS_THREADS)
+
+// 스레드 풀 내부 상태
+static struct {
+    pthread_t threads[THREAD_POOL_MAX_THREADS];
+    int workerIds[THREAD_POOL_MAX_THREADS];
+    int threadCount;            // 메인 스레드 포함
+    pthread_mutex_t mutex;
+    pthread_cond_t workReady;
+    pthread_cond_t workDone;
+    unsigned int generation;    // 새 작업마다 증가
+    int pending;                // 아직 끝나지 않은 워커 수
+    int parts;                  // 현재 작업을 나눈 범위 수
+    bool shuttingDown;
+    ParallelForFunc func;
+    void* userData;
+    int count;
+} threadPool = { .threadCount = 1 };
+
+static void* WorkerMain(void* arg) {
+    int worker = *(int*)arg;
+    unsigned int seenGeneration = 0;
+    currentWorker = worker;
+
+    for (;;) {
+        pthread_mutex_lock(&threadPool.mutex);
+        while (threadPool.generation == seenGeneration && !threadPool.shuttingDown) {
+            pthread_cond_wait(&threadPool.workReady, &threadPool.mutex);
+        }
+        if (threadPool.shuttingDown) {
+            pthread_mutex_unlock(&threadPool.mutex);
+            break;
+        }
+        seenGeneration = threadPool.generation;
+        ParallelForFunc func = threadPool.func;
+        void* userData = threadPool.userData;
+        int count = threadPool.count;
+        int parts = threadPool.parts;
+        pthread_mutex_unlock(&threadPool.mutex);
+
+        // 작업이 워커 수보다 적게 나뉘었으면 이번 작업은 건너뜀
+        if (worker < parts) {
+            int begin, end;
+            ThreadPool_GetRange(count, worker, parts, &begin, &end);
+            if (begin < end) {
+                func(begin, end, worker, userData);
+            }
+        }
+
+        pthread_mutex_lock(&threadPool.mutex);
+        if (--threadPool.pending == 0) {
+            pthread_cond_signal(&threadPool.workDone);
+        }
+        pthread_mutex_unlock(&threadPool.mutex);
+    }
+
+    return NULL;
+}
+
+bool ThreadPool_Init(int threadCount) {
+    if (threadCount < 1) threadCount = 1;
+    if (threadCount > THREAD_POOL_MAX_THREADS) threadCount = THREAD_POOL_MAX_THREADS;
+
+    threadPool.threadCount = 1;
+    threadPool.generation = 0;
+    threadPool.pending = 0;
+    threadPool.shuttingDown = false;
+    if (threadCount == 1) return true;
+
+    pthread_mutex_init(&threadPool.mutex, NULL);
+    pthread_cond_init(&threadPool.workReady, NULL);
+    pthread_cond_init(&threadPool.workDone, NULL);
+
+    for (int i = 1; i < threadCount; i++) {
+        threadPool.workerIds[i] = i;
+        if (pthread_create(&threadPool.threads[i], NULL, WorkerMain, &threadPool.workerIds[i]) != 0) {
+            printf("ThreadPool: failed to start worker %d, using %d threads\n", i, threadPool.threadCount);
+            break;
+        }
+        threadPool.threadCount++;
+    }
+
+    printf("ThreadPool: %d threads\n", threadPool.threadCount);
+    return threadPool.threadCount == threadCount;
+}
+
+void ThreadPool_Shutdown(void) {
+    if (threadPool.threadCount <= 1) return;
+
+    pthread_mutex_lock(&threadPool.mutex);
+    threadPool.shuttingDown = true;
+    pthread_cond_broadcast(&threadPool.workReady);
+    pthread_mutex_unlock(&threadPool.mutex);
+
+    for (int i = 1; i < threadPool.threadCount; i++) {
+        pthread_join(threadPool.threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&threadPool.workDone);
+    pthread_cond_destroy(&threadPool.workReady);
+    pthread_mutex_destroy(&threadPool.mutex);
+    threadPool.threadCount = 1;
+}
+
+int ThreadPool_GetThreadCount(void) {
+    return threadPool.threadCount;
+}
+
+void ThreadPool_ParallelFor(int count, int minItemsPerThread, ParallelForFunc func, void* userData) {
+    if (count <= 0) return;
+    if (minItemsPerThread < 1) minItemsPerThread = 1;
+
+    int parts = count / minItemsPerThread;
+    if (parts > threadPool.threadCount) parts = threadPool.threadCount;
+    if (parts <= 1) {
+        RunOnMainThread(func, 0, count, userData);
+        FinishParallelFor();
+        return;
+    }
+
+    pthread_mutex_lock(&threadPool.mutex);
+    threadPool.func = func;
+    threadPool.userData = userData;
+    threadPool.count = count;
+    threadPool.parts = parts;
+    threadPool.pending = threadPool.threadCount - 1;
+    threadPool.generation++;
+    pthread_cond_broadcast(&threadPool.workReady);
+    pthread_mutex_unlock(&threadPool.mutex);
+
+    // 첫 번째 범위는 메인 스레드가 처리
+    int begin, end;
+    ThreadPool_GetRange(count, 0, parts, &begin, &end);
+    RunOnMainThread(func, begin, end, userData);
+
+    pthread_mutex_lock(&threadPool.mutex);
+    while (threadPool.pending > 0) {
+        pthread_cond_wait(&threadPool.workDone, &threadPool.mutex);
+    }
+    pthread_mutex_unlock(&threadPool.mutex);
+
+    FinishParallelFor();
+}
+
+#else
+
+bool ThreadPool_Init(int threadCount) {
+    (void)threadCount;
+    return threadCount <= 1;
+}
+
+void ThreadPool_Shutdown(void) {
+}
+
+int ThreadPool_GetThreadCount(void) {
+    return 1;
+}
+
+void ThreadPool_ParallelFor(int count, int minItemsPerThread, ParallelForFunc func, void* userData) {
+    (void)minItemsPerThread;
+    if (count > 0) {
+        RunOnMainThread(func, 0, count, userData);
+        FinishParallelFor();
+    }
+}
+
+#endif
+
+void ThreadPool_GetRange(int count, int part, int parts, int* begin, int* end) {
+    // 범위 크기를 정렬 단위로 올림 → 스레드 수와 무관하게 SIMD 블록 구성이 동일
+    int chunk = (count + parts - 1) / parts;
+    chunk = (chunk + THREAD_POOL_RANGE_ALIGNMENT - 1) / THREAD_POOL_RANGE_ALIGNMENT * THREAD_POOL_RANGE_ALIGNMENT;
+
+    int b = part * chunk;
+    int e = b + chunk;
+    if (b > count) b = count;
+    if (e > count) e = count;
+    *begin = b;
+    *end = e;
+}
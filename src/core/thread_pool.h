@@ -0,0 +1,43 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdbool.h>
+
+// Upper bound for --threads (main thread included)
+#define THREAD_POOL_MAX_THREADS 64
+
+// Range boundaries are multiples of this many items, so SIMD lanes and cache
+// lines are assigned identically no matter how many threads split the range.
+#define THREAD_POOL_RANGE_ALIGNMENT 16
+
+// Work callback: process items [begin, end). `worker` is 0 for the main thread.
+typedef void (*ParallelForFunc)(int begin, int end, int worker, void* userData);
+
+// Runs on the main thread after every ParallelFor, once all workers are done
+typedef void (*ThreadPoolJoinHook)(void);
+
+// 스레드 풀 초기화 (threadCount 는 메인 스레드 포함, 1 이하면 워커 없음)
+bool ThreadPool_Init(int threadCount);
+// 워커 스레드 종료 및 정리
+void ThreadPool_Shutdown(void);
+// 메인 스레드를 포함한 실행 스레드 수
+int ThreadPool_GetThreadCount(void);
+
+/**
+ * @brief Split [0, count) into one contiguous range per thread and run func on each
+ *
+ * The main thread processes the first range and returns once every worker is
+ * done. Ranges smaller than minItemsPerThread are not split further, so small
+ * inputs run inline. Must only be called from the main thread, not nested.
+ */
+void ThreadPool_ParallelFor(int count, int minItemsPerThread, ParallelForFunc func, void* userData);
+
+// Range [begin, end) of `part` when [0, count) is split into `parts` aligned ranges
+void ThreadPool_GetRange(int count, int part, int parts, int* begin, int* end);
+
+// Worker index of the calling thread inside ParallelFor (main thread = 0), -1 outside
+int ThreadPool_GetCurrentWorker(void);
+// 병렬 구간이 끝날 때마다 호출할 훅 등록 (NULL 이면 해제, 훅은 하나만 유지)
+void ThreadPool_SetJoinHook(ThreadPoolJoinHook hook);
+
+#endif // THREAD_POOL_H
@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include "player.h"
 #include "enemy_state.h"
+#include "enemy_handle.h"
 
 // Enemy types
 typedef enum {
@@ -46,45 +47,48 @@ typedef enum {
 } AIState;
 
 // Enemy entity structure
+// Fields read every frame by collision, gravity and drawing come first so they
+// share the leading cache lines; per-pattern movement state lives in EnemyMotion.
 typedef struct Enemy {
+    // Hot: collision, gravity and rendering
     Vector2 position;          // Current position
-    Vector2 velocity;          // Current velocity
-    Vector2 targetPosition;    // Target position for certain patterns
-    Color color;              // Enemy color
-    Color originalColor;      // Original color for effects
-    float spawnTime;          // Time when enemy was spawned
     float radius;             // Enemy radius
     float health;
-    float maxHealth;
-    float damage;
-    
-    // Type and behavior
     EnemyType type;
+    uint32_t stateFlags;      // Bitflags for boolean states (ENEMY_STATE_*)
+    Vector2 velocity;          // Current velocity
+    float maxHealth;
+    Color color;              // Enemy color
+    int gravitySourceId;      // ID from gravity system (0 = none)
+    EnemyHandle handle;       // Own handle, set by EnemyStore_Add
+
+    // Behavior
     MovementPattern movePattern;
     AIState aiState;
-    
-    // Pattern-specific data
+    float damage;
+    float spawnTime;          // Time when enemy was spawned
     float patternTimer;       // Timer for pattern changes
     float specialTimer;       // Timer for special abilities
-    float angle;              // Current angle for circular movements
-    float orbitRadius;        // Radius for orbiting enemies
-    Vector2 orbitCenter;      // Center point for orbiting
-
-    // Unified state system
-    uint32_t stateFlags;      // Bitflags for boolean states (ENEMY_STATE_*)
+    Color originalColor;      // Original color for effects
     EnemyStateData stateData; // Numeric state values (phase, splitCount, shieldHealth, etc.)
+} Enemy;
+
+// Cold per-enemy movement state, only touched by the AI and movement updates
+// (kept in a parallel array by EnemyStore)
+typedef struct EnemyMotion {
+    Vector2 targetPosition;    // Target position for certain patterns
+    Vector2 orbitCenter;       // Center point for orbiting
+    float angle;               // Current angle for circular movements
+    float orbitRadius;         // Radius for orbiting enemies
 
     // Smooth movement data for ENEMY_TYPE_BASIC
-    Vector2 wanderTarget;     // Current wander target position
-    float wanderAngle;        // Current wander angle for smooth turning
-    float turnSpeed;          // How fast the enemy can turn
+    Vector2 wanderTarget;      // Current wander target position
+    float wanderAngle;         // Current wander angle for smooth turning
+    float turnSpeed;           // How fast the enemy can turn
 
-    // Gravity system integration
-    int gravitySourceId;      // ID from gravity system (0 = none)
-} Enemy;
+} EnemyMotion;
 
 // Constants
-#define MAX_ENEMIES 50         // Increased for more complex stages
 #define ENEMY_SPAWN_TIME 0.8f  // Base spawn interval
 #define ENEMY_MIN_SIZE 10.0f
 #define ENEMY_MAX_SIZE 20.0f
@@ -97,17 +101,25 @@ typedef struct Enemy {
 #define SPLIT_SIZE_REDUCTION 0.5f
 #define REPULSE_RADIUS 150.0f
 #define CLUSTER_EXPLOSION_RADIUS 100.0f
+#define CLUSTER_PARTICLE_IMPULSE 2.0f      // Particle push per frame at the blast center
+#define CLUSTER_IMPULSE_DURATION 0.1f      // Seconds the blast keeps pushing
 
 // Enemy initialization by type
-Enemy InitEnemyByType(EnemyType type, int screenWidth, int screenHeight, Vector2 playerPos);
-Enemy InitEnemy(int screenWidth, int screenHeight);
+// (motion receives the type's movement state; may be NULL)
+Enemy InitEnemyByType(EnemyType type, int screenWidth, int screenHeight, Vector2 playerPos, EnemyMotion* motion);
+Enemy InitEnemy(int screenWidth, int screenHeight, EnemyMotion* motion);
 
 // Enemy update and render functions
-void UpdateEnemy(Enemy* enemy, int screenWidth, int screenHeight, float deltaTime);
-void UpdateEnemyAI(Enemy* enemy, Vector2 playerPos, float deltaTime);
-void UpdateEnemyMovement(Enemy* enemy, Vector2 playerPos, float deltaTime);
-void DrawEnemy(Enemy enemy);
-void DrawEnemyShield(Enemy enemy);
+// (behavior is EnemyBehavior_Get(enemy->type), looked up once per type group by the caller)
+struct EnemyBehavior;
+void UpdateEnemy(Enemy* enemy, const struct EnemyBehavior* behavior, int screenWidth, int screenHeight, float deltaTime);
+void UpdateEnemyAI(Enemy* enemy, EnemyMotion* motion, const struct EnemyBehavior* behavior,
+                   Vector2 playerPos, float deltaTime);
+void UpdateEnemyMovement(Enemy* enemy, EnemyMotion* motion, const struct EnemyBehavior* behavior,
+                         Vector2 playerPos, float deltaTime);
+// Drawn at position (the render-interpolated position, or enemy->position)
+void DrawEnemy(const Enemy* enemy, Vector2 position);
+void DrawEnemyShield(const Enemy* enemy, Vector2 position);
 
 // Special enemy abilities
 void ExecuteEnemySpecialAbility(Enemy* enemy, Vector2 playerPos);
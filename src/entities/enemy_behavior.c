@@ -0,0 +1,505 @@
+#include "enemy_behavior.h"
+#include <math.h>
+#include "raymath.h"
+#include "../core/game.h"  // For global screen dimensions
+#include "../core/gravity_system.h"
+#include "../core/replay.h"
+#include "../render/render.h"
+
+//------------------------------------------------------------------------------------
+// Spawn hooks
+//------------------------------------------------------------------------------------
+
+// Basic enemies start moving in a random direction with a wander target ahead
+static void InitWander(Enemy* enemy, EnemyMotion* motion) {
+    float initialSpeed = 1.0f;
+    float initialAngle = GetRandomValue(0, 360) * DEG2RAD;
+    enemy->velocity = (Vector2){
+        cosf(initialAngle) * initialSpeed,
+        sinf(initialAngle) * initialSpeed
+    };
+    motion->wanderAngle = initialAngle;
+    motion->wanderTarget = (Vector2){
+        enemy->position.x + cosf(motion->wanderAngle) * 100.0f,
+        enemy->position.y + sinf(motion->wanderAngle) * 100.0f
+    };
+    motion->turnSpeed = 2.0f; // Radians per second
+}
+
+static void InitOrbit(Enemy* enemy, EnemyMotion* motion) {
+    motion->orbitCenter = enemy->position;
+    motion->orbitRadius = 100.0f;
+    motion->angle = 0.0f;
+}
+
+//------------------------------------------------------------------------------------
+// Patrol hooks
+//------------------------------------------------------------------------------------
+
+// Smooth wandering behavior for basic enemies with border avoidance
+static void WanderPatrol(Enemy* enemy, EnemyMotion* motion, float deltaTime) {
+    // Update wander angle with small random changes for natural movement
+    motion->wanderAngle += (GetRandomValue(-100, 100) / 100.0f) * deltaTime * 3.0f; // More variation
+
+    // Occasionally make bigger turns for exploration
+    if (GetRandomValue(0, 100) < 2) { // 2% chance per frame
+        motion->wanderAngle += GetRandomValue(-314, 314) / 100.0f; // -PI to PI
+    }
+
+    // Calculate new wander target position (project forward from current position)
+    float wanderDistance = 60.0f;
+    float wanderRadius = 40.0f; // Increased for more variation
+
+    // Get current direction
+    float currentAngle = atan2f(enemy->velocity.y, enemy->velocity.x);
+
+    // Project a point ahead of the enemy
+    Vector2 wanderCenter = {
+        enemy->position.x + cosf(currentAngle) * wanderDistance,
+        enemy->position.y + sinf(currentAngle) * wanderDistance
+    };
+
+    // Add random offset to create the wander target
+    motion->wanderTarget = (Vector2){
+        wanderCenter.x + cosf(motion->wanderAngle) * wanderRadius,
+        wanderCenter.y + sinf(motion->wanderAngle) * wanderRadius
+    };
+
+    // Calculate desired velocity towards wander target
+    Vector2 desired = {
+        motion->wanderTarget.x - enemy->position.x,
+        motion->wanderTarget.y - enemy->position.y
+    };
+
+    // Smart border avoidance - only when heading towards border
+    float borderMargin = 30.0f;  // Very close to edge
+    float avoidanceStrength = 1.5f;  // Gentler force
+
+    // Only apply avoidance if moving towards the border
+    // Left border
+    if (enemy->position.x < borderMargin && enemy->velocity.x < 0) {
+        float force = (borderMargin - enemy->position.x) / borderMargin;
+        desired.x += force * avoidanceStrength;
+    }
+    // Right border
+    if (enemy->position.x > g_screenWidth - borderMargin && enemy->velocity.x > 0) {
+        float force = (enemy->position.x - (g_screenWidth - borderMargin)) / borderMargin;
+        desired.x -= force * avoidanceStrength;
+    }
+    // Top border
+    if (enemy->position.y < borderMargin && enemy->velocity.y < 0) {
+        float force = (borderMargin - enemy->position.y) / borderMargin;
+        desired.y += force * avoidanceStrength;
+    }
+    // Bottom border
+    if (enemy->position.y > g_screenHeight - borderMargin && enemy->velocity.y > 0) {
+        float force = (enemy->position.y - (g_screenHeight - borderMargin)) / borderMargin;
+        desired.y -= force * avoidanceStrength;
+    }
+
+    // If stuck at border for too long, give a stronger push inward
+    float edgeThreshold = 10.0f;
+    bool nearEdge = (enemy->position.x < edgeThreshold ||
+                    enemy->position.x > g_screenWidth - edgeThreshold ||
+                    enemy->position.y < edgeThreshold ||
+                    enemy->position.y > g_screenHeight - edgeThreshold);
+
+    if (nearEdge && enemy->patternTimer > 2.0f) {
+        // Force a new direction pointing towards center
+        float centerX = g_screenWidth / 2.0f;
+        float centerY = g_screenHeight / 2.0f;
+        desired.x = (centerX - enemy->position.x) * 0.02f;
+        desired.y = (centerY - enemy->position.y) * 0.02f;
+        // Reset timer to prevent constant center-seeking
+        enemy->patternTimer = 0.0f;
+    }
+
+    // Normalize and scale to desired speed
+    float dist = sqrtf(desired.x * desired.x + desired.y * desired.y);
+    if (dist > 0) {
+        float targetSpeed = 1.2f; // Slightly faster base speed
+        desired.x = (desired.x / dist) * targetSpeed;
+        desired.y = (desired.y / dist) * targetSpeed;
+    }
+
+    // Smooth steering - gradually turn towards desired direction
+    float steerStrength = 0.12f; // Slightly more responsive
+    enemy->velocity.x += (desired.x - enemy->velocity.x) * steerStrength;
+    enemy->velocity.y += (desired.y - enemy->velocity.y) * steerStrength;
+
+    // Maintain speed within limits
+    float currentSpeed = sqrtf(enemy->velocity.x * enemy->velocity.x + enemy->velocity.y * enemy->velocity.y);
+    if (currentSpeed > 0) {
+        float maxSpeed = 1.5f;
+        float minSpeed = 0.8f;
+        if (currentSpeed > maxSpeed) {
+            enemy->velocity.x = (enemy->velocity.x / currentSpeed) * maxSpeed;
+            enemy->velocity.y = (enemy->velocity.y / currentSpeed) * maxSpeed;
+        } else if (currentSpeed < minSpeed) {
+            enemy->velocity.x = (enemy->velocity.x / currentSpeed) * minSpeed;
+            enemy->velocity.y = (enemy->velocity.y / currentSpeed) * minSpeed;
+        }
+    }
+}
+
+// Pick a new random direction every few seconds
+static void RandomPatrol(Enemy* enemy, EnemyMotion* motion, float deltaTime) {
+    (void)motion;
+    (void)deltaTime;
+    if (enemy->patternTimer > 2.0f + GetRandomValue(0, 20) / 10.0f) {
+        enemy->patternTimer = 0.0f;
+        enemy->velocity.x = GetRandomValue(-100, 100) / 100.0f;
+        enemy->velocity.y = GetRandomValue(-100, 100) / 100.0f;
+
+        // Speed modifier based on type
+        float speedMult = EnemyBehavior_Get(enemy->type)->speedMult;
+        enemy->velocity.x *= speedMult;
+        enemy->velocity.y *= speedMult;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Special ability hooks
+//------------------------------------------------------------------------------------
+
+static void TeleporterSpecial(Enemy* enemy, Vector2 playerPos) {
+    (void)playerPos;
+    if (enemy->specialTimer > TELEPORT_COOLDOWN) {
+        enemy->specialTimer = 0.0f;
+        // Teleport to random position
+        enemy->position.x = GetRandomValue(100, 700);
+        enemy->position.y = GetRandomValue(100, 700);
+
+        // Flash effect
+        enemy->color = WHITE;
+    } else if (enemy->specialTimer > 0.2f && enemy->color.r == 255) {
+        enemy->color = enemy->originalColor;
+    }
+}
+
+// Boss special attacks based on phase
+static void BossSpecial(Enemy* enemy, Vector2 playerPos) {
+    (void)playerPos;
+    if (enemy->stateData.phase >= 1 && enemy->specialTimer > 3.0f) {
+        enemy->specialTimer = 0.0f;
+        // Burst movement
+        enemy->velocity.x = GetRandomValue(-300, 300) / 100.0f;
+        enemy->velocity.y = GetRandomValue(-300, 300) / 100.0f;
+    }
+
+    if (enemy->stateData.phase >= 2) {
+        // Rage mode - faster and more aggressive
+        enemy->color = RED;
+    }
+}
+
+// Blackhole pulse effect
+static void BlackholeSpecial(Enemy* enemy, Vector2 playerPos) {
+    (void)playerPos;
+    if (enemy->aiState == AI_STATE_SPECIAL) {
+        // Increase size during pulse
+        enemy->radius = enemy->radius * 1.1f;
+        if (enemy->radius > 60.0f) {
+            enemy->radius = 40.0f;  // Reset to normal size
+        }
+        // Darker color during pulse
+        enemy->color = (Color){20, 0, 50, 255};
+    } else {
+        enemy->radius = 40.0f;  // Normal size
+        enemy->color = enemy->originalColor;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// AI state choice hooks (enemy manager)
+//------------------------------------------------------------------------------------
+
+// Always chase unless too close
+static void TrackerChooseState(Enemy* enemy, Vector2 playerPos) {
+    if (Vector2Distance(enemy->position, playerPos) < 50.0f) {
+        ChangeEnemyAIState(enemy, AI_STATE_FLEE);
+    } else {
+        ChangeEnemyAIState(enemy, AI_STATE_CHASE);
+    }
+}
+
+// Boss behavior based on phase
+static void BossChooseState(Enemy* enemy, Vector2 playerPos) {
+    (void)playerPos;
+    if (enemy->stateData.phase == 0) {
+        ChangeEnemyAIState(enemy, AI_STATE_ATTACK);
+    } else if (enemy->stateData.phase == 1) {
+        // Alternate between attack and special
+        if ((int)(Replay_GetTime() * 0.5f) % 2 == 0) {
+            ChangeEnemyAIState(enemy, AI_STATE_ATTACK);
+        } else {
+            ChangeEnemyAIState(enemy, AI_STATE_SPECIAL);
+        }
+    } else if (enemy->stateData.phase == 2) {
+        // Rage mode - always aggressive
+        ChangeEnemyAIState(enemy, AI_STATE_ATTACK);
+    }
+}
+
+// Repulsors maintain distance
+static void RepulsorChooseState(Enemy* enemy, Vector2 playerPos) {
+    if (Vector2Distance(enemy->position, playerPos) < 200.0f) {
+        ChangeEnemyAIState(enemy, AI_STATE_FLEE);
+    } else {
+        ChangeEnemyAIState(enemy, AI_STATE_PATROL);
+    }
+}
+
+// Blackholes slowly drift and occasionally pulse
+static void BlackholeChooseState(Enemy* enemy, Vector2 playerPos) {
+    (void)playerPos;
+    if ((int)(Replay_GetTime() * 0.3f) % 3 == 0) {
+        ChangeEnemyAIState(enemy, AI_STATE_SPECIAL);  // Pulse phase
+    } else {
+        ChangeEnemyAIState(enemy, AI_STATE_PATROL);   // Slow drift
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Gravity hooks
+//------------------------------------------------------------------------------------
+
+// Attracts particles while invulnerable and before the pulse
+static void BlackholeGravity(Enemy* enemy) {
+    bool shouldHaveGravity = HasState(enemy->stateFlags, ENEMY_STATE_INVULNERABLE) &&
+                             !HasState(enemy->stateFlags, ENEMY_STATE_PULSED);
+
+    if (shouldHaveGravity) {
+        if (enemy->gravitySourceId == 0) {
+            // Register new gravity source
+            GravitySource source = {
+                .position = enemy->position,
+                .radius = 200.0f,          // BLACKHOLE_RADIUS
+                .strength = 5.0f,          // BLACKHOLE_FORCE
+                .type = GRAVITY_TYPE_ATTRACTION,
+                .active = true,
+                .sourceEnemy = enemy->handle,
+                .sourceType = 0,  // Enemy
+                .sourceId = 0     // Will be assigned
+            };
+            enemy->gravitySourceId = RegisterGravitySource(source);
+        } else {
+            // Update existing source position
+            UpdateGravitySource(enemy->gravitySourceId, enemy->position);
+        }
+    } else {
+        // Remove gravity source if conditions no longer met
+        if (enemy->gravitySourceId != 0) {
+            UnregisterGravitySource(enemy->gravitySourceId);
+            enemy->gravitySourceId = 0;
+        }
+    }
+}
+
+static void RepulsorGravity(Enemy* enemy) {
+    if (enemy->gravitySourceId == 0) {
+        // Register repulsion source
+        GravitySource source = {
+            .position = enemy->position,
+            .radius = 150.0f,          // REPULSE_RADIUS
+            .strength = 2.0f,          // Repulsion strength
+            .type = GRAVITY_TYPE_REPULSION,
+            .active = true,
+            .sourceEnemy = enemy->handle,
+            .sourceType = 0,
+            .sourceId = 0
+        };
+        enemy->gravitySourceId = RegisterGravitySource(source);
+    } else {
+        // Update position
+        UpdateGravitySource(enemy->gravitySourceId, enemy->position);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Draw hooks
+//------------------------------------------------------------------------------------
+
+static void DrawSpeedLines(const Enemy* enemy, Vector2 position, Color c) {
+    Vector2 vel = enemy->velocity;
+    float speed = sqrtf(vel.x * vel.x + vel.y * vel.y);
+    if (speed > 0.1f) {
+        Vector2 norm = (Vector2){-vel.x / speed, -vel.y / speed};
+        for (int i = 0; i < 3; i++) {
+            float offset = i * 10.0f;
+            Render_DrawLine(position.x + norm.x * offset,
+                   position.y + norm.y * offset,
+                   position.x + norm.x * (offset + 5),
+                   position.y + norm.y * (offset + 5),
+                   (Color){c.r, c.g, c.b, (unsigned char)(100 - i * 30)});
+        }
+    }
+}
+
+static void DrawBlackhole(const Enemy* enemy, Vector2 position, Color c) {
+    if (HasState(enemy->stateFlags, ENEMY_STATE_INVULNERABLE) &&
+        !HasState(enemy->stateFlags, ENEMY_STATE_PULSED)) {
+        // Draw gravitational rings when invulnerable
+        for (int i = 3; i >= 0; i--) {
+            float ringRadius = enemy->radius * (2.0f + i * 0.5f);
+            Color ringColor = (Color){c.r, c.g, c.b, (unsigned char)(30 - i * 7)};
+            Render_DrawCircleLines(position.x, position.y, ringRadius, ringColor);
+        }
+        // Draw invulnerability shield effect
+        Render_DrawCircleLines(position.x, position.y, enemy->radius + 5,
+                      (Color){100, 100, 255, 100});
+        // Draw dark core
+        Render_DrawCircle(position.x, position.y, enemy->radius, BLACK);
+        Render_DrawCircle(position.x, position.y, enemy->radius * 0.8f, c);
+    } else if (HasState(enemy->stateFlags, ENEMY_STATE_PULSED)) {
+        // After transformation - semi-magnetic storm with fast movement
+        Render_DrawCircle(position.x, position.y, enemy->radius, c);
+
+        // Check if storm is active based on cycle timer
+        bool stormActive = fmodf(enemy->stateData.stormCycleTimer, 10.0f) < 5.0f;
+
+        // Draw storm field based on state
+        if (stormActive) {
+            // Draw active storm rings (red)
+            float stormTime = GetTime() * 4.0f;
+            for (int i = 0; i < 3; i++) {
+                float ringRadius = 150.0f - i * 40.0f; // Match SEMI_STORM_RADIUS
+                float waveOffset = sinf(stormTime + i * 1.5f) * 8.0f;
+                unsigned char alpha = (unsigned char)(60 - i * 15);
+                Render_DrawCircleLines(position.x, position.y, ringRadius + waveOffset,
+                              (Color){255, 50, 50, alpha});
+            }
+            // Draw warning circle
+            Render_DrawCircleLines(position.x, position.y, enemy->radius + 5,
+                          (Color){255, 100, 100, 150});
+        } else {
+            // Draw vulnerable state (green glow)
+            Render_DrawCircleLines(position.x, position.y, enemy->radius + 5,
+                          (Color){100, 255, 100, 100});
+            // Pulsing effect to indicate vulnerability
+            float pulse = sinf(GetTime() * 5.0f) * 10.0f + 60.0f;
+            Render_DrawCircleLines(position.x, position.y, pulse,
+                          (Color){100, 255, 100, 50});
+        }
+
+        DrawSpeedLines(enemy, position, c);
+    } else {
+        // When vulnerable, draw as a fast-moving enemy
+        Render_DrawCircle(position.x, position.y, enemy->radius, c);
+        DrawSpeedLines(enemy, position, c);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Behavior table
+//------------------------------------------------------------------------------------
+
+static const EnemyBehavior ENEMY_BEHAVIORS[ENEMY_TYPE_COUNT] = {
+    [ENEMY_TYPE_BASIC] = {
+        .radiusMin = (int)ENEMY_MIN_SIZE, .radiusMax = (int)ENEMY_MAX_SIZE, .healthPerRadius = 10.0f,
+        .movePattern = MOVE_PATTERN_RANDOM, .aiState = AI_STATE_PATROL,
+        .color = { 200, 122, 255, 255 },    // PURPLE
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f, .growthRate = 5.0f, .softBounds = true,
+        .label = "", .labelFontSize = 16,
+        .initMotion = InitWander, .patrol = WanderPatrol
+    },
+    [ENEMY_TYPE_TRACKER] = {
+        .radiusMin = (int)ENEMY_MIN_SIZE - 2, .radiusMax = (int)ENEMY_MAX_SIZE - 2, .healthPerRadius = 12.0f,
+        .movePattern = MOVE_PATTERN_TRACKING, .aiState = AI_STATE_CHASE,
+        .color = { 230, 41, 55, 255 },      // RED
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f,
+        .label = "T", .labelFontSize = 16,
+        .patrol = RandomPatrol, .chooseState = TrackerChooseState
+    },
+    [ENEMY_TYPE_SPEEDY] = {
+        .radiusMin = (int)ENEMY_MIN_SIZE - 3, .radiusMax = (int)ENEMY_MIN_SIZE, .healthPerRadius = 8.0f,
+        .movePattern = MOVE_PATTERN_ZIGZAG, .aiState = AI_STATE_PATROL,
+        .color = { 102, 191, 255, 255 },    // SKYBLUE
+        .initialDrift = 100,
+        .speedMult = SPEEDY_SPEED_MULT, .zigzagSpeed = SPEEDY_SPEED_MULT * 2.0f,
+        .label = "S", .labelFontSize = 16,
+        .patrol = RandomPatrol
+    },
+    [ENEMY_TYPE_SPLITTER] = {
+        .radiusMin = (int)ENEMY_MAX_SIZE, .radiusMax = (int)ENEMY_MAX_SIZE + 5, .healthPerRadius = 15.0f,
+        .splitCount = 2,  // Can split twice
+        .movePattern = MOVE_PATTERN_STRAIGHT, .aiState = AI_STATE_PATROL,
+        .color = { 0, 228, 48, 255 },       // GREEN
+        .initialDrift = 30,
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f,
+        .label = "X", .labelFontSize = 16,
+        .patrol = RandomPatrol
+    },
+    [ENEMY_TYPE_ORBITER] = {
+        .radiusMin = (int)ENEMY_MIN_SIZE, .radiusMax = (int)ENEMY_MAX_SIZE, .healthPerRadius = 11.0f,
+        .movePattern = MOVE_PATTERN_CIRCULAR, .aiState = AI_STATE_SPECIAL,
+        .color = { 255, 161, 0, 255 },      // ORANGE
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f,
+        .label = "O", .labelFontSize = 16,
+        .initMotion = InitOrbit, .patrol = RandomPatrol
+    },
+    [ENEMY_TYPE_BOSS_1] = {
+        .radiusMin = (int)(ENEMY_MAX_SIZE * BOSS_SIZE_MULT), .radiusMax = (int)(ENEMY_MAX_SIZE * BOSS_SIZE_MULT),
+        .maxHealth = 500.0f, .shieldHealth = 200.0f,
+        .initialFlags = ENEMY_STATE_SHIELDED,  // Start with shield
+        .movePattern = MOVE_PATTERN_AGGRESSIVE, .aiState = AI_STATE_ATTACK,
+        .color = { 112, 31, 126, 255 },     // DARKPURPLE
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f, .isBoss = true,
+        .label = "B1", .labelFontSize = 24,
+        .patrol = RandomPatrol, .special = BossSpecial, .chooseState = BossChooseState
+    },
+    [ENEMY_TYPE_TELEPORTER] = {
+        .radiusMin = (int)ENEMY_MIN_SIZE, .radiusMax = (int)ENEMY_MAX_SIZE - 2, .healthPerRadius = 10.0f,
+        .movePattern = MOVE_PATTERN_TELEPORT, .aiState = AI_STATE_SPECIAL,
+        .color = { 135, 60, 190, 255 },     // VIOLET
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f, .teleports = true,
+        .label = "!", .labelFontSize = 16,
+        .patrol = RandomPatrol, .special = TeleporterSpecial
+    },
+    [ENEMY_TYPE_REPULSOR] = {
+        .radiusMin = (int)ENEMY_MAX_SIZE - 5, .radiusMax = (int)ENEMY_MAX_SIZE, .healthPerRadius = 13.0f,
+        .movePattern = MOVE_PATTERN_PATROL, .aiState = AI_STATE_SPECIAL,
+        .color = { 253, 249, 0, 255 },      // YELLOW
+        .initialDrift = 30,
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f,
+        .label = "R", .labelFontSize = 16,
+        .patrol = RandomPatrol, .chooseState = RepulsorChooseState, .updateGravity = RepulsorGravity
+    },
+    [ENEMY_TYPE_CLUSTER] = {
+        .radiusMin = (int)ENEMY_MIN_SIZE, .radiusMax = (int)ENEMY_MAX_SIZE - 3, .healthPerRadius = 9.0f,
+        .movePattern = MOVE_PATTERN_WAVE, .aiState = AI_STATE_PATROL,
+        .color = { 255, 0, 255, 255 },      // MAGENTA
+        .initialDrift = 40,
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f,
+        .label = "C", .labelFontSize = 16,
+        .patrol = RandomPatrol
+    },
+    [ENEMY_TYPE_BOSS_FINAL] = {
+        .radiusMin = (int)(ENEMY_MAX_SIZE * BOSS_SIZE_MULT * 1.5f), .radiusMax = (int)(ENEMY_MAX_SIZE * BOSS_SIZE_MULT * 1.5f),
+        .maxHealth = 1000.0f, .shieldHealth = 500.0f,
+        .initialFlags = ENEMY_STATE_SHIELDED,  // Start with shield
+        .movePattern = MOVE_PATTERN_AGGRESSIVE, .aiState = AI_STATE_ATTACK,
+        .color = { 255, 203, 0, 255 },      // GOLD
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f, .isBoss = true, .rageColor = true,
+        .label = "BF", .labelFontSize = 24,
+        .patrol = RandomPatrol, .special = BossSpecial, .chooseState = BossChooseState
+    },
+    [ENEMY_TYPE_BLACKHOLE] = {
+        .radiusMin = 40, .radiusMax = 40, .maxHealth = 1000.0f, .damage = 30.0f,
+        .initialFlags = ENEMY_STATE_INVULNERABLE,  // Invulnerable until other enemies are dead
+        .movePattern = MOVE_PATTERN_TRACKING,      // Always tracks the player
+        .aiState = AI_STATE_CHASE,
+        .color = { 50, 0, 100, 255 },       // Deep purple
+        .speedMult = 1.0f, .zigzagSpeed = 1.5f,
+        .label = "BH", .labelFontSize = 16,
+        .patrol = RandomPatrol, .special = BlackholeSpecial, .chooseState = BlackholeChooseState,
+        .updateGravity = BlackholeGravity, .draw = DrawBlackhole
+    }
+};
+
+const EnemyBehavior* EnemyBehavior_Get(EnemyType type) {
+    if (type < 0 || type >= ENEMY_TYPE_COUNT) {
+        return &ENEMY_BEHAVIORS[ENEMY_TYPE_BASIC];
+    }
+    return &ENEMY_BEHAVIORS[type];
+}
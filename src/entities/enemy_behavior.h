@@ -0,0 +1,56 @@
+#ifndef ENEMY_BEHAVIOR_H
+#define ENEMY_BEHAVIOR_H
+
+#include "raylib.h"
+#include "enemy.h"
+#include <stdbool.h>
+
+/**
+ * @brief Per-type enemy behavior descriptor
+ *
+ * Everything that used to be a switch on EnemyType: spawn parameters,
+ * per-frame hooks and drawing details. Hooks are NULL when the type has no
+ * such behavior, so callers test the pointer once per type group instead of
+ * branching on the type for every enemy.
+ */
+typedef struct EnemyBehavior {
+    // Spawn parameters
+    int radiusMin;              // Random radius range (equal = fixed radius)
+    int radiusMax;
+    float healthPerRadius;      // maxHealth = radius * healthPerRadius (0 = use maxHealth)
+    float maxHealth;
+    float damage;
+    float shieldHealth;         // > 0 spawns shielded with this much shield
+    int splitCount;             // Remaining splits for splitters
+    uint32_t initialFlags;      // ENEMY_STATE_* set at spawn
+    MovementPattern movePattern;
+    AIState aiState;
+    Color color;
+    int initialDrift;           // Spawn velocity = GetRandomValue(-d, d) / 50 * speedMult (0 = at rest)
+
+    // Per-frame parameters
+    float speedMult;            // Patrol speed multiplier
+    float zigzagSpeed;          // Speed after each zigzag turn
+    float growthRate;           // Radius growth per second (health scales with it)
+    bool softBounds;            // Clamp to the screen instead of bouncing off it
+    bool isBoss;                // Phase-driven attack and tracking speed
+    bool teleports;             // Publishes EVENT_ENEMY_TELEPORTED, flashes white
+    bool rageColor;             // Drawn red from phase 2
+
+    // Drawing
+    const char* label;          // Type indicator drawn on the enemy ("" = none)
+    int labelFontSize;
+
+    // Hooks (NULL = nothing to do)
+    void (*initMotion)(Enemy* enemy, EnemyMotion* motion);               // After radius is rolled
+    void (*patrol)(Enemy* enemy, EnemyMotion* motion, float deltaTime);  // AI_STATE_PATROL
+    void (*special)(Enemy* enemy, Vector2 playerPos);                    // Special ability
+    void (*chooseState)(Enemy* enemy, Vector2 playerPos);                // Enemy manager AI state choice
+    void (*updateGravity)(Enemy* enemy);                                 // Keep the gravity source in sync
+    void (*draw)(const Enemy* enemy, Vector2 position, Color color);     // Body at position (NULL = plain circle)
+} EnemyBehavior;
+
+// Descriptor for a type (ENEMY_TYPE_COUNT and invalid values map to BASIC)
+const EnemyBehavior* EnemyBehavior_Get(EnemyType type);
+
+#endif // ENEMY_BEHAVIOR_H
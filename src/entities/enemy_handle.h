@@ -0,0 +1,30 @@
+#ifndef ENEMY_HANDLE_H
+#define ENEMY_HANDLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Stable reference to an enemy in an EnemyStore
+ *
+ * Enemies move inside the store when others are removed, so code that keeps
+ * a reference across frames (queued events, gravity sources) holds a handle
+ * instead of an index or pointer. A handle goes stale when its enemy is
+ * removed; EnemyStore_Get then returns NULL.
+ */
+typedef struct EnemyHandle {
+    uint32_t slot;
+    uint32_t generation;    // 0 = null handle (live slots start at 1)
+} EnemyHandle;
+
+#define ENEMY_HANDLE_NULL ((EnemyHandle){ 0, 0 })
+
+static inline bool EnemyHandle_IsNull(EnemyHandle handle) {
+    return handle.generation == 0;
+}
+
+static inline bool EnemyHandle_Equals(EnemyHandle a, EnemyHandle b) {
+    return a.slot == b.slot && a.generation == b.generation;
+}
+
+#endif // ENEMY_HANDLE_H
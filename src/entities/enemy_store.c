@@ -0,0 +1,126 @@
+#include "enemy_store.h"
+#include <stdlib.h>
+#include <string.h>
+
+bool EnemyStore_Init(EnemyStore* store, int capacity) {
+    memset(store, 0, sizeof(EnemyStore));
+    if (capacity <= 0) return false;
+
+    store->items = (Enemy*)malloc(capacity * sizeof(Enemy));
+    store->motion = (EnemyMotion*)malloc(capacity * sizeof(EnemyMotion));
+    store->previousPosition = (Vector2*)malloc(capacity * sizeof(Vector2));
+    store->handles = (EnemyHandle*)malloc(capacity * sizeof(EnemyHandle));
+    store->denseOf = (int*)malloc(capacity * sizeof(int));
+    store->generations = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+    store->freeSlots = (int*)malloc(capacity * sizeof(int));
+    store->byType = (int*)malloc(capacity * sizeof(int));
+    if (!store->items || !store->motion || !store->previousPosition || !store->handles || !store->denseOf || !store->generations ||
+        !store->freeSlots || !store->byType) {
+        EnemyStore_Destroy(store);
+        return false;
+    }
+
+    store->capacity = capacity;
+    // 낮은 슬롯부터 쓰도록 역순으로 쌓음
+    for (int s = 0; s < capacity; s++) {
+        store->denseOf[s] = -1;
+        store->generations[s] = 1;
+        store->freeSlots[s] = capacity - 1 - s;
+    }
+    store->freeCount = capacity;
+    return true;
+}
+
+void EnemyStore_Destroy(EnemyStore* store) {
+    free(store->items);
+    free(store->motion);
+    free(store->previousPosition);
+    free(store->handles);
+    free(store->denseOf);
+    free(store->generations);
+    free(store->freeSlots);
+    free(store->byType);
+    memset(store, 0, sizeof(EnemyStore));
+}
+
+void EnemyStore_Clear(EnemyStore* store) {
+    while (store->count > 0) {
+        EnemyStore_RemoveAt(store, store->count - 1);
+    }
+}
+
+EnemyHandle EnemyStore_Add(EnemyStore* store, const Enemy* enemy, const EnemyMotion* motion) {
+    if (store->freeCount == 0) return ENEMY_HANDLE_NULL;
+
+    int slot = store->freeSlots[--store->freeCount];
+    int index = store->count++;
+    EnemyHandle handle = { (uint32_t)slot, store->generations[slot] };
+
+    store->items[index] = *enemy;
+    store->items[index].handle = handle;
+    if (motion) {
+        store->motion[index] = *motion;
+    } else {
+        memset(&store->motion[index], 0, sizeof(EnemyMotion));
+    }
+    // 새 적은 보간 없이 현재 위치에 그려지도록
+    store->previousPosition[index] = enemy->position;
+    store->handles[index] = handle;
+    store->denseOf[slot] = index;
+    return handle;
+}
+
+void EnemyStore_RemoveAt(EnemyStore* store, int index) {
+    if (index < 0 || index >= store->count) return;
+
+    int slot = (int)store->handles[index].slot;
+    int last = --store->count;
+    if (index != last) {
+        store->items[index] = store->items[last];
+        store->motion[index] = store->motion[last];
+        store->previousPosition[index] = store->previousPosition[last];
+        store->handles[index] = store->handles[last];
+        store->denseOf[store->handles[index].slot] = index;
+    }
+
+    // 세대를 올려 남아 있는 핸들을 무효화 (0 은 널 핸들용이라 건너뜀)
+    store->denseOf[slot] = -1;
+    if (++store->generations[slot] == 0) {
+        store->generations[slot] = 1;
+    }
+    store->freeSlots[store->freeCount++] = slot;
+}
+
+bool EnemyStore_Remove(EnemyStore* store, EnemyHandle handle) {
+    int index = EnemyStore_IndexOf(store, handle);
+    if (index < 0) return false;
+    EnemyStore_RemoveAt(store, index);
+    return true;
+}
+
+void EnemyStore_GroupByType(EnemyStore* store, int groupStart[ENEMY_TYPE_COUNT + 1]) {
+    // 타입별 개수를 세어 구간을 정한 뒤 순서대로 채움 (계수 정렬)
+    int next[ENEMY_TYPE_COUNT] = {0};
+    for (int i = 0; i < store->count; i++) {
+        next[store->items[i].type]++;
+    }
+    groupStart[0] = 0;
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        groupStart[t + 1] = groupStart[t] + next[t];
+        next[t] = groupStart[t];
+    }
+    for (int i = 0; i < store->count; i++) {
+        store->byType[next[store->items[i].type]++] = i;
+    }
+}
+
+int EnemyStore_IndexOf(const EnemyStore* store, EnemyHandle handle) {
+    if (handle.slot >= (uint32_t)store->capacity) return -1;
+    if (store->generations[handle.slot] != handle.generation) return -1;
+    return store->denseOf[handle.slot];
+}
+
+Enemy* EnemyStore_Get(const EnemyStore* store, EnemyHandle handle) {
+    int index = EnemyStore_IndexOf(store, handle);
+    return (index >= 0) ? &store->items[index] : NULL;
+}
@@ -0,0 +1,66 @@
+#ifndef ENEMY_STORE_H
+#define ENEMY_STORE_H
+
+#include "enemy.h"
+#include "enemy_handle.h"
+#include <stdbool.h>
+
+/**
+ * @brief Slot map of live enemies
+ *
+ * items[0, count) is dense, so per-frame loops walk a packed array.
+ * Removal moves the last enemy into the hole (O(1), order is not kept).
+ * Each slot has a generation that is bumped on removal, which is how
+ * handles to removed enemies are detected. motion[i] holds the cold
+ * movement state of items[i] and moves with it, so loops that only need
+ * position, radius or health never pull it into cache; previousPosition[i]
+ * is only read when drawing. Capacity is fixed at Init, so
+ * Enemy pointers stay valid while enemies are added (but not across a
+ * removal).
+ */
+typedef struct EnemyStore {
+    Enemy* items;           // Live enemies [0, count)
+    EnemyMotion* motion;    // motion[i] belongs to items[i]
+    Vector2* previousPosition;  // Position of items[i] before the last step (render interpolation)
+    EnemyHandle* handles;   // handles[i] refers to items[i]
+    int* denseOf;           // Slot → index into items (-1 = free slot)
+    uint32_t* generations;  // Current generation of each slot
+    int* freeSlots;         // Stack of free slots
+    int* byType;            // Enemy indices grouped by type (EnemyStore_GroupByType)
+    int freeCount;
+    int count;
+    int capacity;
+} EnemyStore;
+
+// Allocate room for `capacity` enemies
+bool EnemyStore_Init(EnemyStore* store, int capacity);
+void EnemyStore_Destroy(EnemyStore* store);
+// Remove every enemy (all outstanding handles go stale)
+void EnemyStore_Clear(EnemyStore* store);
+
+static inline bool EnemyStore_IsFull(const EnemyStore* store) {
+    return store->count >= store->capacity;
+}
+
+// Append an enemy and its movement state (NULL = zeroed); returns its handle
+// (null handle if the store is full)
+EnemyHandle EnemyStore_Add(EnemyStore* store, const Enemy* enemy, const EnemyMotion* motion);
+// Swap-remove items[index]: the last enemy takes its place
+void EnemyStore_RemoveAt(EnemyStore* store, int index);
+// Remove by handle (false if the handle is stale)
+bool EnemyStore_Remove(EnemyStore* store, EnemyHandle handle);
+
+/**
+ * @brief Group live enemies by type
+ *
+ * Fills store->byType so that byType[groupStart[t], groupStart[t + 1]) are
+ * the indices of type t enemies, in store order within each group.
+ */
+void EnemyStore_GroupByType(EnemyStore* store, int groupStart[ENEMY_TYPE_COUNT + 1]);
+
+// Current index of a handle's enemy (-1 if removed)
+int EnemyStore_IndexOf(const EnemyStore* store, EnemyHandle handle);
+// Resolve a handle (NULL if removed)
+Enemy* EnemyStore_Get(const EnemyStore* store, EnemyHandle handle);
+
+#endif // ENEMY_STORE_H
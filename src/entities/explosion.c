@@ -1,4 +1,6 @@
 #include "explosion.h"
+#include "../core/fixed_step.h"
+#include "../render/render.h"
 #include <math.h>
 #include <stdlib.h>
 
@@ -29,10 +31,12 @@ void SpawnExplosion(ExplosionParticle* particles, int* particleCount, Vector2 po
 }
 
 void UpdateExplosionParticle(ExplosionParticle* particle, float deltaTime) {
-    particle->position.x += particle->velocity.x;
-    particle->position.y += particle->velocity.y;
-    particle->velocity.x *= 0.95f;
-    particle->velocity.y *= 0.95f;
+    float scale = FixedStep_Scale(deltaTime);
+    float drag = powf(0.95f, scale);
+    particle->position.x += particle->velocity.x * scale;
+    particle->position.y += particle->velocity.y * scale;
+    particle->velocity.x *= drag;
+    particle->velocity.y *= drag;
     particle->timeToLive -= deltaTime;
 }
 
@@ -40,5 +44,5 @@ void DrawExplosionParticle(ExplosionParticle particle) {
     Color c = particle.color;
     float t = particle.timeToLive;
     if (t < 0.2f) c.a = (unsigned char)(255 * (t/0.2f));
-    DrawCircleV(particle.position, particle.radius, c);
+    Render_DrawCircleV(particle.position, particle.radius, c);
 }
\ No newline at end of file
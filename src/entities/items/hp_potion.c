@@ -1,7 +1,7 @@
 #include "hp_potion.h"
 #include "../../core/event/event_system.h"
 #include "../../core/event/event_types.h"
-#include "../../core/memory_pool.h"
+#include "../../render/render.h"
 #include <stdlib.h>
 
 HPPotion InitHPPotion(void) {
@@ -30,17 +30,11 @@ void SpawnHPPotion(HPPotion* potion, int screenWidth, int screenHeight) {
     potion->blinkTimer = 0.0f;
     
     // Publish spawn event
-    extern MemoryPool g_itemEventPool; // Defined in item_manager.c
-    // Only publish events if the pool is initialized (for testing compatibility)
-    if (g_itemEventPool.blocks != NULL) {
-        ItemEventData* data = MemoryPool_Alloc(&g_itemEventPool);
-        if (data) {
-            data->itemType = 0; // HP Potion
-            data->position = potion->position;
-            data->itemPtr = potion;
-            PublishEvent(EVENT_ITEM_SPAWNED, data);
-        }
-    }
+    ItemEventData data = {0};
+    data.itemType = 0; // HP Potion
+    data.position = potion->position;
+    data.itemPtr = potion;
+    PublishEvent(EVENT_ITEM_SPAWNED, &data, sizeof(data));
 }
 
 void UpdateHPPotion(HPPotion* potion, float deltaTime) {
@@ -63,17 +57,11 @@ void UpdateHPPotion(HPPotion* potion, float deltaTime) {
         potion->isActive = false;
         
         // Publish expire event
-        extern MemoryPool g_itemEventPool;
-        // Only publish events if the pool is initialized (for testing compatibility)
-        if (g_itemEventPool.blocks != NULL) {
-            ItemEventData* data = MemoryPool_Alloc(&g_itemEventPool);
-            if (data) {
-                data->itemType = 0;
-                data->position = potion->position;
-                data->itemPtr = potion;
-                PublishEvent(EVENT_ITEM_EXPIRED, data);
-            }
-        }
+        ItemEventData data = {0};
+        data.itemType = 0;
+        data.position = potion->position;
+        data.itemPtr = potion;
+        PublishEvent(EVENT_ITEM_EXPIRED, &data, sizeof(data));
     }
 }
 
@@ -89,18 +77,18 @@ void DrawHPPotion(HPPotion potion) {
     
     if (visible) {
         // Draw potion as a red circle with white cross
-        DrawCircle(potion.position.x, potion.position.y, potion.radius, RED);
+        Render_DrawCircle(potion.position.x, potion.position.y, potion.radius, RED);
         
         // Draw white cross
         float crossSize = potion.radius * 0.6f;
-        DrawRectangle(
+        Render_DrawRectangle(
             potion.position.x - crossSize, 
             potion.position.y - 2, 
             crossSize * 2, 
             4, 
             WHITE
         );
-        DrawRectangle(
+        Render_DrawRectangle(
             potion.position.x - 2, 
             potion.position.y - crossSize, 
             4, 
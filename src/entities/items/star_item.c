@@ -1,12 +1,10 @@
 #include "star_item.h"
-#include "../../core/memory_pool.h"
 #include "../../core/event/event_system.h"
 #include "../../core/event/event_types.h"
+#include "../../render/render.h"
 #include <math.h>
 #include <stdlib.h>
 
-extern MemoryPool g_itemEventPool;
-
 StarItem InitStarItem(void) {
     StarItem star = {
         .position = (Vector2){0, 0},
@@ -77,15 +75,11 @@ void SpawnStarItem(StarItem* star, int screenWidth, int screenHeight) {
     star->colorTimer = 0.0f;
     
     // Publish spawn event
-    if (g_itemEventPool.blocks != NULL) {
-        ItemEventData* data = MemoryPool_Alloc(&g_itemEventPool);
-        if (data) {
-            data->itemType = 1; // Star Item
-            data->position = star->position;
-            data->itemPtr = star;
-            PublishEvent(EVENT_ITEM_SPAWNED, data);
-        }
-    }
+    ItemEventData data = {0};
+    data.itemType = 1; // Star Item
+    data.position = star->position;
+    data.itemPtr = star;
+    PublishEvent(EVENT_ITEM_SPAWNED, &data, sizeof(data));
 }
 
 void UpdateStarItem(StarItem* star, float deltaTime, int screenWidth, int screenHeight) {
@@ -105,15 +99,11 @@ void UpdateStarItem(StarItem* star, float deltaTime, int screenWidth, int screen
         star->isActive = false;
         
         // Publish expire event
-        if (g_itemEventPool.blocks != NULL) {
-            ItemEventData* data = MemoryPool_Alloc(&g_itemEventPool);
-            if (data) {
-                data->itemType = 1;
-                data->position = star->position;
-                data->itemPtr = star;
-                PublishEvent(EVENT_ITEM_EXPIRED, data);
-            }
-        }
+        ItemEventData data = {0};
+        data.itemType = 1;
+        data.position = star->position;
+        data.itemPtr = star;
+        PublishEvent(EVENT_ITEM_EXPIRED, &data, sizeof(data));
     }
 }
 
@@ -142,12 +132,12 @@ void DrawStarItem(StarItem star) {
     Color starColor = GetRainbowColor(star.colorTimer);
     
     // Draw star shape (simplified as octagon for now)
-    DrawCircle((int)star.position.x, (int)star.position.y, star.radius, starColor);
+    Render_DrawCircle((int)star.position.x, (int)star.position.y, star.radius, starColor);
     
     // Add sparkle effect
     float sparkleRadius = star.radius * 0.3f;
     Color sparkleColor = (Color){255, 255, 255, 200};
-    DrawCircle((int)(star.position.x - star.radius * 0.5f), 
+    Render_DrawCircle((int)(star.position.x - star.radius * 0.5f), 
                (int)(star.position.y - star.radius * 0.5f), 
                sparkleRadius, sparkleColor);
 }
@@ -1,15 +1,10 @@
 #include "enemy_manager.h"
+#include "../enemy_behavior.h"
 #include "../../core/game.h"
 #include "../../core/event/event_system.h"
 #include "../../core/event/event_types.h"
-#include "../../core/memory_pool.h"
+#include "../../core/replay.h"
 #include <stdlib.h>
-#include "raymath.h"
-
-// 외부 메모리 풀 참조 선언
-extern MemoryPool g_enemyEventPool;
-extern MemoryPool g_enemyStateEventPool;
-extern MemoryPool g_specialAbilityEventPool;
 
 // Legacy spawn function (kept for compatibility)
 void SpawnEnemyIfNeeded(Game* game) {
@@ -19,121 +14,109 @@ void SpawnEnemyIfNeeded(Game* game) {
     }
     
     // Original spawning logic for non-stage mode
-    float currentTime = GetTime();
-    if (currentTime - game->lastEnemySpawnTime >= ENEMY_SPAWN_TIME && game->enemyCount < MAX_ENEMIES) {
-        game->enemies[game->enemyCount] = InitEnemy(game->screenWidth, game->screenHeight);
-        
-        EnemyEventData* data = MemoryPool_Alloc(&g_enemyEventPool);
-        if (data) {
-            data->enemyIndex = game->enemyCount;
-            data->enemyPtr = &game->enemies[game->enemyCount];
-            PublishEvent(EVENT_ENEMY_SPAWNED, data);
-        }
+    float currentTime = Replay_GetTime();
+    if (currentTime - game->lastEnemySpawnTime >= ENEMY_SPAWN_TIME && !EnemyStore_IsFull(&game->enemies)) {
+        EnemyEventData data = {0};
+        EnemyMotion motion;
+        Enemy enemy = InitEnemy(game->screenWidth, game->screenHeight, &motion);
+        data.enemy = EnemyStore_Add(&game->enemies, &enemy, &motion);
+        PublishEvent(EVENT_ENEMY_SPAWNED, &data, sizeof(data));
         
-        game->enemyCount++;
         game->lastEnemySpawnTime = currentTime;
     }
 }
 
-// Enhanced update function with AI and special abilities
-void UpdateAllEnemies(Game* game) {
-    for (int i = 0; i < game->enemyCount; i++) {
-        Enemy* enemy = &game->enemies[i];
-        float prevVx = enemy->velocity.x;
-        float prevVy = enemy->velocity.y;
-        
-        // Update AI state
-        UpdateEnemyAI(enemy, game->player.position, game->deltaTime);
-        
-        // Update movement pattern
-        UpdateEnemyMovement(enemy, game->player.position, game->deltaTime);
-        
-        // Update base enemy properties
-        UpdateEnemy(enemy, game->screenWidth, game->screenHeight, game->deltaTime);
-        
-        // Execute special abilities
-        if (enemy->aiState == AI_STATE_SPECIAL) {
-            ExecuteEnemySpecialAbility(enemy, game->player.position);
-        }
-        
-        // Handle teleporter special case
-        if (enemy->type == ENEMY_TYPE_TELEPORTER && enemy->specialTimer > TELEPORT_COOLDOWN) {
-            SpecialAbilityEventData* data = MemoryPool_Alloc(&g_specialAbilityEventPool);
-            if (data) {
-                data->enemyIndex = i;
-                data->enemyPtr = enemy;
-                data->abilityType = 0; // Teleport
-                data->position = enemy->position;
-                PublishEvent(EVENT_ENEMY_TELEPORTED, data);
-            }
-        }
-        
-        // Emit state change event if velocity changed significantly
-        if ((prevVx * enemy->velocity.x < 0) || (prevVy * enemy->velocity.y < 0)) {
-            EnemyStateEventData* data = MemoryPool_Alloc(&g_enemyStateEventPool);
-            if (data) {
-                data->enemyIndex = i;
-                data->oldState = 0;
-                data->newState = 1;
-                data->enemyPtr = enemy;
-                PublishEvent(EVENT_ENEMY_STATE_CHANGED, data);
+// 타입 그룹 뒤에 이어지는 적별 처리 (prevVelocity 는 이번 프레임 갱신 전 속도)
+typedef void (*EnemyGroupStep)(Game* game, Enemy* enemy, const EnemyBehavior* behavior,
+                               Vector2 prevVelocity, void* userData);
+
+// Enemies are updated one type group at a time: the group's behavior hooks
+// are looked up once and every enemy in the group runs the same path
+// (AI, movement, base update, then the optional step).
+static void UpdateEnemyGroups(Game* game, EnemyGroupStep step, void* userData) {
+    EnemyStore* store = &game->enemies;
+    int groupStart[ENEMY_TYPE_COUNT + 1];
+    EnemyStore_GroupByType(store, groupStart);
+
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        const EnemyBehavior* behavior = EnemyBehavior_Get((EnemyType)t);
+
+        for (int g = groupStart[t]; g < groupStart[t + 1]; g++) {
+            Enemy* enemy = &store->items[store->byType[g]];
+            EnemyMotion* motion = &store->motion[store->byType[g]];
+            Vector2 prevVelocity = enemy->velocity;
+
+            UpdateEnemyAI(enemy, motion, behavior, game->player.position, game->deltaTime);
+            UpdateEnemyMovement(enemy, motion, behavior, game->player.position, game->deltaTime);
+            UpdateEnemy(enemy, behavior, game->screenWidth, game->screenHeight, game->deltaTime);
+
+            if (step) {
+                step(game, enemy, behavior, prevVelocity, userData);
             }
         }
-        
-        // Update AI state based on conditions
-        switch (enemy->type) {
-            case ENEMY_TYPE_TRACKER:
-                // Always chase unless too close
-                if (Vector2Distance(enemy->position, game->player.position) < 50.0f) {
-                    ChangeEnemyAIState(enemy, AI_STATE_FLEE);
-                } else {
-                    ChangeEnemyAIState(enemy, AI_STATE_CHASE);
-                }
-                break;
-            case ENEMY_TYPE_BOSS_1:
-            case ENEMY_TYPE_BOSS_FINAL:
-                // Boss behavior based on phase
-                if (enemy->stateData.phase == 0) {
-                    ChangeEnemyAIState(enemy, AI_STATE_ATTACK);
-                } else if (enemy->stateData.phase == 1) {
-                    // Alternate between attack and special
-                    if ((int)(GetTime() * 0.5f) % 2 == 0) {
-                        ChangeEnemyAIState(enemy, AI_STATE_ATTACK);
-                    } else {
-                        ChangeEnemyAIState(enemy, AI_STATE_SPECIAL);
-                    }
-                } else if (enemy->stateData.phase == 2) {
-                    // Rage mode - always aggressive
-                    ChangeEnemyAIState(enemy, AI_STATE_ATTACK);
-                }
-                break;
-            case ENEMY_TYPE_REPULSOR:
-                // Repulsors maintain distance
-                if (Vector2Distance(enemy->position, game->player.position) < 200.0f) {
-                    ChangeEnemyAIState(enemy, AI_STATE_FLEE);
-                } else {
-                    ChangeEnemyAIState(enemy, AI_STATE_PATROL);
-                }
-                break;
-            case ENEMY_TYPE_BLACKHOLE:
-                // Blackholes slowly drift and occasionally pulse
-                if ((int)(GetTime() * 0.3f) % 3 == 0) {
-                    ChangeEnemyAIState(enemy, AI_STATE_SPECIAL);  // Pulse phase
-                } else {
-                    ChangeEnemyAIState(enemy, AI_STATE_PATROL);   // Slow drift
-                }
-                break;
-            case ENEMY_TYPE_BASIC:
-            case ENEMY_TYPE_SPEEDY:
-            case ENEMY_TYPE_SPLITTER:
-            case ENEMY_TYPE_ORBITER:
-            case ENEMY_TYPE_TELEPORTER:
-            case ENEMY_TYPE_CLUSTER:
-            case ENEMY_TYPE_COUNT:
-                // No special AI state logic needed
-                break;
-            default:
-                break;
+    }
+}
+
+void UpdateEnemiesByType(Game* game) {
+    UpdateEnemyGroups(game, NULL, NULL);
+}
+
+// 상태 변화 배치 (UpdateAllEnemies 끝에 한 번에 발행)
+typedef struct StateChangeBatch {
+    EnemyStateEventData* items;
+    int count;
+    int capacity;
+} StateChangeBatch;
+
+// Special abilities, teleport events, state changes and AI state choice
+static void UpdateEnemyExtras(Game* game, Enemy* enemy, const EnemyBehavior* behavior,
+                              Vector2 prevVelocity, void* userData) {
+    StateChangeBatch* batch = (StateChangeBatch*)userData;
+
+    // Execute special abilities
+    if (behavior->special && enemy->aiState == AI_STATE_SPECIAL) {
+        behavior->special(enemy, game->player.position);
+    }
+    
+    // Handle teleporter special case
+    if (behavior->teleports && enemy->specialTimer > TELEPORT_COOLDOWN) {
+        SpecialAbilityEventData data = {0};
+        data.enemy = enemy->handle;
+        data.abilityType = 0; // Teleport
+        data.position = enemy->position;
+        PublishEvent(EVENT_ENEMY_TELEPORTED, &data, sizeof(data));
+    }
+    
+    // Record state change if velocity changed significantly (UpdateAllEnemies publishes the batch)
+    if (((prevVelocity.x * enemy->velocity.x < 0) || (prevVelocity.y * enemy->velocity.y < 0)) &&
+        batch->count < batch->capacity) {
+        EnemyStateEventData* data = &batch->items[batch->count++];
+        data->enemy = enemy->handle;
+        data->oldState = 0;
+        data->newState = 1;
+    }
+    
+    // Update AI state based on conditions
+    if (behavior->chooseState) {
+        behavior->chooseState(enemy, game->player.position);
+    }
+}
+
+// Enhanced update function with AI and special abilities
+void UpdateAllEnemies(Game* game) {
+    // 상태 변화 배치 버퍼 (적 저장소 용량에 맞춰 늘림)
+    static EnemyStateEventData* stateChanges = NULL;
+    static int stateChangeCapacity = 0;
+    if (stateChangeCapacity < game->enemies.capacity) {
+        EnemyStateEventData* grown = (EnemyStateEventData*)realloc(stateChanges, game->enemies.capacity * sizeof(EnemyStateEventData));
+        if (grown) {
+            stateChanges = grown;
+            stateChangeCapacity = game->enemies.capacity;
         }
     }
-}
\ No newline at end of file
+
+    StateChangeBatch batch = { stateChanges, 0, stateChangeCapacity };
+    UpdateEnemyGroups(game, UpdateEnemyExtras, &batch);
+
+    PublishEventBatch(EVENT_ENEMY_STATE_BATCH, stateChanges, sizeof(EnemyStateEventData), batch.count);
+}
@@ -1,28 +1,17 @@
 #include "item_manager.h"
 #include "../../core/event/event_system.h"
 #include "../../core/event/event_types.h"
-#include "../../core/memory_pool.h"
 
 ItemManager g_itemManager = {0};
 
-// Memory pools for item events
-MemoryPool g_itemEventPool;
-MemoryPool g_healthEventPool;
-
 void InitItemManager(void) {
     g_itemManager.hpPotion = InitHPPotion();
     g_itemManager.potionSpawnTimer = 0.0f;
     g_itemManager.initialized = true;
-    
-    // Initialize memory pools
-    MemoryPool_Init(&g_itemEventPool, sizeof(ItemEventData), 32);
-    MemoryPool_Init(&g_healthEventPool, sizeof(HealthRestoredEventData), 16);
 }
 
 void CleanupItemManager(void) {
     g_itemManager.initialized = false;
-    MemoryPool_Destroy(&g_itemEventPool);
-    MemoryPool_Destroy(&g_healthEventPool);
 }
 
 void UpdateItemManager(float deltaTime, int screenWidth, int screenHeight) {
@@ -65,22 +54,18 @@ void CheckItemCollisions(Player* player) {
             g_itemManager.hpPotion.isActive = false;
             
             // Publish collected event
-            ItemEventData* itemData = MemoryPool_Alloc(&g_itemEventPool);
-            if (itemData) {
-                itemData->itemType = 0;
-                itemData->position = g_itemManager.hpPotion.position;
-                itemData->itemPtr = &g_itemManager.hpPotion;
-                PublishEvent(EVENT_ITEM_COLLECTED, itemData);
-            }
+            ItemEventData itemData = {0};
+            itemData.itemType = 0;
+            itemData.position = g_itemManager.hpPotion.position;
+            itemData.itemPtr = &g_itemManager.hpPotion;
+            PublishEvent(EVENT_ITEM_COLLECTED, &itemData, sizeof(itemData));
             
             // Publish health restored event
-            HealthRestoredEventData* healthData = MemoryPool_Alloc(&g_healthEventPool);
-            if (healthData) {
-                healthData->oldHealth = oldHealth;
-                healthData->newHealth = player->health;
-                healthData->amountRestored = player->health - oldHealth;
-                PublishEvent(EVENT_HP_RESTORED, healthData);
-            }
+            HealthRestoredEventData healthData = {0};
+            healthData.oldHealth = oldHealth;
+            healthData.newHealth = player->health;
+            healthData.amountRestored = player->health - oldHealth;
+            PublishEvent(EVENT_HP_RESTORED, &healthData, sizeof(healthData));
         }
     }
 }
\ No newline at end of file
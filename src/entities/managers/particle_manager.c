@@ -1,28 +1,44 @@
 #include "particle_manager.h"
 #include "../../core/game.h"
 #include "../explosion.h"
+#include "../particle_kernel.h"
+#include "../../core/particle_pipeline.h"
+#include "../../core/gravity_system.h"
+#include "../../core/profiler.h"
+#include "../../core/fixed_step.h"
 #include <stdio.h>
+#include <math.h>
 
 void UpdateAllParticles(Game* game, bool isSpacePressed) {
-    for (int i = 0; i < PARTICLE_COUNT; i++) {
-        // 플레이어 중심 위치 계산
-        Vector2 playerCenter = {
-            game->player.position.x + game->player.size/2,
-            game->player.position.y + game->player.size/2
-        };
-        
-        if (isSpacePressed) {
-            AttractParticle(&game->particles[i], playerCenter, BOOSTED_ATTRACTION_FORCE);
-        } else {
-            AttractParticle(&game->particles[i], playerCenter, DEFAULT_ATTRACTION_FORCE);
-        }
-        
-        // 마찰 적용 (0.99 = 약간의 감속)
-        ApplyFriction(&game->particles[i], 0.99f);
-        
-        // 파티클 이동 및 화면 경계 처리
-        MoveParticle(&game->particles[i], game->screenWidth, game->screenHeight);
+    ParticlePipeline* pipeline = &game->particlePipeline;
+
+    // 플레이어 중심 위치 계산 (프레임당 한 번)
+    Vector2 playerCenter = {
+        game->player.position.x + game->player.size/2,
+        game->player.position.y + game->player.size/2
+    };
+    float attraction = isSpacePressed ? BOOSTED_ATTRACTION_FORCE : DEFAULT_ATTRACTION_FORCE;
+    // 상수는 60Hz 스텝 기준: 다른 시뮬레이션 속도에서는 스텝 길이에 맞춰 환산
+    float stepScale = FixedStep_Scale(game->deltaTime);
+
+    if (GetActiveGravitySourceCount() > 0 || GetQueuedRadialImpulseCount() > 0) {
+        PROFILE_BEGIN(PROFILE_ZONE_GRAVITY);
+        // 정확 모드: 그리드를 갱신하고 중력원/임펄스가 덮는 셀의 파티클만 방문 (파이프라인 전에 속도에 누적)
+        // 중력장 모드: 바뀐 중력원만 다시 굽고 샘플링은 아래 파이프라인 블록 안에서 수행
+        ApplyAllGravitySources(game, game->deltaTime);
+        PROFILE_END(PROFILE_ZONE_GRAVITY);
     }
+
+    // 인력 + 마찰(0.99 = 약간의 감속) + 이동 + 화면 경계 반사
+    pipeline->step = ParticleKernel_MakeParams(playerCenter, attraction * stepScale, powf(0.99f, stepScale),
+                                               game->screenWidth, game->screenHeight);
+    pipeline->step.moveScale = stepScale;
+
+    // 이동 직후 적과의 접촉을 같은 순회에서 기록 (ProcessEnemyCollisions 에서 처리)
+    SetEnemyContactTargets(game);
+
+    // 캐시 블록 단위로 힘 → 적분 → 접촉을 한 번에 실행 (스레드 수와 무관한 결과)
+    ParticlePipeline_Run(pipeline, &game->particles);
 }
 
 void UpdateAllExplosionParticles(Game* game) {
@@ -3,6 +3,7 @@
 
 #include "raylib.h"
 #include "../particle.h"
+#include "../particle_buffer.h"
 
 // No Game* function declarations here. See game.h for those.
 
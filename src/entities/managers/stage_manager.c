@@ -1,5 +1,6 @@
 #include "stage_manager.h"
 #include "stages/stage_common.h"
+#include "../../render/render.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -179,28 +180,28 @@ void StartNextWave(Stage* stage) {
 
 // Draw stage intro
 void DrawStageIntro(Stage* stage, int screenWidth, int screenHeight) {
-    DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.7f));
+    Render_DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.7f));
     
     char stageText[32];
     sprintf(stageText, "STAGE %d", stage->stageNumber);
     int fontSize = 48;
-    int textWidth = MeasureText(stageText, fontSize);
-    DrawText(stageText, screenWidth/2 - textWidth/2, screenHeight/2 - 100, fontSize, WHITE);
+    int textWidth = Render_MeasureText(stageText, fontSize);
+    Render_DrawText(stageText, screenWidth/2 - textWidth/2, screenHeight/2 - 100, fontSize, WHITE);
     
     fontSize = 32;
-    textWidth = MeasureText(stage->name, fontSize);
-    DrawText(stage->name, screenWidth/2 - textWidth/2, screenHeight/2 - 40, fontSize, YELLOW);
+    textWidth = Render_MeasureText(stage->name, fontSize);
+    Render_DrawText(stage->name, screenWidth/2 - textWidth/2, screenHeight/2 - 40, fontSize, YELLOW);
     
     fontSize = 20;
-    textWidth = MeasureText(stage->description, fontSize);
-    DrawText(stage->description, screenWidth/2 - textWidth/2, screenHeight/2 + 20, fontSize, LIGHTGRAY);
+    textWidth = Render_MeasureText(stage->description, fontSize);
+    Render_DrawText(stage->description, screenWidth/2 - textWidth/2, screenHeight/2 + 20, fontSize, LIGHTGRAY);
 }
 
 // Draw stage progress
 void DrawStageProgress(Stage* stage, int screenWidth) {
     char progressText[64];
     sprintf(progressText, "Stage %d - Enemies: %d/%d", stage->stageNumber, stage->enemiesKilled, stage->targetKills);
-    DrawText(progressText, screenWidth - 250, 10, 18, BLACK);
+    Render_DrawText(progressText, screenWidth - 250, 10, 18, BLACK);
     
     // Draw progress bar
     int barWidth = 200;
@@ -208,39 +209,39 @@ void DrawStageProgress(Stage* stage, int screenWidth) {
     int barX = screenWidth - 220;
     int barY = 35;
     
-    DrawRectangle(barX, barY, barWidth, barHeight, LIGHTGRAY);
+    Render_DrawRectangle(barX, barY, barWidth, barHeight, LIGHTGRAY);
     float progress = (float)stage->enemiesKilled / stage->targetKills;
-    DrawRectangle(barX, barY, (int)(barWidth * progress), barHeight, GREEN);
-    DrawRectangleLines(barX, barY, barWidth, barHeight, DARKGRAY);
+    Render_DrawRectangle(barX, barY, (int)(barWidth * progress), barHeight, GREEN);
+    Render_DrawRectangleLines(barX, barY, barWidth, barHeight, DARKGRAY);
 }
 
 // Draw boss warning
 void DrawBossWarning(int screenWidth, int screenHeight) {
-    DrawRectangle(0, 0, screenWidth, screenHeight, Fade(RED, 0.3f));
+    Render_DrawRectangle(0, 0, screenWidth, screenHeight, Fade(RED, 0.3f));
     
     const char* warningText = "! BOSS INCOMING !";
     int fontSize = 64;
-    int textWidth = MeasureText(warningText, fontSize);
+    int textWidth = Render_MeasureText(warningText, fontSize);
     
     // Flashing effect
     Color textColor = ((int)(GetTime() * 4) % 2 == 0) ? WHITE : RED;
-    DrawText(warningText, screenWidth/2 - textWidth/2, screenHeight/2 - 32, fontSize, textColor);
+    Render_DrawText(warningText, screenWidth/2 - textWidth/2, screenHeight/2 - 32, fontSize, textColor);
 }
 
 // Draw stage complete
 void DrawStageComplete(Stage* stage, int screenWidth, int screenHeight) {
-    DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.7f));
+    Render_DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.7f));
     
     const char* completeText = "STAGE COMPLETE!";
     int fontSize = 48;
-    int textWidth = MeasureText(completeText, fontSize);
-    DrawText(completeText, screenWidth/2 - textWidth/2, screenHeight/2 - 50, fontSize, GOLD);
+    int textWidth = Render_MeasureText(completeText, fontSize);
+    Render_DrawText(completeText, screenWidth/2 - textWidth/2, screenHeight/2 - 50, fontSize, GOLD);
     
     char scoreText[64];
     sprintf(scoreText, "Enemies Defeated: %d", stage->enemiesKilled);
     fontSize = 24;
-    textWidth = MeasureText(scoreText, fontSize);
-    DrawText(scoreText, screenWidth/2 - textWidth/2, screenHeight/2 + 20, fontSize, WHITE);
+    textWidth = Render_MeasureText(scoreText, fontSize);
+    Render_DrawText(scoreText, screenWidth/2 - textWidth/2, screenHeight/2 + 20, fontSize, WHITE);
 }
 
 // Initialize stage manager
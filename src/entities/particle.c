@@ -1,4 +1,6 @@
 #include "particle.h"
+#include "../core/rng.h"
+#include "../render/render.h"
 #include <math.h>
 #include <stdlib.h>
 
@@ -10,15 +12,23 @@ float RandomFloat(float min, float max) {
 
 // 파티클 초기화 (화면 크기 지정)
 Particle InitParticle(int screenWidth, int screenHeight) {
+    // 개별 생성용 순차 스트림 (ParticleBuffer_Randomize 가 쓰는 레인과 겹치지 않도록 최상위 레인 사용)
+    static Rng particleRng;
+    static bool particleRngReady = false;
+    if (!particleRngReady) {
+        Rng_Init(&particleRng, RNG_STREAM_PARTICLE_INIT, 0xFFFFFFFFu);
+        particleRngReady = true;
+    }
+
     Particle particle;
     
     // 화면 내 랜덤한 위치 지정
-    particle.position.x = GetRandomValue(0, screenWidth-1);
-    particle.position.y = GetRandomValue(0, screenHeight-1);
+    particle.position.x = (float)Rng_NextInt(&particleRng, 0, screenWidth-1);
+    particle.position.y = (float)Rng_NextInt(&particleRng, 0, screenHeight-1);
     
     // 랜덤한 초기 속도 (-1.0 ~ 1.0 범위)
-    particle.velocity.x = GetRandomValue(-100, 100) / 100.0f;
-    particle.velocity.y = GetRandomValue(-100, 100) / 100.0f;
+    particle.velocity.x = Rng_NextInt(&particleRng, -100, 100) / 100.0f;
+    particle.velocity.y = Rng_NextInt(&particleRng, -100, 100) / 100.0f;
     
     // 검은색 파티클 (투명도 100)
     particle.color = (Color){0, 0, 0, 100};
@@ -41,7 +51,7 @@ Particle InitParticleCustom(Vector2 pos, Vector2 vel, Color color) {
 float GetParticleDistance(Particle particle, Vector2 otherPos) {
     const float dx = particle.position.x - otherPos.x;
     const float dy = particle.position.y - otherPos.y;
-    return sqrt((dx*dx) + (dy*dy));
+    return sqrtf((dx*dx) + (dy*dy));
 }
 
 
@@ -87,25 +97,25 @@ void MoveParticle(Particle* particle, int screenWidth, int screenHeight) {
     // X축 경계
     if (particle->position.x <= 0) {
         particle->position.x = 0;
-        particle->velocity.x = fabs(particle->velocity.x);  // 양수로 만들어 오른쪽으로 튕김
+        particle->velocity.x = fabsf(particle->velocity.x);  // 양수로 만들어 오른쪽으로 튕김
     }
     if (particle->position.x >= screenWidth - 1) {
         particle->position.x = screenWidth - 1;
-        particle->velocity.x = -fabs(particle->velocity.x);  // 음수로 만들어 왼쪽으로 튕김
+        particle->velocity.x = -fabsf(particle->velocity.x);  // 음수로 만들어 왼쪽으로 튕김
     }
     
     // Y축 경계
     if (particle->position.y <= 0) {
         particle->position.y = 0;
-        particle->velocity.y = fabs(particle->velocity.y);  // 양수로 만들어 아래로 튕김
+        particle->velocity.y = fabsf(particle->velocity.y);  // 양수로 만들어 아래로 튕김
     }
     if (particle->position.y >= screenHeight - 1) {
         particle->position.y = screenHeight - 1;
-        particle->velocity.y = -fabs(particle->velocity.y);  // 음수로 만들어 위로 튕김
+        particle->velocity.y = -fabsf(particle->velocity.y);  // 음수로 만들어 위로 튕김
     }
 }
 
 // 파티클 그리기 (단일 픽셀)
 void DrawParticlePixel(Particle particle) {
-    DrawPixelV(particle.position, particle.color);
+    Render_DrawPixelV(particle.position, particle.color);
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include "particle_buffer.h"
+#include "../core/rng.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 정렬된 배열 시작 주소 계산
+static float* AlignUp(void* ptr) {
+    uintptr_t addr = (uintptr_t)ptr;
+    addr = (addr + PARTICLE_BUFFER_ALIGNMENT - 1) & ~(uintptr_t)(PARTICLE_BUFFER_ALIGNMENT - 1);
+    return (float*)addr;
+}
+
+bool ParticleBuffer_Init(ParticleBuffer* buffer, int capacity) {
+    memset(buffer, 0, sizeof(ParticleBuffer));
+    if (capacity <= 0) return false;
+
+    // 캐시 라인 단위로 용량 올림
+    int padded = (capacity + PARTICLE_BUFFER_LANE_PAD - 1) / PARTICLE_BUFFER_LANE_PAD * PARTICLE_BUFFER_LANE_PAD;
+    size_t arrayBytes = (size_t)padded * sizeof(float);
+
+    // 네 개의 배열을 하나의 블록에 할당 (정렬 여유분 포함)
+    buffer->block = calloc(1, arrayBytes * 4 + PARTICLE_BUFFER_ALIGNMENT);
+    if (!buffer->block) return false;
+
+    buffer->x = AlignUp(buffer->block);
+    buffer->y = buffer->x + padded;
+    buffer->vx = buffer->y + padded;
+    buffer->vy = buffer->vx + padded;
+    buffer->capacity = padded;
+    buffer->count = capacity;
+    buffer->color = (Color){0, 0, 0, 100};
+
+    return true;
+}
+
+void ParticleBuffer_Destroy(ParticleBuffer* buffer) {
+    if (buffer->block) {
+        free(buffer->block);
+    }
+    memset(buffer, 0, sizeof(ParticleBuffer));
+}
+
+// Randomize 호출 횟수 (재시작마다 다른 레인을 써서 같은 시드에서도 배치가 달라지도록)
+static uint32_t g_randomizeCount = 0;
+
+void ParticleBuffer_Randomize(ParticleBuffer* buffer, int screenWidth, int screenHeight) {
+    uint32_t lane = g_randomizeCount++ * 4;
+
+    // 성분 배열마다 하나의 레인으로 일괄 생성
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, lane + 0, 0, buffer->x, buffer->count, 0.0f, (float)(screenWidth - 1));
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, lane + 1, 0, buffer->y, buffer->count, 0.0f, (float)(screenHeight - 1));
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, lane + 2, 0, buffer->vx, buffer->count, -1.0f, 1.0f);
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, lane + 3, 0, buffer->vy, buffer->count, -1.0f, 1.0f);
+}
+
+Particle ParticleBuffer_Get(const ParticleBuffer* buffer, int index) {
+    Particle particle = {
+        .position = { buffer->x[index], buffer->y[index] },
+        .velocity = { buffer->vx[index], buffer->vy[index] },
+        .color = buffer->color
+    };
+    return particle;
+}
+
+void ParticleBuffer_Set(ParticleBuffer* buffer, int index, Particle particle) {
+    buffer->x[index] = particle.position.x;
+    buffer->y[index] = particle.position.y;
+    buffer->vx[index] = particle.velocity.x;
+    buffer->vy[index] = particle.velocity.y;
+}
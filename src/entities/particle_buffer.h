@@ -0,0 +1,68 @@
+#ifndef PARTICLE_BUFFER_H
+#define PARTICLE_BUFFER_H
+
+#include "raylib.h"
+#include "particle.h"
+#include <stdbool.h>
+
+// Every component array starts on a cache line boundary, and the capacity is
+// padded to a whole number of cache lines so vector loops never need a
+// partial tail load on the last line.
+#define PARTICLE_BUFFER_ALIGNMENT 64
+#define PARTICLE_BUFFER_LANE_PAD (PARTICLE_BUFFER_ALIGNMENT / (int)sizeof(float))
+
+/**
+ * @brief Structure-of-arrays particle storage
+ *
+ * Positions and velocities live in separate aligned float arrays so passes
+ * that only need positions (collision, gravity range checks, rendering) stream
+ * half the memory an array of Particle structs would. All particles share a
+ * single color, which is set per stage.
+ */
+typedef struct ParticleBuffer {
+    float* x;           // Position X
+    float* y;           // Position Y
+    float* vx;          // Velocity X
+    float* vy;          // Velocity Y
+    Color color;        // Shared particle color
+    int count;          // Live particle count
+    int capacity;       // Allocated particles per array (multiple of LANE_PAD)
+    void* block;        // Backing allocation owning all four arrays
+} ParticleBuffer;
+
+// Allocate storage for at least `capacity` particles (count starts at capacity)
+bool ParticleBuffer_Init(ParticleBuffer* buffer, int capacity);
+// Release storage
+void ParticleBuffer_Destroy(ParticleBuffer* buffer);
+// Scatter every particle randomly across the screen (RNG_STREAM_PARTICLE_INIT, reproducible per seed)
+void ParticleBuffer_Randomize(ParticleBuffer* buffer, int screenWidth, int screenHeight);
+
+// AoS view helpers for code that works on one particle at a time
+// (Set ignores particle.color; the shared color is owned by the buffer)
+Particle ParticleBuffer_Get(const ParticleBuffer* buffer, int index);
+void ParticleBuffer_Set(ParticleBuffer* buffer, int index, Particle particle);
+
+static inline Vector2 ParticleBuffer_GetPosition(const ParticleBuffer* buffer, int index) {
+    return (Vector2){ buffer->x[index], buffer->y[index] };
+}
+
+static inline void ParticleBuffer_SetPosition(ParticleBuffer* buffer, int index, Vector2 position) {
+    buffer->x[index] = position.x;
+    buffer->y[index] = position.y;
+}
+
+static inline Vector2 ParticleBuffer_GetVelocity(const ParticleBuffer* buffer, int index) {
+    return (Vector2){ buffer->vx[index], buffer->vy[index] };
+}
+
+static inline void ParticleBuffer_SetVelocity(ParticleBuffer* buffer, int index, Vector2 velocity) {
+    buffer->vx[index] = velocity.x;
+    buffer->vy[index] = velocity.y;
+}
+
+static inline void ParticleBuffer_AddVelocity(ParticleBuffer* buffer, int index, float dvx, float dvy) {
+    buffer->vx[index] += dvx;
+    buffer->vy[index] += dvy;
+}
+
+#endif // PARTICLE_BUFFER_H
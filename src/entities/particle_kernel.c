@@ -0,0 +1,210 @@
+#include "particle_kernel.h"
+#include <float.h>
+#include <math.h>
+
+// PARTICLE_KERNEL_FORCE_SCALAR 는 SIMD 대상에서도 스칼라 경로만 빌드 (make test-kernel 에서 사용)
+#if defined(PARTICLE_KERNEL_FORCE_SCALAR)
+#elif defined(__AVX__)
+#include <immintrin.h>
+#define PARTICLE_KERNEL_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PARTICLE_KERNEL_SSE2 1
+#endif
+
+// AttractParticle의 최소 거리 (0.5 이하로 가까워져도 힘이 폭주하지 않도록)
+#define KERNEL_MIN_ATTRACT_DIST 0.5f
+
+ParticleStepParams ParticleKernel_MakeParams(Vector2 attractor, float attraction, float friction,
+                                             int screenWidth, int screenHeight) {
+    ParticleStepParams params = {
+        .attractor = attractor,
+        .attraction = attraction,
+        .friction = friction,
+        .moveScale = 1.0f,
+        .maxX = (float)(screenWidth - 1),
+        .maxY = (float)(screenHeight - 1)
+    };
+    return params;
+}
+
+// 한 축에 대한 경계 반사: 벽 밖이면 벽 위치로 고정하고 속도 부호를 벽 안쪽으로
+static inline void ReflectAxis(float* pos, float* vel, float maxPos) {
+    float p = *pos;
+    float speed = fabsf(*vel);
+    float v = (p <= 0.0f) ? speed : *vel;
+    p = fmaxf(p, 0.0f);
+    v = (p >= maxPos) ? -speed : v;
+    *pos = fminf(p, maxPos);
+    *vel = v;
+}
+
+// 스칼라 버전: SIMD 루프의 나머지 처리와 SIMD 미지원 환경에서 사용
+static inline void StepScalar(ParticleBuffer* buffer, int i, const ParticleStepParams* params) {
+    float dx = buffer->x[i] - params->attractor.x;
+    float dy = buffer->y[i] - params->attractor.y;
+
+    // 정규화와 거리 나눗셈을 하나의 계수로 합침 (d == 0 이면 dx, dy 가 0 이므로 힘도 0)
+    float dist = sqrtf(fmaxf(dx*dx + dy*dy, FLT_MIN));
+    float scale = params->attraction / (dist * fmaxf(dist, KERNEL_MIN_ATTRACT_DIST));
+
+    float vx = (buffer->vx[i] - dx * scale) * params->friction;
+    float vy = (buffer->vy[i] - dy * scale) * params->friction;
+    float x = buffer->x[i] + vx * params->moveScale;
+    float y = buffer->y[i] + vy * params->moveScale;
+
+    ReflectAxis(&x, &vx, params->maxX);
+    ReflectAxis(&y, &vy, params->maxY);
+
+    buffer->x[i] = x;
+    buffer->y[i] = y;
+    buffer->vx[i] = vx;
+    buffer->vy[i] = vy;
+}
+
+#if defined(PARTICLE_KERNEL_AVX)
+
+static inline __m256 ReflectAxis8(__m256* pos, __m256 vel, __m256 maxPos, __m256 signMask) {
+    __m256 zero = _mm256_setzero_ps();
+    __m256 speed = _mm256_andnot_ps(signMask, vel);
+    __m256 low = _mm256_cmp_ps(*pos, zero, _CMP_LE_OQ);
+    vel = _mm256_blendv_ps(vel, speed, low);
+    __m256 p = _mm256_max_ps(*pos, zero);
+    __m256 high = _mm256_cmp_ps(p, maxPos, _CMP_GE_OQ);
+    vel = _mm256_blendv_ps(vel, _mm256_or_ps(speed, signMask), high);
+    *pos = _mm256_min_ps(p, maxPos);
+    return vel;
+}
+
+static int StepWide(ParticleBuffer* buffer, int begin, int end, const ParticleStepParams* params) {
+    const __m256 ax = _mm256_set1_ps(params->attractor.x);
+    const __m256 ay = _mm256_set1_ps(params->attractor.y);
+    const __m256 attraction = _mm256_set1_ps(params->attraction);
+    const __m256 friction = _mm256_set1_ps(params->friction);
+    const __m256 moveScale = _mm256_set1_ps(params->moveScale);
+    const __m256 maxX = _mm256_set1_ps(params->maxX);
+    const __m256 maxY = _mm256_set1_ps(params->maxY);
+    const __m256 minDist = _mm256_set1_ps(KERNEL_MIN_ATTRACT_DIST);
+    const __m256 minDistSq = _mm256_set1_ps(FLT_MIN);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+    int i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 x = _mm256_loadu_ps(buffer->x + i);
+        __m256 y = _mm256_loadu_ps(buffer->y + i);
+        __m256 vx = _mm256_loadu_ps(buffer->vx + i);
+        __m256 vy = _mm256_loadu_ps(buffer->vy + i);
+
+        __m256 dx = _mm256_sub_ps(x, ax);
+        __m256 dy = _mm256_sub_ps(y, ay);
+        __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 dist = _mm256_sqrt_ps(_mm256_max_ps(distSq, minDistSq));
+        __m256 scale = _mm256_div_ps(attraction, _mm256_mul_ps(dist, _mm256_max_ps(dist, minDist)));
+
+        vx = _mm256_mul_ps(_mm256_sub_ps(vx, _mm256_mul_ps(dx, scale)), friction);
+        vy = _mm256_mul_ps(_mm256_sub_ps(vy, _mm256_mul_ps(dy, scale)), friction);
+        x = _mm256_add_ps(x, _mm256_mul_ps(vx, moveScale));
+        y = _mm256_add_ps(y, _mm256_mul_ps(vy, moveScale));
+
+        vx = ReflectAxis8(&x, vx, maxX, signMask);
+        vy = ReflectAxis8(&y, vy, maxY, signMask);
+
+        _mm256_storeu_ps(buffer->x + i, x);
+        _mm256_storeu_ps(buffer->y + i, y);
+        _mm256_storeu_ps(buffer->vx + i, vx);
+        _mm256_storeu_ps(buffer->vy + i, vy);
+    }
+    return i;
+}
+
+#elif defined(PARTICLE_KERNEL_SSE2)
+
+// SSE2 에는 blendv 가 없으므로 and/andnot/or 로 선택
+static inline __m128 Select4(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+static inline __m128 ReflectAxis4(__m128* pos, __m128 vel, __m128 maxPos, __m128 signMask) {
+    __m128 zero = _mm_setzero_ps();
+    __m128 speed = _mm_andnot_ps(signMask, vel);
+    __m128 low = _mm_cmple_ps(*pos, zero);
+    vel = Select4(low, speed, vel);
+    __m128 p = _mm_max_ps(*pos, zero);
+    __m128 high = _mm_cmpge_ps(p, maxPos);
+    vel = Select4(high, _mm_or_ps(speed, signMask), vel);
+    *pos = _mm_min_ps(p, maxPos);
+    return vel;
+}
+
+static int StepWide(ParticleBuffer* buffer, int begin, int end, const ParticleStepParams* params) {
+    const __m128 ax = _mm_set1_ps(params->attractor.x);
+    const __m128 ay = _mm_set1_ps(params->attractor.y);
+    const __m128 attraction = _mm_set1_ps(params->attraction);
+    const __m128 friction = _mm_set1_ps(params->friction);
+    const __m128 moveScale = _mm_set1_ps(params->moveScale);
+    const __m128 maxX = _mm_set1_ps(params->maxX);
+    const __m128 maxY = _mm_set1_ps(params->maxY);
+    const __m128 minDist = _mm_set1_ps(KERNEL_MIN_ATTRACT_DIST);
+    const __m128 minDistSq = _mm_set1_ps(FLT_MIN);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+
+    int i = begin;
+    for (; i + 4 <= end; i += 4) {
+        __m128 x = _mm_loadu_ps(buffer->x + i);
+        __m128 y = _mm_loadu_ps(buffer->y + i);
+        __m128 vx = _mm_loadu_ps(buffer->vx + i);
+        __m128 vy = _mm_loadu_ps(buffer->vy + i);
+
+        __m128 dx = _mm_sub_ps(x, ax);
+        __m128 dy = _mm_sub_ps(y, ay);
+        __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 dist = _mm_sqrt_ps(_mm_max_ps(distSq, minDistSq));
+        __m128 scale = _mm_div_ps(attraction, _mm_mul_ps(dist, _mm_max_ps(dist, minDist)));
+
+        vx = _mm_mul_ps(_mm_sub_ps(vx, _mm_mul_ps(dx, scale)), friction);
+        vy = _mm_mul_ps(_mm_sub_ps(vy, _mm_mul_ps(dy, scale)), friction);
+        x = _mm_add_ps(x, _mm_mul_ps(vx, moveScale));
+        y = _mm_add_ps(y, _mm_mul_ps(vy, moveScale));
+
+        vx = ReflectAxis4(&x, vx, maxX, signMask);
+        vy = ReflectAxis4(&y, vy, maxY, signMask);
+
+        _mm_storeu_ps(buffer->x + i, x);
+        _mm_storeu_ps(buffer->y + i, y);
+        _mm_storeu_ps(buffer->vx + i, vx);
+        _mm_storeu_ps(buffer->vy + i, vy);
+    }
+    return i;
+}
+
+#else
+
+static int StepWide(ParticleBuffer* buffer, int begin, int end, const ParticleStepParams* params) {
+    (void)buffer;
+    (void)end;
+    (void)params;
+    return begin;
+}
+
+#endif
+
+void ParticleKernel_Step(ParticleBuffer* buffer, int begin, int end, const ParticleStepParams* params) {
+    if (begin < 0) begin = 0;
+    if (end > buffer->count) end = buffer->count;
+
+    // 호출자가 배열을 여러 범위로 나눠 처리할 수 있으므로 end 너머(패딩 포함)는 건드리지 않고 나머지는 스칼라로 처리
+    int i = StepWide(buffer, begin, end, params);
+    for (; i < end; i++) {
+        StepScalar(buffer, i, params);
+    }
+}
+
+const char* ParticleKernel_GetPathName(void) {
+#if defined(PARTICLE_KERNEL_AVX)
+    return "avx";
+#elif defined(PARTICLE_KERNEL_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
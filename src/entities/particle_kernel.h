@@ -0,0 +1,40 @@
+#ifndef PARTICLE_KERNEL_H
+#define PARTICLE_KERNEL_H
+
+#include "raylib.h"
+#include "particle_buffer.h"
+
+/**
+ * @brief Per-frame constants for the particle integration kernel
+ *
+ * Everything the kernel needs is computed once per frame by the caller, so
+ * the inner loop only touches the four particle arrays.
+ */
+typedef struct ParticleStepParams {
+    Vector2 attractor;  // Attraction target (player center)
+    float attraction;   // Attraction multiplier (DEFAULT/BOOSTED_ATTRACTION_FORCE)
+    float friction;     // Velocity multiplier applied after attraction
+    float moveScale;    // Position advance per unit of velocity (FixedStep_Scale, 1 at the reference rate)
+    float maxX;         // Right wall (screenWidth - 1)
+    float maxY;         // Bottom wall (screenHeight - 1)
+} ParticleStepParams;
+
+// Build step parameters from screen size (walls at 0 and size - 1, like MoveParticle; moveScale 1)
+ParticleStepParams ParticleKernel_MakeParams(Vector2 attractor, float attraction, float friction,
+                                             int screenWidth, int screenHeight);
+
+/**
+ * @brief Attract, apply friction, move and bounce particles [begin, end)
+ *
+ * Equivalent to AttractParticle + ApplyFriction + MoveParticle per particle,
+ * evaluated in single precision with branchless wall reflection. Uses AVX or
+ * SSE2 when the compiler targets them (make SIMD=avx for AVX), otherwise a
+ * scalar loop (PARTICLE_KERNEL_FORCE_SCALAR forces the scalar loop; make
+ * test-kernel checks each path).
+ */
+void ParticleKernel_Step(ParticleBuffer* buffer, int begin, int end, const ParticleStepParams* params);
+
+// Name of the code path selected at compile time ("avx", "sse2" or "scalar")
+const char* ParticleKernel_GetPathName(void);
+
+#endif // PARTICLE_KERNEL_H
@@ -1,9 +1,13 @@
 #include "player.h"
+#include "../core/replay.h"
+#include "../core/fixed_step.h"
+#include "../render/render.h"
 #include <math.h>
 
 Player InitPlayer(int screenWidth, int screenHeight) {
     Player player = {
         .position = (Vector2){ screenWidth/2, screenHeight/2 },
+        .previousPosition = (Vector2){ screenWidth/2, screenHeight/2 },
         .size = PLAYER_BASE_SIZE,
         .health = 3,
         .invincibleTimer = 0.0f,
@@ -64,10 +68,10 @@ void UpdatePlayer(Player* player, int screenWidth, int screenHeight, int moveSpe
     
     // 이동 방향 계산 (벡터)
     Vector2 direction = {0, 0};
-    if (IsKeyDown(KEY_RIGHT)) direction.x += 1;
-    if (IsKeyDown(KEY_LEFT)) direction.x -= 1;
-    if (IsKeyDown(KEY_DOWN)) direction.y += 1;
-    if (IsKeyDown(KEY_UP)) direction.y -= 1;
+    if (Replay_IsKeyDown(KEY_RIGHT)) direction.x += 1;
+    if (Replay_IsKeyDown(KEY_LEFT)) direction.x -= 1;
+    if (Replay_IsKeyDown(KEY_DOWN)) direction.y += 1;
+    if (Replay_IsKeyDown(KEY_UP)) direction.y -= 1;
     
     // 대각선 이동 보정 (방향 벡터 정규화)
     if (direction.x != 0 && direction.y != 0) {
@@ -78,7 +82,8 @@ void UpdatePlayer(Player* player, int screenWidth, int screenHeight, int moveSpe
         direction.y /= length;
     }
     
-    // 속도 적용
+    // 속도 적용 (moveSpeed 는 기준 스텝당 픽셀)
+    speed *= FixedStep_Scale(deltaTime);
     player->position.x += direction.x * speed;
     player->position.y += direction.y * speed;
 
@@ -99,7 +104,7 @@ void UpdatePlayer(Player* player, int screenWidth, int screenHeight, int moveSpe
 }
 
 void DrawPlayer(Player player) {
-    DrawRectangle(
+    Render_DrawRectangle(
         player.position.x,
         player.position.y,
         player.size,
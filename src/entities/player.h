@@ -14,6 +14,7 @@
 // Player structure
 typedef struct {
     Vector2 position;
+    Vector2 previousPosition; // Position before the last simulation step (render interpolation)
     float size;        // Current player size
     int health;        // Player health (max 3)
     float invincibleTimer; // Invincibility timer
@@ -2,10 +2,25 @@
 #include "core/game.h"
 #include "core/event/event_system.h"
 #include "core/input_handler.h"
+#include "core/thread_pool.h"
+#include "core/rng.h"
+#include "core/profiler.h"
+#include "core/replay.h"
+#include "core/gravity_system.h"
+#include "render/render.h"
+#include "render/frame_capture.h"
+#include "entities/particle_kernel.h"
 #include "entities/managers/stage_manager.h"
 #include "entities/managers/stages/stage_common.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+// Frames a headless run simulates when --frames is not given (60 s at 60 FPS)
+#define HEADLESS_DEFAULT_FRAME_LIMIT 3600
+// Highest --start-stage value (stage_10)
+#define MAX_STARTING_STAGE 10
 
 // RegisterEnemyEventHandlers 함수 선언
 void RegisterEnemyEventHandlers(void);
@@ -21,7 +36,7 @@ int ParseStartingStage(int argc, char *argv[]) {
     for (int i = 1; i < argc - 1; i++) {
         if (strcmp(argv[i], "--start-stage") == 0) {
             int stage = atoi(argv[i + 1]);
-            if (stage >= 1 && stage <= 10) {
+            if (stage >= 1 && stage <= MAX_STARTING_STAGE) {
                 return stage;
             }
         }
@@ -45,6 +60,185 @@ bool ParseTestMode(int argc, char *argv[]) {
     return false;
 }
 
+/**
+ * Parse command line arguments for the gravity evaluation mode
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return GRAVITY_MODE_FIELD if --gravity-field was given, otherwise GRAVITY_MODE_EXACT
+ */
+GravityMode ParseGravityMode(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--gravity-field") == 0) {
+            return GRAVITY_MODE_FIELD;
+        }
+    }
+    return GRAVITY_MODE_EXACT;
+}
+
+/**
+ * Parse command line arguments for the render backend
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Backend named by --render (raylib | software), RENDER_BACKEND_RAYLIB if not given
+ */
+RenderBackendType ParseRenderBackend(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--render") == 0) {
+            return Render_ParseBackendType(argv[i + 1]);
+        }
+    }
+    return RENDER_BACKEND_RAYLIB;
+}
+
+/**
+ * Parse command line arguments for worker thread count
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Thread count including the main thread (default 1)
+ */
+int ParseThreadCount(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--threads") == 0) {
+            int threads = atoi(argv[i + 1]);
+            if (threads >= 1 && threads <= THREAD_POOL_MAX_THREADS) {
+                return threads;
+            }
+        }
+    }
+    return 1;  // Main thread only
+}
+
+/**
+ * Parse command line arguments for particle count
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Particle count (DEFAULT_PARTICLE_COUNT if not given or out of range)
+ */
+int ParseParticleCount(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--particles") == 0) {
+            int count = atoi(argv[i + 1]);
+            if (count >= MIN_PARTICLE_COUNT && count <= MAX_PARTICLE_COUNT) {
+                return count;
+            }
+            printf("--particles must be between %d and %d, using %d\n",
+                   MIN_PARTICLE_COUNT, MAX_PARTICLE_COUNT, DEFAULT_PARTICLE_COUNT);
+        }
+    }
+    return DEFAULT_PARTICLE_COUNT;
+}
+
+/**
+ * Parse command line arguments for the enemy store capacity
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Maximum live enemies (DEFAULT_ENEMY_CAPACITY if not given or out of range)
+ */
+int ParseEnemyCapacity(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--max-enemies") == 0) {
+            int capacity = atoi(argv[i + 1]);
+            if (capacity >= DEFAULT_ENEMY_CAPACITY && capacity <= MAX_ENEMY_CAPACITY) {
+                return capacity;
+            }
+            printf("--max-enemies must be between %d and %d, using %d\n",
+                   DEFAULT_ENEMY_CAPACITY, MAX_ENEMY_CAPACITY, DEFAULT_ENEMY_CAPACITY);
+        }
+    }
+    return DEFAULT_ENEMY_CAPACITY;
+}
+
+/**
+ * Parse command line arguments for the random seed
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Seed from --seed, or the current time if not given
+ */
+uint64_t ParseSeed(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--seed") == 0) {
+            return strtoull(argv[i + 1], NULL, 10);
+        }
+    }
+    return (uint64_t)time(NULL);
+}
+
+/**
+ * Parse command line arguments for the frame limit
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Number of frames to run before exiting (0 = until the window closes)
+ */
+int ParseFrameLimit(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--frames") == 0) {
+            int frames = atoi(argv[i + 1]);
+            if (frames > 0) {
+                return frames;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * Parse command line arguments for the fixed simulation rate
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return Simulation steps per second (SIM_DEFAULT_RATE if not given or out of range)
+ */
+int ParseSimRate(int argc, char *argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--sim-hz") == 0) {
+            int rate = atoi(argv[i + 1]);
+            if (rate >= SIM_MIN_RATE && rate <= SIM_MAX_RATE) {
+                return rate;
+            }
+        }
+    }
+    return SIM_DEFAULT_RATE;
+}
+
+/**
+ * Check a replay header against the bounds the command line options accept
+ *
+ * @param header Header read by Replay_StartPlayback
+ * @return true if every session setting is one the CLI parsers could have produced
+ */
+bool IsValidReplayHeader(const ReplayHeader* header) {
+    return header->startingStage >= 0 && header->startingStage <= MAX_STARTING_STAGE
+        && (header->testMode == 0 || header->testMode == 1)
+        && header->particleCount >= MIN_PARTICLE_COUNT && header->particleCount <= MAX_PARTICLE_COUNT
+        && header->enemyCapacity >= DEFAULT_ENEMY_CAPACITY && header->enemyCapacity <= MAX_ENEMY_CAPACITY
+        && (header->gravityMode == GRAVITY_MODE_EXACT || header->gravityMode == GRAVITY_MODE_FIELD)
+        && header->simRate >= SIM_MIN_RATE && header->simRate <= SIM_MAX_RATE;
+}
+
+/**
+ * Parse a command line option that takes a file path
+ *
+ * @param argc Argument count
+ * @param argv Argument values
+ * @param name Option name (e.g. "--replay")
+ * @return The path following the option, or NULL if not given
+ */
+const char* ParsePathOption(int argc, char *argv[], const char* name) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return NULL;
+}
+
 int main(int argc, char *argv[])
 {
     const int screenWidth = 800;
@@ -56,6 +250,90 @@ int main(int argc, char *argv[])
     // Parse command-line arguments for stage selection
     int startingStage = ParseStartingStage(argc, argv);
     bool testMode = ParseTestMode(argc, argv);
+    int threadCount = ParseThreadCount(argc, argv);
+    int particleCount = ParseParticleCount(argc, argv);
+    int enemyCapacity = ParseEnemyCapacity(argc, argv);
+    uint64_t seed = ParseSeed(argc, argv);
+    int frameLimit = ParseFrameLimit(argc, argv);
+    GravityMode gravityMode = ParseGravityMode(argc, argv);
+    int simRate = ParseSimRate(argc, argv);
+    RenderBackendType renderBackend = ParseRenderBackend(argc, argv);
+    const char* tracePath = ParsePathOption(argc, argv, "--profile-trace");
+    const char* recordPath = ParsePathOption(argc, argv, "--record");
+    const char* replayPath = ParsePathOption(argc, argv, "--replay");
+    const char* capturePath = ParsePathOption(argc, argv, "--capture");
+    FrameCaptureFormat captureFormat = FrameCapture_ParseFormat(ParsePathOption(argc, argv, "--capture-format"));
+
+    // 헤드리스 빌드는 창이 없어 튜토리얼을 넘길 ENTER 도 창 닫기도 없음:
+    // 스테이지 1 부터 시작하고 --frames 가 없으면 기본 프레임 수만큼만 실행 (재생은 녹화 그대로)
+    if (!IsWindowReady() && !replayPath) {
+        if (startingStage == 0 && !testMode) {
+            startingStage = 1;
+        }
+        if (frameLimit == 0) {
+            frameLimit = HEADLESS_DEFAULT_FRAME_LIMIT;
+        }
+    }
+
+    // 재생 시 녹화 당시의 시드/스테이지/파티클 수로 같은 세션을 다시 시작
+    if (replayPath) {
+        ReplayHeader header;
+        if (!Replay_StartPlayback(replayPath, &header)) {
+            CloseWindow();
+            return 1;
+        }
+        if (!IsValidReplayHeader(&header)) {
+            printf("Replay: %s has out-of-range session settings\n", replayPath);
+            Replay_Stop();
+            CloseWindow();
+            return 1;
+        }
+        seed = header.seed;
+        startingStage = header.startingStage;
+        testMode = header.testMode != 0;
+        particleCount = header.particleCount;
+        enemyCapacity = header.enemyCapacity;
+        gravityMode = (GravityMode)header.gravityMode;
+        simRate = header.simRate;
+    } else if (recordPath) {
+        ReplayHeader header = {
+            .seed = seed,
+            .startingStage = startingStage,
+            .testMode = testMode ? 1 : 0,
+            .particleCount = particleCount,
+            .enemyCapacity = enemyCapacity,
+            .gravityMode = gravityMode,
+            .simRate = simRate
+        };
+        Replay_StartRecording(recordPath, &header);
+    }
+
+    // 같은 시드로 실행하면 같은 게임이 재현되도록 전역 시드 설정 (InitGame 이 raylib 시드도 맞춤)
+    Rng_SetSeed(seed);
+    printf("Random seed: %llu (use --seed to reproduce)\n", (unsigned long long)seed);
+    printf("Particle kernel: %s (make SIMD=avx|native to change)\n", ParticleKernel_GetPathName());
+
+    // 중력 계산 방식 (정확 / 구워진 중력장)
+    SetGravityMode(gravityMode);
+
+    // 파티클 업데이트용 워커 스레드 시작
+    ThreadPool_Init(threadCount);
+
+    // 렌더링 백엔드 (software 는 CPU 래스터라이저로 메모리 프레임버퍼에 그림)
+    // 캡처는 CPU 프레임버퍼가 필요하므로 software 백엔드를 사용
+    if (capturePath && renderBackend != RENDER_BACKEND_SOFTWARE) {
+        printf("Capture: using the software render backend\n");
+        renderBackend = RENDER_BACKEND_SOFTWARE;
+    }
+    Render_Init(renderBackend, screenWidth, screenHeight);
+
+    // 렌더링된 프레임을 백그라운드 스레드가 capturePath 에 기록
+    if (capturePath) {
+        int frameWidth, frameHeight;
+        if (Render_GetFramebuffer(&frameWidth, &frameHeight)) {
+            FrameCapture_Start(capturePath, captureFormat, frameWidth, frameHeight);
+        }
+    }
 
     // 이벤트 시스템 초기화
     InitEventSystem();
@@ -63,7 +341,11 @@ int main(int argc, char *argv[])
     // 스테이지 매니저 초기화
     InitStageManager();
 
-    Game game = InitGame(screenWidth, screenHeight);
+    Game game = InitGame(screenWidth, screenHeight, particleCount, enemyCapacity);
+
+    // 고정 시뮬레이션 속도 (렌더링은 프레임마다, 시뮬레이션은 simRate 스텝마다)
+    FixedStep_Init(&game.clock, simRate);
+    game.deltaTime = game.clock.stepSeconds;
 
     // Jump to specific stage if requested (for testing)
     if (startingStage > 0) {
@@ -108,10 +390,17 @@ int main(int argc, char *argv[])
         InitInputHandler(&game);
     }
 
-    while (!WindowShouldClose())
+    // --frames 지정 시 N 프레임 후 종료 (헤드리스 빌드는 창 닫기 이벤트가 없음)
+    int frame = 0;
+    while (!WindowShouldClose() && !Replay_IsFinished() && (frameLimit == 0 || frame < frameLimit))
     {
+        PROFILE_FRAME_BEGIN();
+
+        // 이번 프레임 입력/델타 확정 (녹화 시 기록, 재생 시 파일에서 읽음)
+        Replay_BeginFrame();
+
         // 프레임 시작 이벤트 발행
-        PublishEvent(EVENT_FRAME_START, NULL);
+        PublishEvent(EVENT_FRAME_START, NULL, 0);
         
         // 키보드 입력 이벤트 처리 (이벤트 발행)
         if (game.useEventSystem) {
@@ -119,15 +408,45 @@ int main(int argc, char *argv[])
         }
         
         // 이벤트 큐 처리 - 게임 업데이트 전에 처리하여 입력 이벤트가 즉시 반영되도록 함
+        PROFILE_BEGIN(PROFILE_ZONE_EVENTS);
         ProcessEventQueue();
+        PROFILE_END(PROFILE_ZONE_EVENTS);
         
         // 게임 업데이트
         UpdateGame(&game);
         
+        PROFILE_BEGIN(PROFILE_ZONE_DRAW);
         DrawGame(&game);
+        PROFILE_END(PROFILE_ZONE_DRAW);
+
+        // 방금 그린 프레임을 캡처 링에 복사 (인코더가 밀리면 버려짐)
+        if (FrameCapture_IsActive()) {
+            PROFILE_BEGIN(PROFILE_ZONE_CAPTURE);
+            FrameCapture_Submit(Render_GetFramebuffer(NULL, NULL));
+            PROFILE_END(PROFILE_ZONE_CAPTURE);
+        }
         
         // 프레임 종료 이벤트 발행
-        PublishEvent(EVENT_FRAME_END, NULL);
+        PublishEvent(EVENT_FRAME_END, NULL, 0);
+        frame++;
+
+        PROFILE_FRAME_END();
+    }
+
+    if (frameLimit > 0 || replayPath) {
+        printf("Ran %d frames: stage %d, score %d, enemies %d, player health %d\n",
+               frame, game.currentStageNumber, game.score, game.enemies.count, game.player.health);
+    }
+
+    // 녹화 파일 마무리 또는 재생 프레임 시간 통계 출력
+    Replay_Stop();
+
+    // 남은 캡처 프레임을 모두 쓰고 버린 프레임 수 출력
+    FrameCapture_Stop();
+
+    // 마지막 PROFILER_HISTORY_FRAMES 프레임을 Chrome trace 로 저장
+    if (tracePath) {
+        Profiler_WriteChromeTrace(tracePath);
     }
 
     // 입력 핸들러 정리
@@ -138,6 +457,8 @@ int main(int argc, char *argv[])
     // 이벤트 시스템 정리
     CleanupEventSystem();
     CleanupGame(&game);
+    Render_Shutdown();
+    ThreadPool_Shutdown();
     
     CloseWindow();
     return 0;
@@ -0,0 +1,252 @@
+/**
+ * Headless platform layer
+ *
+ * Implements the subset of the raylib API the game uses without a window,
+ * GPU or input devices, so the simulation can run on CI and benchmark boxes.
+ * Linked instead of libraylib by `make headless` (bin/game_headless).
+ *
+ * - Window: never opens; IsWindowReady() and WindowShouldClose() stay false, so
+ *   main starts at stage 1 (no ENTER to leave the tutorial) and stops after
+ *   --frames (default HEADLESS_DEFAULT_FRAME_LIMIT)
+ * - Time: fixed delta per frame, GetTime() is simulated time (frames * delta)
+ * - Input: no keys or buttons are ever pressed
+ * - Drawing: no-ops
+ * - Random/collision/text helpers: same results as raylib 5
+ */
+#define RAYMATH_IMPLEMENTATION
+#include "raylib.h"
+#include "raymath.h"
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+// windows.h 는 raylib.h 와 이름이 충돌하므로 필요한 함수만 선언
+__declspec(dllimport) int __stdcall QueryPerformanceCounter(long long* count);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long* frequency);
+#else
+#include <time.h>
+#endif
+
+#define HEADLESS_DEFAULT_FPS 60
+#define HEADLESS_TEXT_BUFFERS 4
+#define HEADLESS_TEXT_LENGTH 1024
+
+static int g_targetFps = HEADLESS_DEFAULT_FPS;
+static long g_frameCount = 0;
+static double g_wallStart = 0.0;
+
+// 벽시계 시간 (초), 실행 시간 보고용
+static double WallClockSeconds(void) {
+#ifdef _WIN32
+    long long count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (double)count / (double)frequency;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+//------------------------------------------------------------------------------------
+// Window and timing
+//------------------------------------------------------------------------------------
+
+void InitWindow(int width, int height, const char* title) {
+    printf("Headless mode: %dx%d \"%s\" (no window)\n", width, height, title ? title : "");
+    g_frameCount = 0;
+    g_wallStart = WallClockSeconds();
+}
+
+void CloseWindow(void) {
+    double elapsed = WallClockSeconds() - g_wallStart;
+    printf("Headless run: %ld frames (%.2f s simulated) in %.3f s wall, %.3f ms/frame\n",
+           g_frameCount, GetTime(), elapsed,
+           g_frameCount > 0 ? elapsed * 1000.0 / (double)g_frameCount : 0.0);
+}
+
+// 창이 없음을 알림 (main 이 헤드리스 실행을 구분하는 데 사용)
+bool IsWindowReady(void) {
+    return false;
+}
+
+bool WindowShouldClose(void) {
+    return false;
+}
+
+void SetTargetFPS(int fps) {
+    g_targetFps = (fps > 0) ? fps : HEADLESS_DEFAULT_FPS;
+}
+
+// 프레임 레이트와 무관하게 항상 고정 델타 (실제 대기 없음)
+float GetFrameTime(void) {
+    return 1.0f / (float)g_targetFps;
+}
+
+double GetTime(void) {
+    return (double)g_frameCount / (double)g_targetFps;
+}
+
+//------------------------------------------------------------------------------------
+// Drawing (EndDrawing advances the simulated clock)
+//------------------------------------------------------------------------------------
+
+void BeginDrawing(void) {}
+
+void EndDrawing(void) {
+    g_frameCount++;
+}
+
+void ClearBackground(Color color) { (void)color; }
+void DrawFPS(int posX, int posY) { (void)posX; (void)posY; }
+void DrawPixelV(Vector2 position, Color color) { (void)position; (void)color; }
+
+void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    (void)startPosX; (void)startPosY; (void)endPosX; (void)endPosY; (void)color;
+}
+
+void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    (void)startPos; (void)endPos; (void)thick; (void)color;
+}
+
+void DrawCircle(int centerX, int centerY, float radius, Color color) {
+    (void)centerX; (void)centerY; (void)radius; (void)color;
+}
+
+void DrawCircleV(Vector2 center, float radius, Color color) {
+    (void)center; (void)radius; (void)color;
+}
+
+void DrawCircleLines(int centerX, int centerY, float radius, Color color) {
+    (void)centerX; (void)centerY; (void)radius; (void)color;
+}
+
+void DrawRectangle(int posX, int posY, int width, int height, Color color) {
+    (void)posX; (void)posY; (void)width; (void)height; (void)color;
+}
+
+void DrawRectangleLines(int posX, int posY, int width, int height, Color color) {
+    (void)posX; (void)posY; (void)width; (void)height; (void)color;
+}
+
+void DrawText(const char* text, int posX, int posY, int fontSize, Color color) {
+    (void)text; (void)posX; (void)posY; (void)fontSize; (void)color;
+}
+
+// 텍스처는 GPU 없이 크기만 기억 (id 가 0 이 아니어야 호출자가 다시 만들지 않음)
+Texture2D LoadTextureFromImage(Image image) {
+    return (Texture2D){ .id = 1, .width = image.width, .height = image.height,
+                        .mipmaps = image.mipmaps, .format = image.format };
+}
+
+void UpdateTexture(Texture2D texture, const void* pixels) { (void)texture; (void)pixels; }
+void UnloadTexture(Texture2D texture) { (void)texture; }
+
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint) {
+    (void)texture; (void)posX; (void)posY; (void)tint;
+}
+
+//------------------------------------------------------------------------------------
+// Input (nothing is ever pressed)
+//------------------------------------------------------------------------------------
+
+bool IsKeyDown(int key) { (void)key; return false; }
+bool IsKeyPressed(int key) { (void)key; return false; }
+bool IsKeyReleased(int key) { (void)key; return false; }
+bool IsMouseButtonPressed(int button) { (void)button; return false; }
+int GetCharPressed(void) { return 0; }
+
+Vector2 GetMousePosition(void) {
+    return (Vector2){ 0.0f, 0.0f };
+}
+
+//------------------------------------------------------------------------------------
+// Helpers with real behavior (same algorithms as raylib 5)
+//------------------------------------------------------------------------------------
+
+// raylib rprand: splitmix64 로 시드 확장, xoshiro128** 로 생성
+static uint64_t g_randomSeed = 0;
+static uint32_t g_randomState[4] = { 0x96ea83c1, 0x218b21e5, 0xaa91febd, 0x976414d4 };
+
+static uint64_t SplitMix64(void) {
+    uint64_t z = (g_randomSeed += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static inline uint32_t RotateLeft(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+static uint32_t Xoshiro128(void) {
+    uint32_t result = RotateLeft(g_randomState[1] * 5, 7) * 9;
+    uint32_t t = g_randomState[1] << 9;
+
+    g_randomState[2] ^= g_randomState[0];
+    g_randomState[3] ^= g_randomState[1];
+    g_randomState[1] ^= g_randomState[2];
+    g_randomState[0] ^= g_randomState[3];
+    g_randomState[2] ^= t;
+    g_randomState[3] = RotateLeft(g_randomState[3], 11);
+
+    return result;
+}
+
+void SetRandomSeed(unsigned int seed) {
+    g_randomSeed = (uint64_t)seed;
+    uint64_t mixed = SplitMix64();
+    g_randomState[0] = (uint32_t)(mixed & 0xffffffff);
+    g_randomState[1] = (uint32_t)(mixed >> 32);
+    mixed = SplitMix64();
+    g_randomState[2] = (uint32_t)(mixed & 0xffffffff);
+    g_randomState[3] = (uint32_t)(mixed >> 32);
+}
+
+int GetRandomValue(int min, int max) {
+    if (min > max) {
+        int swap = max;
+        max = min;
+        min = swap;
+    }
+    return (int)(Xoshiro128() % (unsigned int)(abs(max - min) + 1)) + min;
+}
+
+bool CheckCollisionCircles(Vector2 center1, float radius1, Vector2 center2, float radius2) {
+    float dx = center2.x - center1.x;
+    float dy = center2.y - center1.y;
+    return sqrtf(dx*dx + dy*dy) <= (radius1 + radius2);
+}
+
+Color Fade(Color color, float alpha) {
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+    return (Color){ color.r, color.g, color.b, (unsigned char)(255.0f * alpha) };
+}
+
+// 기본 폰트 기준 근사치 (레이아웃 계산에만 쓰이고 그려지지 않음)
+int MeasureText(const char* text, int fontSize) {
+    if (text == NULL) return 0;
+    int spacing = fontSize / 10;
+    int length = (int)strlen(text);
+    return length * (fontSize / 2 + spacing);
+}
+
+// raylib 과 같이 회전하는 정적 버퍼 사용 (연속 호출 몇 번까지 결과 유지)
+const char* TextFormat(const char* text, ...) {
+    static char buffers[HEADLESS_TEXT_BUFFERS][HEADLESS_TEXT_LENGTH];
+    static int index = 0;
+
+    char* buffer = buffers[index];
+    index = (index + 1) % HEADLESS_TEXT_BUFFERS;
+
+    va_list args;
+    va_start(args, text);
+    vsnprintf(buffer, HEADLESS_TEXT_LENGTH, text, args);
+    va_end(args);
+    return buffer;
+}
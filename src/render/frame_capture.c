@@ -0,0 +1,357 @@
+#include "frame_capture.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 웹 빌드는 pthread 와 파일 시스템이 없으므로 캡처를 지원하지 않음
+#if !defined(PLATFORM_WEB)
+#include <pthread.h>
+#define FRAME_CAPTURE_HAS_THREADS 1
+#endif
+
+#if defined(_WIN32)
+#include <direct.h>
+#define MAKE_DIRECTORY(path) _mkdir(path)
+#else
+#include <sys/stat.h>
+#define MAKE_DIRECTORY(path) mkdir(path, 0755)
+#endif
+
+#define FRAME_CAPTURE_PATH_MAX 512
+
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF  0x40
+#define QOI_OP_LUMA  0x80
+#define QOI_OP_RUN   0xc0
+#define QOI_OP_RGB   0xfe
+#define QOI_OP_RGBA  0xff
+#define QOI_HEADER_SIZE 14
+#define QOI_END_SIZE 8
+#define QOI_MAX_RUN 62
+
+#define PPM_HEADER_MAX 32
+
+static FrameCaptureStats lastStats;
+
+FrameCaptureFormat FrameCapture_ParseFormat(const char* name) {
+    if (name && strcmp(name, "ppm") == 0) return FRAME_CAPTURE_FORMAT_PPM;
+    return FRAME_CAPTURE_FORMAT_QOI;
+}
+
+size_t FrameCapture_QoiMaxSize(int width, int height) {
+    return (size_t)width * height * 5 + QOI_HEADER_SIZE + QOI_END_SIZE;
+}
+
+static unsigned char* WriteBigEndian32(unsigned char* out, uint32_t value) {
+    out[0] = (unsigned char)(value >> 24);
+    out[1] = (unsigned char)(value >> 16);
+    out[2] = (unsigned char)(value >> 8);
+    out[3] = (unsigned char)value;
+    return out + 4;
+}
+
+static inline int QoiHash(Color c) {
+    return (c.r * 3 + c.g * 5 + c.b * 7 + c.a * 11) % 64;
+}
+
+size_t FrameCapture_EncodeQoi(const Color* pixels, int width, int height, unsigned char* out) {
+    unsigned char* p = out;
+    memcpy(p, "qoif", 4);
+    p = WriteBigEndian32(p + 4, (uint32_t)width);
+    p = WriteBigEndian32(p, (uint32_t)height);
+    *p++ = 4;   // RGBA
+    *p++ = 0;   // sRGB with linear alpha
+
+    Color index[64];
+    memset(index, 0, sizeof(index));
+    Color previous = { 0, 0, 0, 255 };
+    int run = 0;
+    int count = width * height;
+
+    for (int i = 0; i < count; i++) {
+        Color px = pixels[i];
+        if (px.r == previous.r && px.g == previous.g && px.b == previous.b && px.a == previous.a) {
+            run++;
+            if (run == QOI_MAX_RUN || i == count - 1) {
+                *p++ = (unsigned char)(QOI_OP_RUN | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            *p++ = (unsigned char)(QOI_OP_RUN | (run - 1));
+            run = 0;
+        }
+
+        int hash = QoiHash(px);
+        Color seen = index[hash];
+        if (seen.r == px.r && seen.g == px.g && seen.b == px.b && seen.a == px.a) {
+            *p++ = (unsigned char)(QOI_OP_INDEX | hash);
+        } else {
+            index[hash] = px;
+            if (px.a == previous.a) {
+                // 채널 차이는 8 비트 wraparound 로 계산
+                signed char dr = (signed char)(px.r - previous.r);
+                signed char dg = (signed char)(px.g - previous.g);
+                signed char db = (signed char)(px.b - previous.b);
+                signed char drg = (signed char)(dr - dg);
+                signed char dbg = (signed char)(db - dg);
+
+                if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                    *p++ = (unsigned char)(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+                } else if (dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 && dbg >= -8 && dbg <= 7) {
+                    *p++ = (unsigned char)(QOI_OP_LUMA | (dg + 32));
+                    *p++ = (unsigned char)((drg + 8) << 4 | (dbg + 8));
+                } else {
+                    *p++ = QOI_OP_RGB;
+                    *p++ = px.r;
+                    *p++ = px.g;
+                    *p++ = px.b;
+                }
+            } else {
+                *p++ = QOI_OP_RGBA;
+                *p++ = px.r;
+                *p++ = px.g;
+                *p++ = px.b;
+                *p++ = px.a;
+            }
+        }
+        previous = px;
+    }
+
+    static const unsigned char END_MARKER[QOI_END_SIZE] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+    memcpy(p, END_MARKER, QOI_END_SIZE);
+    return (size_t)(p + QOI_END_SIZE - out);
+}
+
+#if defined(FRAME_CAPTURE_HAS_THREADS)
+
+static struct {
+    bool active;
+    FrameCaptureFormat format;
+    int width;
+    int height;
+    char directory[FRAME_CAPTURE_PATH_MAX];
+    Color* slots[FRAME_CAPTURE_RING_SIZE];
+    uint32_t slotFrame[FRAME_CAPTURE_RING_SIZE];    // 각 슬롯에 담긴 프레임 번호
+    int head;                   // 다음에 채울 슬롯 (메인 스레드)
+    int tail;                   // 다음에 인코딩할 슬롯 (인코더 스레드)
+    int queued;                 // 인코딩을 기다리는 슬롯 수
+    bool stopping;
+    unsigned char* encodeBuffer;
+    FrameCaptureStats stats;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t frameReady;
+} capture;
+
+// P6 헤더 + RGB 바이트 (알파 제외)
+static size_t EncodePpm(const Color* pixels, int width, int height, unsigned char* out) {
+    int header = snprintf((char*)out, PPM_HEADER_MAX, "P6\n%d %d\n255\n", width, height);
+    unsigned char* p = out + header;
+    int count = width * height;
+    for (int i = 0; i < count; i++) {
+        *p++ = pixels[i].r;
+        *p++ = pixels[i].g;
+        *p++ = pixels[i].b;
+    }
+    return (size_t)(p - out);
+}
+
+static bool WriteFrame(const Color* pixels, uint32_t frame) {
+    char path[FRAME_CAPTURE_PATH_MAX + 32];
+    const char* extension = (capture.format == FRAME_CAPTURE_FORMAT_PPM) ? "ppm" : "qoi";
+    snprintf(path, sizeof(path), "%s/frame_%06u.%s", capture.directory, (unsigned int)frame, extension);
+
+    size_t size = (capture.format == FRAME_CAPTURE_FORMAT_PPM)
+        ? EncodePpm(pixels, capture.width, capture.height, capture.encodeBuffer)
+        : FrameCapture_EncodeQoi(pixels, capture.width, capture.height, capture.encodeBuffer);
+
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    bool ok = fwrite(capture.encodeBuffer, 1, size, file) == size;
+    if (fclose(file) != 0) ok = false;
+    return ok;
+}
+
+// 큐가 빌 때까지 슬롯을 하나씩 꺼내 인코딩 (정지 요청 후에도 남은 프레임은 모두 씀)
+static void* EncoderMain(void* arg) {
+    (void)arg;
+    pthread_mutex_lock(&capture.mutex);
+    for (;;) {
+        while (capture.queued == 0 && !capture.stopping) {
+            pthread_cond_wait(&capture.frameReady, &capture.mutex);
+        }
+        if (capture.queued == 0) break;
+
+        int slot = capture.tail;
+        uint32_t frame = capture.slotFrame[slot];
+        pthread_mutex_unlock(&capture.mutex);
+
+        bool ok = WriteFrame(capture.slots[slot], frame);
+
+        pthread_mutex_lock(&capture.mutex);
+        capture.tail = (slot + 1) % FRAME_CAPTURE_RING_SIZE;
+        capture.queued--;
+        if (ok) capture.stats.written++;
+        else capture.stats.failed++;
+    }
+    pthread_mutex_unlock(&capture.mutex);
+    return NULL;
+}
+
+static void FreeBuffers(void) {
+    for (int i = 0; i < FRAME_CAPTURE_RING_SIZE; i++) {
+        free(capture.slots[i]);
+        capture.slots[i] = NULL;
+    }
+    free(capture.encodeBuffer);
+    capture.encodeBuffer = NULL;
+}
+
+bool FrameCapture_Start(const char* directory, FrameCaptureFormat format, int width, int height) {
+    FrameCapture_Stop();
+    if (!directory || width <= 0 || height <= 0) return false;
+
+    size_t length = strlen(directory);
+    while (length > 1 && (directory[length - 1] == '/' || directory[length - 1] == '\\')) length--;
+    if (length == 0 || length >= FRAME_CAPTURE_PATH_MAX) {
+        printf("Capture: invalid directory '%s'\n", directory);
+        return false;
+    }
+    memcpy(capture.directory, directory, length);
+    capture.directory[length] = '\0';
+
+    if (MAKE_DIRECTORY(capture.directory) != 0 && errno != EEXIST) {
+        printf("Capture: cannot create directory %s\n", capture.directory);
+        return false;
+    }
+
+    size_t frameBytes = (size_t)width * height * sizeof(Color);
+    size_t ppmBytes = (size_t)width * height * 3 + PPM_HEADER_MAX;
+    size_t qoiBytes = FrameCapture_QoiMaxSize(width, height);
+    capture.encodeBuffer = (unsigned char*)malloc(qoiBytes > ppmBytes ? qoiBytes : ppmBytes);
+    bool allocated = capture.encodeBuffer != NULL;
+    for (int i = 0; i < FRAME_CAPTURE_RING_SIZE; i++) {
+        capture.slots[i] = (Color*)malloc(frameBytes);
+        if (!capture.slots[i]) allocated = false;
+    }
+    if (!allocated) {
+        printf("Capture: out of memory for %d frame buffers\n", FRAME_CAPTURE_RING_SIZE);
+        FreeBuffers();
+        return false;
+    }
+
+    capture.format = format;
+    capture.width = width;
+    capture.height = height;
+    capture.head = 0;
+    capture.tail = 0;
+    capture.queued = 0;
+    capture.stopping = false;
+    memset(&capture.stats, 0, sizeof(FrameCaptureStats));
+    lastStats = capture.stats;
+
+    pthread_mutex_init(&capture.mutex, NULL);
+    pthread_cond_init(&capture.frameReady, NULL);
+    if (pthread_create(&capture.thread, NULL, EncoderMain, NULL) != 0) {
+        printf("Capture: failed to start encoder thread\n");
+        pthread_cond_destroy(&capture.frameReady);
+        pthread_mutex_destroy(&capture.mutex);
+        FreeBuffers();
+        return false;
+    }
+
+    capture.active = true;
+    printf("Capture: writing %dx%d %s frames to %s\n", width, height,
+           (format == FRAME_CAPTURE_FORMAT_PPM) ? "PPM" : "QOI", capture.directory);
+    return true;
+}
+
+void FrameCapture_Stop(void) {
+    if (!capture.active) return;
+
+    pthread_mutex_lock(&capture.mutex);
+    capture.stopping = true;
+    pthread_cond_signal(&capture.frameReady);
+    pthread_mutex_unlock(&capture.mutex);
+    pthread_join(capture.thread, NULL);
+
+    pthread_cond_destroy(&capture.frameReady);
+    pthread_mutex_destroy(&capture.mutex);
+    FreeBuffers();
+    capture.active = false;
+
+    lastStats = capture.stats;
+    printf("Capture: wrote %u of %u frames to %s (%u dropped, %u failed)\n",
+           (unsigned int)lastStats.written, (unsigned int)lastStats.submitted, capture.directory,
+           (unsigned int)lastStats.dropped, (unsigned int)lastStats.failed);
+}
+
+bool FrameCapture_IsActive(void) {
+    return capture.active;
+}
+
+bool FrameCapture_Submit(const Color* pixels) {
+    if (!capture.active || !pixels) return false;
+
+    pthread_mutex_lock(&capture.mutex);
+    uint32_t frame = capture.stats.submitted++;
+    if (capture.queued == FRAME_CAPTURE_RING_SIZE) {
+        // 인코더가 밀리면 메인 루프를 멈추지 않고 이 프레임을 버림
+        bool firstDrop = (capture.stats.dropped++ == 0);
+        pthread_mutex_unlock(&capture.mutex);
+        if (firstDrop) {
+            printf("Capture: encoder fell behind at frame %u, dropping frames\n", (unsigned int)frame);
+        }
+        return false;
+    }
+    int slot = capture.head;
+    pthread_mutex_unlock(&capture.mutex);
+
+    // head 슬롯은 queued 를 늘리기 전까지 인코더가 읽지 않으므로 잠금 없이 복사
+    memcpy(capture.slots[slot], pixels, (size_t)capture.width * capture.height * sizeof(Color));
+
+    pthread_mutex_lock(&capture.mutex);
+    capture.slotFrame[slot] = frame;
+    capture.head = (slot + 1) % FRAME_CAPTURE_RING_SIZE;
+    capture.queued++;
+    pthread_cond_signal(&capture.frameReady);
+    pthread_mutex_unlock(&capture.mutex);
+    return true;
+}
+
+FrameCaptureStats FrameCapture_GetStats(void) {
+    if (!capture.active) return lastStats;
+
+    pthread_mutex_lock(&capture.mutex);
+    FrameCaptureStats stats = capture.stats;
+    pthread_mutex_unlock(&capture.mutex);
+    return stats;
+}
+
+#else
+
+bool FrameCapture_Start(const char* directory, FrameCaptureFormat format, int width, int height) {
+    (void)directory; (void)format; (void)width; (void)height;
+    printf("Capture: not available in this build\n");
+    return false;
+}
+
+void FrameCapture_Stop(void) {}
+
+bool FrameCapture_IsActive(void) {
+    return false;
+}
+
+bool FrameCapture_Submit(const Color* pixels) {
+    (void)pixels;
+    return false;
+}
+
+FrameCaptureStats FrameCapture_GetStats(void) {
+    return lastStats;
+}
+
+#endif
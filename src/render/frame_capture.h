@@ -0,0 +1,57 @@
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Frame capture (--capture DIR)
+ *
+ * Each submitted frame is copied into a ring of preallocated buffers and a
+ * background encoder thread writes it to DIR/frame_NNNNNN.qoi (or .ppm). The
+ * main thread only pays for the copy: when the encoder falls behind and every
+ * slot is still queued, the frame is dropped instead of waiting. The file
+ * number is the submit index, so dropped frames leave gaps in the sequence.
+ */
+
+#define FRAME_CAPTURE_RING_SIZE 8
+
+typedef enum FrameCaptureFormat {
+    FRAME_CAPTURE_FORMAT_QOI = 0,   // Lossless, RGBA (https://qoiformat.org)
+    FRAME_CAPTURE_FORMAT_PPM        // Raw binary P6, alpha dropped
+} FrameCaptureFormat;
+
+typedef struct FrameCaptureStats {
+    uint32_t submitted;     // Frames offered to FrameCapture_Submit
+    uint32_t written;       // Frames the encoder wrote to disk
+    uint32_t dropped;       // Frames skipped because the ring was full
+    uint32_t failed;        // Frames the encoder could not write
+} FrameCaptureStats;
+
+// 캡처 시작: 디렉터리 생성, 링 버퍼 할당, 인코더 스레드 시작 (웹 빌드는 지원 안 함)
+bool FrameCapture_Start(const char* directory, FrameCaptureFormat format, int width, int height);
+// 남은 프레임을 모두 쓰고 스레드 종료, 통계 출력
+void FrameCapture_Stop(void);
+bool FrameCapture_IsActive(void);
+
+/**
+ * @brief Queue one width * height RGBA frame (the size given to Start)
+ *
+ * Never waits for the encoder. Returns false if the frame was dropped.
+ */
+bool FrameCapture_Submit(const Color* pixels);
+
+// Counters since the last Start (final values stay readable after Stop)
+FrameCaptureStats FrameCapture_GetStats(void);
+
+// "qoi" / "ppm" -> format (unknown names map to FRAME_CAPTURE_FORMAT_QOI)
+FrameCaptureFormat FrameCapture_ParseFormat(const char* name);
+
+// Worst-case QOI file size for an image (header, 5 bytes per pixel, end marker)
+size_t FrameCapture_QoiMaxSize(int width, int height);
+// Encode an RGBA image as a QOI file into out (at least QoiMaxSize bytes), returns the size
+size_t FrameCapture_EncodeQoi(const Color* pixels, int width, int height, unsigned char* out);
+
+#endif // FRAME_CAPTURE_H
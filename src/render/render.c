@@ -0,0 +1,53 @@
+#include "render.h"
+#include <stdio.h>
+#include <string.h>
+
+const RenderBackend* g_renderBackend = &g_raylibRenderBackend;
+
+static const RenderBackend* BACKENDS[RENDER_BACKEND_COUNT] = {
+    &g_raylibRenderBackend,
+    &g_softwareRenderBackend
+};
+
+static RenderBackendType g_backendType = RENDER_BACKEND_RAYLIB;
+
+bool Render_Init(RenderBackendType type, int width, int height) {
+    Render_Shutdown();
+    if (type < 0 || type >= RENDER_BACKEND_COUNT) type = RENDER_BACKEND_RAYLIB;
+
+    const RenderBackend* backend = BACKENDS[type];
+    if (backend->init && !backend->init(width, height)) {
+        printf("Render backend '%s' failed to initialize, using raylib\n", backend->name);
+        return false;
+    }
+    g_renderBackend = backend;
+    g_backendType = type;
+    return true;
+}
+
+void Render_Shutdown(void) {
+    if (g_renderBackend->shutdown) g_renderBackend->shutdown();
+    g_renderBackend = &g_raylibRenderBackend;
+    g_backendType = RENDER_BACKEND_RAYLIB;
+}
+
+RenderBackendType Render_GetBackendType(void) {
+    return g_backendType;
+}
+
+RenderBackendType Render_ParseBackendType(const char* name) {
+    for (int type = 0; type < RENDER_BACKEND_COUNT; type++) {
+        if (name && strcmp(name, BACKENDS[type]->name) == 0) return (RenderBackendType)type;
+    }
+    return RENDER_BACKEND_RAYLIB;
+}
+
+void Render_BeginFrame(void) {
+    BeginDrawing();
+    if (g_renderBackend->beginFrame) g_renderBackend->beginFrame();
+}
+
+void Render_EndFrame(void) {
+    if (g_renderBackend->endFrame) g_renderBackend->endFrame();
+    EndDrawing();
+}
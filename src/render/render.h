@@ -0,0 +1,120 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+typedef enum RenderBackendType {
+    RENDER_BACKEND_RAYLIB = 0,      // raylib immediate-mode drawing (GPU; no-ops in the headless build)
+    RENDER_BACKEND_SOFTWARE,        // CPU rasterizer drawing into an in-memory framebuffer
+    RENDER_BACKEND_COUNT
+} RenderBackendType;
+
+/**
+ * @brief Drawing backend
+ *
+ * Entries mirror the raylib calls the game makes, so the raylib backend
+ * points straight at raylib and game code only swaps DrawX for Render_DrawX.
+ * beginFrame/endFrame run inside BeginDrawing/EndDrawing. init and shutdown
+ * may be NULL.
+ */
+typedef struct RenderBackend {
+    const char* name;
+    bool (*init)(int width, int height);
+    void (*shutdown)(void);
+    void (*beginFrame)(void);
+    void (*endFrame)(void);
+
+    void (*clearBackground)(Color color);
+    void (*drawPixelV)(Vector2 position, Color color);
+    void (*drawLine)(int startPosX, int startPosY, int endPosX, int endPosY, Color color);
+    void (*drawLineEx)(Vector2 startPos, Vector2 endPos, float thick, Color color);
+    void (*drawCircle)(int centerX, int centerY, float radius, Color color);
+    void (*drawCircleV)(Vector2 center, float radius, Color color);
+    void (*drawCircleLines)(int centerX, int centerY, float radius, Color color);
+    void (*drawRectangle)(int posX, int posY, int width, int height, Color color);
+    void (*drawRectangleLines)(int posX, int posY, int width, int height, Color color);
+    void (*drawText)(const char* text, int posX, int posY, int fontSize, Color color);
+    int (*measureText)(const char* text, int fontSize);
+    void (*drawFPS)(int posX, int posY);
+    // Blend a CPU RGBA image (e.g. the particle framebuffer) with its top-left corner at (posX, posY)
+    void (*drawPixels)(const Color* pixels, int width, int height, int posX, int posY);
+} RenderBackend;
+
+extern const RenderBackend g_raylibRenderBackend;     // render_raylib.c
+extern const RenderBackend g_softwareRenderBackend;   // render_software.c
+extern const RenderBackend* g_renderBackend;          // Current backend (raylib until Render_Init)
+
+// 렌더링 백엔드 선택 (초기화 실패 시 raylib 으로 대체하고 false)
+bool Render_Init(RenderBackendType type, int width, int height);
+// 백엔드 정리 후 raylib 으로 되돌림
+void Render_Shutdown(void);
+RenderBackendType Render_GetBackendType(void);
+// "raylib" / "software" -> type (unknown names map to RENDER_BACKEND_RAYLIB)
+RenderBackendType Render_ParseBackendType(const char* name);
+
+// BeginDrawing/EndDrawing plus the backend's frame hooks
+void Render_BeginFrame(void);
+void Render_EndFrame(void);
+
+/**
+ * @brief Last frame drawn by the software backend
+ *
+ * Valid until the next Render_BeginFrame. NULL with the raylib backend
+ * (its frame lives on the GPU).
+ */
+const Color* Render_GetFramebuffer(int* width, int* height);
+
+static inline void Render_ClearBackground(Color color) {
+    g_renderBackend->clearBackground(color);
+}
+
+static inline void Render_DrawPixelV(Vector2 position, Color color) {
+    g_renderBackend->drawPixelV(position, color);
+}
+
+static inline void Render_DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    g_renderBackend->drawLine(startPosX, startPosY, endPosX, endPosY, color);
+}
+
+static inline void Render_DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    g_renderBackend->drawLineEx(startPos, endPos, thick, color);
+}
+
+static inline void Render_DrawCircle(int centerX, int centerY, float radius, Color color) {
+    g_renderBackend->drawCircle(centerX, centerY, radius, color);
+}
+
+static inline void Render_DrawCircleV(Vector2 center, float radius, Color color) {
+    g_renderBackend->drawCircleV(center, radius, color);
+}
+
+static inline void Render_DrawCircleLines(int centerX, int centerY, float radius, Color color) {
+    g_renderBackend->drawCircleLines(centerX, centerY, radius, color);
+}
+
+static inline void Render_DrawRectangle(int posX, int posY, int width, int height, Color color) {
+    g_renderBackend->drawRectangle(posX, posY, width, height, color);
+}
+
+static inline void Render_DrawRectangleLines(int posX, int posY, int width, int height, Color color) {
+    g_renderBackend->drawRectangleLines(posX, posY, width, height, color);
+}
+
+static inline void Render_DrawText(const char* text, int posX, int posY, int fontSize, Color color) {
+    g_renderBackend->drawText(text, posX, posY, fontSize, color);
+}
+
+static inline int Render_MeasureText(const char* text, int fontSize) {
+    return g_renderBackend->measureText(text, fontSize);
+}
+
+static inline void Render_DrawFPS(int posX, int posY) {
+    g_renderBackend->drawFPS(posX, posY);
+}
+
+static inline void Render_DrawPixels(const Color* pixels, int width, int height, int posX, int posY) {
+    g_renderBackend->drawPixels(pixels, width, height, posX, posY);
+}
+
+#endif // RENDER_H
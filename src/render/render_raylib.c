@@ -0,0 +1,53 @@
+#include "render.h"
+#include <stddef.h>
+
+// CPU 이미지 업로드용 스트리밍 텍스처 (크기가 바뀌면 다시 생성)
+static Texture2D g_streamTexture = { 0 };
+
+static void UploadAndDraw(const Color* pixels, int width, int height, int posX, int posY) {
+    if (g_streamTexture.id != 0 && (g_streamTexture.width != width || g_streamTexture.height != height)) {
+        UnloadTexture(g_streamTexture);
+        g_streamTexture.id = 0;
+    }
+    if (g_streamTexture.id == 0) {
+        Image image = {
+            .data = (void*)pixels,
+            .width = width,
+            .height = height,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+        };
+        g_streamTexture = LoadTextureFromImage(image);
+    } else {
+        UpdateTexture(g_streamTexture, pixels);
+    }
+    DrawTexture(g_streamTexture, posX, posY, WHITE);
+}
+
+static void ShutdownRaylib(void) {
+    if (g_streamTexture.id != 0) {
+        UnloadTexture(g_streamTexture);
+        g_streamTexture.id = 0;
+    }
+}
+
+const RenderBackend g_raylibRenderBackend = {
+    .name = "raylib",
+    .init = NULL,
+    .shutdown = ShutdownRaylib,
+    .beginFrame = NULL,
+    .endFrame = NULL,
+    .clearBackground = ClearBackground,
+    .drawPixelV = DrawPixelV,
+    .drawLine = DrawLine,
+    .drawLineEx = DrawLineEx,
+    .drawCircle = DrawCircle,
+    .drawCircleV = DrawCircleV,
+    .drawCircleLines = DrawCircleLines,
+    .drawRectangle = DrawRectangle,
+    .drawRectangleLines = DrawRectangleLines,
+    .drawText = DrawText,
+    .measureText = MeasureText,
+    .drawFPS = DrawFPS,
+    .drawPixels = UploadAndDraw
+};
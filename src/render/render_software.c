@@ -0,0 +1,118 @@
+#include "render.h"
+#include "software_canvas.h"
+#include <stddef.h>
+
+static SoftwareCanvas g_canvas = { 0 };
+static Texture2D g_presentTexture = { 0 };
+
+static bool InitSoftware(int width, int height) {
+    return SoftwareCanvas_Init(&g_canvas, width, height);
+}
+
+static void ShutdownSoftware(void) {
+    if (g_presentTexture.id != 0) {
+        UnloadTexture(g_presentTexture);
+        g_presentTexture.id = 0;
+    }
+    SoftwareCanvas_Destroy(&g_canvas);
+}
+
+// 창이 있으면 완성된 프레임을 텍스처 하나로 화면에 표시 (헤드리스에서는 메모리에만 남음)
+static void PresentSoftware(void) {
+    if (g_presentTexture.id == 0) {
+        Image image = {
+            .data = g_canvas.pixels,
+            .width = g_canvas.width,
+            .height = g_canvas.height,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+        };
+        g_presentTexture = LoadTextureFromImage(image);
+    } else {
+        UpdateTexture(g_presentTexture, g_canvas.pixels);
+    }
+    DrawTexture(g_presentTexture, 0, 0, WHITE);
+}
+
+static void ClearSoftware(Color color) {
+    SoftwareCanvas_Clear(&g_canvas, color);
+}
+
+static void DrawPixelSoftware(Vector2 position, Color color) {
+    if (!(position.x >= 0.0f && position.y >= 0.0f)) return;
+    SoftwareCanvas_DrawPixel(&g_canvas, (int)position.x, (int)position.y, color);
+}
+
+static void DrawLineSoftware(int startPosX, int startPosY, int endPosX, int endPosY, Color color) {
+    SoftwareCanvas_DrawLine(&g_canvas, (float)startPosX, (float)startPosY, (float)endPosX, (float)endPosY, 1.0f, color);
+}
+
+static void DrawLineExSoftware(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    SoftwareCanvas_DrawLine(&g_canvas, startPos.x, startPos.y, endPos.x, endPos.y, thick, color);
+}
+
+static void DrawCircleSoftware(int centerX, int centerY, float radius, Color color) {
+    SoftwareCanvas_FillCircle(&g_canvas, (float)centerX, (float)centerY, radius, color);
+}
+
+static void DrawCircleVSoftware(Vector2 center, float radius, Color color) {
+    SoftwareCanvas_FillCircle(&g_canvas, center.x, center.y, radius, color);
+}
+
+static void DrawCircleLinesSoftware(int centerX, int centerY, float radius, Color color) {
+    SoftwareCanvas_StrokeCircle(&g_canvas, (float)centerX, (float)centerY, radius, color);
+}
+
+static void DrawRectangleSoftware(int posX, int posY, int width, int height, Color color) {
+    SoftwareCanvas_FillRect(&g_canvas, posX, posY, width, height, color);
+}
+
+static void DrawRectangleLinesSoftware(int posX, int posY, int width, int height, Color color) {
+    SoftwareCanvas_StrokeRect(&g_canvas, posX, posY, width, height, color);
+}
+
+static void DrawTextSoftware(const char* text, int posX, int posY, int fontSize, Color color) {
+    SoftwareCanvas_DrawText(&g_canvas, text, posX, posY, fontSize, color);
+}
+
+// raylib DrawFPS 와 같은 크기/색 (프레임 시간으로 계산)
+static void DrawFPSSoftware(int posX, int posY) {
+    float frameTime = GetFrameTime();
+    int fps = (frameTime > 0.0f) ? (int)(1.0f / frameTime + 0.5f) : 0;
+    Color color = LIME;
+    if (fps < 30) color = ORANGE;
+    if (fps < 15) color = RED;
+    SoftwareCanvas_DrawText(&g_canvas, TextFormat("%2i FPS", fps), posX, posY, 20, color);
+}
+
+static void DrawPixelsSoftware(const Color* pixels, int width, int height, int posX, int posY) {
+    SoftwareCanvas_DrawImage(&g_canvas, pixels, width, height, posX, posY);
+}
+
+const RenderBackend g_softwareRenderBackend = {
+    .name = "software",
+    .init = InitSoftware,
+    .shutdown = ShutdownSoftware,
+    .beginFrame = NULL,
+    .endFrame = PresentSoftware,
+    .clearBackground = ClearSoftware,
+    .drawPixelV = DrawPixelSoftware,
+    .drawLine = DrawLineSoftware,
+    .drawLineEx = DrawLineExSoftware,
+    .drawCircle = DrawCircleSoftware,
+    .drawCircleV = DrawCircleVSoftware,
+    .drawCircleLines = DrawCircleLinesSoftware,
+    .drawRectangle = DrawRectangleSoftware,
+    .drawRectangleLines = DrawRectangleLinesSoftware,
+    .drawText = DrawTextSoftware,
+    .measureText = SoftwareCanvas_MeasureText,
+    .drawFPS = DrawFPSSoftware,
+    .drawPixels = DrawPixelsSoftware
+};
+
+const Color* Render_GetFramebuffer(int* width, int* height) {
+    if (g_renderBackend != &g_softwareRenderBackend || !g_canvas.pixels) return NULL;
+    if (width) *width = g_canvas.width;
+    if (height) *height = g_canvas.height;
+    return g_canvas.pixels;
+}
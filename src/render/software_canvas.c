@@ -0,0 +1,297 @@
+#include "software_canvas.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOFTWARE_FONT_FIRST_CHAR 32
+#define SOFTWARE_FONT_LAST_CHAR 126
+
+// ASCII 32..126, one byte per column, bit 0 = top row
+static const unsigned char FONT_5X7[SOFTWARE_FONT_LAST_CHAR - SOFTWARE_FONT_FIRST_CHAR + 1][SOFTWARE_FONT_GLYPH_WIDTH] = {
+    {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+    {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x55,0x22,0x50}, {0x00,0x05,0x03,0x00,0x00},
+    {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x14,0x08,0x3E,0x08,0x14}, {0x08,0x08,0x3E,0x08,0x08},
+    {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},
+    {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4B,0x31},
+    {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},
+    {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1E}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},
+    {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},
+    {0x32,0x49,0x79,0x41,0x3E}, {0x7E,0x11,0x11,0x11,0x7E}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+    {0x7F,0x41,0x41,0x22,0x1C}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x49,0x49,0x7A},
+    {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+    {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x0C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+    {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},
+    {0x01,0x01,0x7F,0x01,0x01}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+    {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7F,0x41,0x41,0x00},
+    {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7F,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+    {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7F,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},
+    {0x38,0x44,0x44,0x48,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7E,0x09,0x01,0x02}, {0x0C,0x52,0x52,0x52,0x3E},
+    {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x44,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+    {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x18,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+    {0x7C,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7C}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},
+    {0x04,0x3F,0x44,0x40,0x20}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+    {0x44,0x28,0x10,0x28,0x44}, {0x0C,0x50,0x50,0x50,0x3C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+    {0x00,0x00,0x7F,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x10,0x08,0x08,0x10,0x08}
+};
+
+bool SoftwareCanvas_Init(SoftwareCanvas* canvas, int width, int height) {
+    memset(canvas, 0, sizeof(SoftwareCanvas));
+    if (width <= 0 || height <= 0) return false;
+
+    canvas->pixels = (Color*)malloc((size_t)width * height * sizeof(Color));
+    if (!canvas->pixels) return false;
+    canvas->width = width;
+    canvas->height = height;
+    SoftwareCanvas_Clear(canvas, BLACK);
+    return true;
+}
+
+void SoftwareCanvas_Destroy(SoftwareCanvas* canvas) {
+    free(canvas->pixels);
+    memset(canvas, 0, sizeof(SoftwareCanvas));
+}
+
+// BLEND_ALPHA: color = src * a + dst * (1 - a), 알파는 over 합성
+static inline Color BlendOver(Color dst, Color src) {
+    if (src.a == 255) return src;
+    unsigned int a = src.a;
+    unsigned int ia = 255 - a;
+    return (Color){
+        (unsigned char)((src.r * a + dst.r * ia + 127) / 255),
+        (unsigned char)((src.g * a + dst.g * ia + 127) / 255),
+        (unsigned char)((src.b * a + dst.b * ia + 127) / 255),
+        (unsigned char)(a + (dst.a * ia + 127) / 255)
+    };
+}
+
+static inline void BlendAt(SoftwareCanvas* canvas, int x, int y, Color color) {
+    Color* pixel = &canvas->pixels[y * canvas->width + x];
+    *pixel = BlendOver(*pixel, color);
+}
+
+// 한 행의 [x0, x1) 구간 (잘라낸 뒤) 블렌딩
+static void FillSpan(SoftwareCanvas* canvas, int y, int x0, int x1, Color color) {
+    if (y < 0 || y >= canvas->height) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > canvas->width) x1 = canvas->width;
+    if (x0 >= x1) return;
+
+    Color* row = canvas->pixels + (size_t)y * canvas->width;
+    if (color.a == 255) {
+        for (int x = x0; x < x1; x++) row[x] = color;
+    } else {
+        for (int x = x0; x < x1; x++) row[x] = BlendOver(row[x], color);
+    }
+}
+
+void SoftwareCanvas_Clear(SoftwareCanvas* canvas, Color color) {
+    int count = canvas->width * canvas->height;
+    for (int i = 0; i < count; i++) canvas->pixels[i] = color;
+}
+
+void SoftwareCanvas_DrawPixel(SoftwareCanvas* canvas, int x, int y, Color color) {
+    if (x < 0 || y < 0 || x >= canvas->width || y >= canvas->height || color.a == 0) return;
+    BlendAt(canvas, x, y, color);
+}
+
+void SoftwareCanvas_FillRect(SoftwareCanvas* canvas, int x, int y, int width, int height, Color color) {
+    if (width <= 0 || height <= 0 || color.a == 0) return;
+    int y0 = (y < 0) ? 0 : y;
+    int y1 = (y + height > canvas->height) ? canvas->height : y + height;
+    for (int row = y0; row < y1; row++) {
+        FillSpan(canvas, row, x, x + width, color);
+    }
+}
+
+void SoftwareCanvas_StrokeRect(SoftwareCanvas* canvas, int x, int y, int width, int height, Color color) {
+    if (width <= 0 || height <= 0) return;
+    // 위/아래 행 전체, 좌/우 열은 모서리 제외 (모서리가 두 번 블렌딩되지 않도록)
+    SoftwareCanvas_FillRect(canvas, x, y, width, 1, color);
+    if (height > 1) SoftwareCanvas_FillRect(canvas, x, y + height - 1, width, 1, color);
+    if (height > 2) {
+        SoftwareCanvas_FillRect(canvas, x, y + 1, 1, height - 2, color);
+        if (width > 1) SoftwareCanvas_FillRect(canvas, x + width - 1, y + 1, 1, height - 2, color);
+    }
+}
+
+// 중심이 cy 에서 dy 만큼 떨어진 행에서 반지름 radius 안에 중심이 드는 픽셀 [*x0, *x1]
+static bool CircleSpan(float centerX, float dy, float radius, int* x0, int* x1) {
+    float h2 = radius * radius - dy * dy;
+    if (h2 < 0.0f) return false;
+    float half = sqrtf(h2);
+    *x0 = (int)ceilf(centerX - half - 0.5f);
+    *x1 = (int)floorf(centerX + half - 0.5f);
+    return *x0 <= *x1;
+}
+
+void SoftwareCanvas_FillCircle(SoftwareCanvas* canvas, float centerX, float centerY, float radius, Color color) {
+    if (radius <= 0.0f || color.a == 0) return;
+    int y0 = (int)ceilf(centerY - radius - 0.5f);
+    int y1 = (int)floorf(centerY + radius - 0.5f);
+    if (y0 < 0) y0 = 0;
+    if (y1 >= canvas->height) y1 = canvas->height - 1;
+
+    for (int y = y0; y <= y1; y++) {
+        int x0, x1;
+        if (CircleSpan(centerX, (float)y + 0.5f - centerY, radius, &x0, &x1)) {
+            FillSpan(canvas, y, x0, x1 + 1, color);
+        }
+    }
+}
+
+void SoftwareCanvas_StrokeCircle(SoftwareCanvas* canvas, float centerX, float centerY, float radius, Color color) {
+    if (radius <= 0.0f || color.a == 0) return;
+    float outer = radius + 0.5f;
+    float inner = radius - 0.5f;
+    int y0 = (int)ceilf(centerY - outer - 0.5f);
+    int y1 = (int)floorf(centerY + outer - 0.5f);
+    if (y0 < 0) y0 = 0;
+    if (y1 >= canvas->height) y1 = canvas->height - 1;
+
+    for (int y = y0; y <= y1; y++) {
+        float dy = (float)y + 0.5f - centerY;
+        int ox0, ox1;
+        if (!CircleSpan(centerX, dy, outer, &ox0, &ox1)) continue;
+
+        // 안쪽 원 (경계 제외) 에 중심이 드는 픽셀은 비움
+        float h2 = inner * inner - dy * dy;
+        if (inner > 0.0f && h2 > 0.0f) {
+            float half = sqrtf(h2);
+            int ix0 = (int)floorf(centerX - half - 0.5f) + 1;
+            int ix1 = (int)ceilf(centerX + half - 0.5f) - 1;
+            if (ix0 <= ix1) {
+                FillSpan(canvas, y, ox0, ix0, color);
+                FillSpan(canvas, y, ix1 + 1, ox1 + 1, color);
+                continue;
+            }
+        }
+        FillSpan(canvas, y, ox0, ox1 + 1, color);
+    }
+}
+
+void SoftwareCanvas_DrawLine(SoftwareCanvas* canvas, float startX, float startY, float endX, float endY,
+                             float thick, Color color) {
+    if (color.a == 0) return;
+    float dx = endX - startX;
+    float dy = endY - startY;
+
+    if (thick <= 1.0f) {
+        // DDA: 긴 축 기준 한 픽셀씩, 같은 픽셀은 한 번만
+        int steps = (int)ceilf(fmaxf(fabsf(dx), fabsf(dy)));
+        int lastX = 0, lastY = 0;
+        for (int i = 0; i <= steps; i++) {
+            float t = (steps > 0) ? (float)i / (float)steps : 0.0f;
+            int x = (int)floorf(startX + dx * t);
+            int y = (int)floorf(startY + dy * t);
+            if (i > 0 && x == lastX && y == lastY) continue;
+            SoftwareCanvas_DrawPixel(canvas, x, y, color);
+            lastX = x;
+            lastY = y;
+        }
+        return;
+    }
+
+    // 굵은 선: 선분까지 거리가 thick/2 이하인 픽셀 (경계 상자 안에서만 검사)
+    float half = thick * 0.5f;
+    int x0 = (int)floorf(fminf(startX, endX) - half);
+    int x1 = (int)ceilf(fmaxf(startX, endX) + half);
+    int y0 = (int)floorf(fminf(startY, endY) - half);
+    int y1 = (int)ceilf(fmaxf(startY, endY) + half);
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 >= canvas->width) x1 = canvas->width - 1;
+    if (y1 >= canvas->height) y1 = canvas->height - 1;
+
+    float lengthSq = dx * dx + dy * dy;
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            float px = (float)x + 0.5f - startX;
+            float py = (float)y + 0.5f - startY;
+            float t = (lengthSq > 0.0f) ? (px * dx + py * dy) / lengthSq : 0.0f;
+            if (t < 0.0f) t = 0.0f;
+            else if (t > 1.0f) t = 1.0f;
+            float ex = px - dx * t;
+            float ey = py - dy * t;
+            if (ex * ex + ey * ey <= half * half) BlendAt(canvas, x, y, color);
+        }
+    }
+}
+
+// raylib DrawText 과 같이 기본 크기보다 작게는 그리지 않고, 글자 간격은 fontSize / 10
+static float FontScale(int fontSize, int* spacing) {
+    if (fontSize < SOFTWARE_FONT_BASE_SIZE) fontSize = SOFTWARE_FONT_BASE_SIZE;
+    *spacing = fontSize / SOFTWARE_FONT_BASE_SIZE;
+    return (float)fontSize / (float)SOFTWARE_FONT_BASE_SIZE;
+}
+
+static void DrawGlyph(SoftwareCanvas* canvas, unsigned char c, float x, int y, float scale, Color color) {
+    if (c < SOFTWARE_FONT_FIRST_CHAR || c > SOFTWARE_FONT_LAST_CHAR) return;
+    const unsigned char* glyph = FONT_5X7[c - SOFTWARE_FONT_FIRST_CHAR];
+
+    for (int col = 0; col < SOFTWARE_FONT_GLYPH_WIDTH; col++) {
+        if (glyph[col] == 0) continue;
+        int left = (int)floorf(x + col * scale);
+        int right = (int)floorf(x + (col + 1) * scale);
+        for (int row = 0; row < SOFTWARE_FONT_GLYPH_HEIGHT; row++) {
+            if (!(glyph[col] & (1u << row))) continue;
+            // 10 단위 셀에서 위 1 단위 여백 (아래 2 단위는 내려쓰기 공간)
+            int top = y + (int)floorf((row + 1) * scale);
+            int bottom = y + (int)floorf((row + 2) * scale);
+            SoftwareCanvas_FillRect(canvas, left, top, right - left, bottom - top, color);
+        }
+    }
+}
+
+void SoftwareCanvas_DrawText(SoftwareCanvas* canvas, const char* text, int x, int y, int fontSize, Color color) {
+    if (!text || color.a == 0) return;
+    int spacing;
+    float scale = FontScale(fontSize, &spacing);
+    int lineHeight = (int)(SOFTWARE_FONT_BASE_SIZE * scale) + 2 * spacing;
+
+    float penX = (float)x;
+    for (const unsigned char* c = (const unsigned char*)text; *c; c++) {
+        if (*c == '\n') {
+            penX = (float)x;
+            y += lineHeight;
+            continue;
+        }
+        DrawGlyph(canvas, *c, penX, y, scale, color);
+        penX += SOFTWARE_FONT_GLYPH_WIDTH * scale + spacing;
+    }
+}
+
+int SoftwareCanvas_MeasureText(const char* text, int fontSize) {
+    if (!text) return 0;
+    int spacing;
+    float scale = FontScale(fontSize, &spacing);
+    float advance = SOFTWARE_FONT_GLYPH_WIDTH * scale + spacing;
+
+    int widest = 0;
+    int length = 0;
+    for (const char* c = text; ; c++) {
+        if (*c == '\n' || *c == '\0') {
+            int width = (length > 0) ? (int)(length * advance) - spacing : 0;
+            if (width > widest) widest = width;
+            length = 0;
+            if (*c == '\0') break;
+            continue;
+        }
+        length++;
+    }
+    return widest;
+}
+
+void SoftwareCanvas_DrawImage(SoftwareCanvas* canvas, const Color* pixels, int width, int height, int x, int y) {
+    int x0 = (x < 0) ? -x : 0;
+    int y0 = (y < 0) ? -y : 0;
+    int x1 = (x + width > canvas->width) ? canvas->width - x : width;
+    int y1 = (y + height > canvas->height) ? canvas->height - y : height;
+
+    for (int row = y0; row < y1; row++) {
+        const Color* src = pixels + (size_t)row * width;
+        Color* dst = canvas->pixels + (size_t)(y + row) * canvas->width + x;
+        for (int col = x0; col < x1; col++) {
+            if (src[col].a != 0) dst[col] = BlendOver(dst[col], src[col]);
+        }
+    }
+}
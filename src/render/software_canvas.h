@@ -0,0 +1,54 @@
+#ifndef SOFTWARE_CANVAS_H
+#define SOFTWARE_CANVAS_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+// Built-in bitmap font: 5x7 glyphs in a 10-unit cell, like raylib's default font size
+#define SOFTWARE_FONT_BASE_SIZE 10
+#define SOFTWARE_FONT_GLYPH_WIDTH 5
+#define SOFTWARE_FONT_GLYPH_HEIGHT 7
+
+/**
+ * @brief RGBA8 framebuffer with raylib-like drawing primitives on the CPU
+ *
+ * Every primitive alpha-blends onto the canvas the way raylib's default
+ * BLEND_ALPHA mode does and clips to the canvas bounds. A pixel belongs to a
+ * shape when its center (x + 0.5, y + 0.5) is inside it, so shapes never
+ * touch a pixel twice and translucent colors blend exactly once.
+ */
+typedef struct SoftwareCanvas {
+    Color* pixels;      // Row-major, width * height
+    int width;
+    int height;
+} SoftwareCanvas;
+
+// 캔버스 메모리 할당 (검은색 불투명으로 초기화)
+bool SoftwareCanvas_Init(SoftwareCanvas* canvas, int width, int height);
+// 메모리 해제
+void SoftwareCanvas_Destroy(SoftwareCanvas* canvas);
+
+// Overwrite every pixel (no blending, like ClearBackground)
+void SoftwareCanvas_Clear(SoftwareCanvas* canvas, Color color);
+void SoftwareCanvas_DrawPixel(SoftwareCanvas* canvas, int x, int y, Color color);
+void SoftwareCanvas_FillRect(SoftwareCanvas* canvas, int x, int y, int width, int height, Color color);
+// One pixel border inside the rectangle
+void SoftwareCanvas_StrokeRect(SoftwareCanvas* canvas, int x, int y, int width, int height, Color color);
+void SoftwareCanvas_FillCircle(SoftwareCanvas* canvas, float centerX, float centerY, float radius, Color color);
+// One pixel ring: pixels whose center is within half a pixel of the radius
+void SoftwareCanvas_StrokeCircle(SoftwareCanvas* canvas, float centerX, float centerY, float radius, Color color);
+// Segment of the given thickness (pixels within thick / 2 of it, at least the 1 pixel line)
+void SoftwareCanvas_DrawLine(SoftwareCanvas* canvas, float startX, float startY, float endX, float endY,
+                             float thick, Color color);
+// Text in the built-in font scaled to fontSize ('\n' starts a new line)
+void SoftwareCanvas_DrawText(SoftwareCanvas* canvas, const char* text, int x, int y, int fontSize, Color color);
+// Width DrawText covers for the widest line
+int SoftwareCanvas_MeasureText(const char* text, int fontSize);
+// Blend a width * height RGBA image with its top-left corner at (x, y)
+void SoftwareCanvas_DrawImage(SoftwareCanvas* canvas, const Color* pixels, int width, int height, int x, int y);
+
+static inline Color SoftwareCanvas_GetPixel(const SoftwareCanvas* canvas, int x, int y) {
+    return canvas->pixels[y * canvas->width + x];
+}
+
+#endif // SOFTWARE_CANVAS_H
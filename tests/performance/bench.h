@@ -0,0 +1,140 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/**
+ * Minimal benchmark harness (header-only, in the spirit of minunit.h)
+ *
+ * Each benchmark runs a few untimed warm-up iterations, then `samples` timed
+ * iterations. An optional reset callback runs before every iteration outside
+ * the timed region. Results are reported per item (particle, event, ...) as
+ * min / median / p99 over the samples, as a table and optionally as JSON.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+__declspec(dllimport) int __stdcall QueryPerformanceCounter(long long* count);
+__declspec(dllimport) int __stdcall QueryPerformanceFrequency(long long* frequency);
+#else
+#include <time.h>
+#endif
+
+#define BENCH_MAX_RESULTS 32
+#define BENCH_MAX_SAMPLES 1000
+
+typedef void (*BenchFunc)(void* context);
+
+typedef struct BenchResult {
+    const char* name;
+    const char* unit;       // What one item is ("particle", "event", ...)
+    int itemsPerRun;
+    int samples;
+    double minNs;           // Per item
+    double medianNs;
+    double p99Ns;
+} BenchResult;
+
+static BenchResult bench_results[BENCH_MAX_RESULTS];
+static int bench_result_count = 0;
+
+static double Bench_NowNs(void) {
+#ifdef _WIN32
+    long long count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (double)count * 1e9 / (double)frequency;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+}
+
+static int Bench_CompareDouble(const void* a, const void* b) {
+    double da = *(const double*)a;
+    double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+/**
+ * @brief Time `run` and record min/median/p99 per item
+ *
+ * @param reset Optional, called before every iteration (untimed)
+ */
+static BenchResult Bench_Run(const char* name, const char* unit, int itemsPerRun,
+                             int warmup, int samples,
+                             BenchFunc reset, BenchFunc run, void* context) {
+    static double times[BENCH_MAX_SAMPLES];
+    if (samples > BENCH_MAX_SAMPLES) samples = BENCH_MAX_SAMPLES;
+    if (samples < 1) samples = 1;
+    if (itemsPerRun < 1) itemsPerRun = 1;
+
+    for (int i = 0; i < warmup; i++) {
+        if (reset) reset(context);
+        run(context);
+    }
+
+    for (int i = 0; i < samples; i++) {
+        if (reset) reset(context);
+        double start = Bench_NowNs();
+        run(context);
+        times[i] = (Bench_NowNs() - start) / (double)itemsPerRun;
+    }
+
+    qsort(times, samples, sizeof(double), Bench_CompareDouble);
+    int p99Index = (samples * 99 + 99) / 100 - 1;
+
+    BenchResult result = {
+        .name = name,
+        .unit = unit,
+        .itemsPerRun = itemsPerRun,
+        .samples = samples,
+        .minNs = times[0],
+        .medianNs = (samples % 2) ? times[samples / 2]
+                                  : 0.5 * (times[samples / 2 - 1] + times[samples / 2]),
+        .p99Ns = times[p99Index]
+    };
+
+    printf("%-44s %10.2f %10.2f %10.2f  ns/%s (x%d)\n",
+           name, result.minNs, result.medianNs, result.p99Ns, unit, itemsPerRun);
+    fflush(stdout);
+
+    if (bench_result_count < BENCH_MAX_RESULTS) {
+        bench_results[bench_result_count++] = result;
+    }
+    return result;
+}
+
+static void Bench_PrintHeader(void) {
+    printf("%-44s %10s %10s %10s\n", "benchmark", "min", "median", "p99");
+}
+
+// Write every recorded result as a JSON document; returns 0 on success
+static int Bench_WriteJson(const char* path, const char* extraFields) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "bench: cannot write %s\n", path);
+        return 1;
+    }
+
+    fprintf(file, "{\n");
+    if (extraFields && extraFields[0]) {
+        fprintf(file, "  %s,\n", extraFields);
+    }
+    fprintf(file, "  \"results\": [\n");
+    for (int i = 0; i < bench_result_count; i++) {
+        const BenchResult* r = &bench_results[i];
+        fprintf(file, "    {\"name\": \"%s\", \"unit\": \"ns/%s\", \"items\": %d, \"samples\": %d, "
+                      "\"min\": %.3f, \"median\": %.3f, \"p99\": %.3f}%s\n",
+                r->name, r->unit, r->itemsPerRun, r->samples,
+                r->minNs, r->medianNs, r->p99Ns,
+                (i + 1 < bench_result_count) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    return 0;
+}
+
+#endif // BENCH_H
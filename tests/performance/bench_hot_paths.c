@@ -0,0 +1,330 @@
+#include "bench.h"
+#include "../../src/core/game.h"
+#include "../../src/core/physics.h"
+#include "../../src/core/gravity_system.h"
+#include "../../src/core/gravity_field.h"
+#include "../../src/core/memory_pool.h"
+#include "../../src/core/thread_pool.h"
+#include "../../src/core/rng.h"
+#include "../../src/core/event/event_system.h"
+#include "../../src/core/event/event_types.h"
+#include "../../src/render/render.h"
+#include "../../src/render/frame_capture.h"
+#include "../../src/entities/particle_kernel.h"
+
+/**
+ * Hot path benchmarks (make bench)
+ *
+ * Runs against the headless platform layer with a fixed seed, so every run
+ * sees the same particles, enemies and gravity sources.
+ *
+ * Usage: bench [--particles N] [--threads N] [--samples N] [--json FILE]
+ */
+
+// make bench 가 최적화/SIMD 플래그를 넘겨줌 (직접 빌드하면 알 수 없음)
+#ifndef BENCH_BUILD_FLAGS
+#define BENCH_BUILD_FLAGS "unknown"
+#endif
+
+#define BENCH_SEED 20240601ull
+#define BENCH_SCREEN_WIDTH 800
+#define BENCH_SCREEN_HEIGHT 800
+#define BENCH_WARMUP 5
+#define BENCH_DEFAULT_SAMPLES 50
+#define BENCH_ENEMY_COUNT 40
+#define BENCH_GRAVITY_SOURCES 8
+#define BENCH_EVENTS_PER_RUN 512
+#define BENCH_POOL_BLOCKS 4096
+
+static Game game;
+static Enemy enemySnapshot[BENCH_ENEMY_COUNT];
+static EnemyMotion motionSnapshot[BENCH_ENEMY_COUNT];
+static int eventsHandled;
+
+static void SetupEnemies(void) {
+    static const EnemyType types[] = {
+        ENEMY_TYPE_BASIC, ENEMY_TYPE_TRACKER, ENEMY_TYPE_SPEEDY, ENEMY_TYPE_REPULSOR
+    };
+    Vector2 playerPos = game.player.position;
+    Rng rng;
+    Rng_Init(&rng, RNG_STREAM_GAMEPLAY, 0);
+
+    for (int e = 0; e < BENCH_ENEMY_COUNT; e++) {
+        Enemy enemy = InitEnemyByType(types[e % 4], BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, playerPos, &motionSnapshot[e]);
+        enemy.position.x = 50.0f + Rng_NextFloat(&rng) * (BENCH_SCREEN_WIDTH - 100);
+        enemy.position.y = 50.0f + Rng_NextFloat(&rng) * (BENCH_SCREEN_HEIGHT - 100);
+        // 측정 중 죽지 않도록 체력을 크게 설정 (배열 이동/분열 없이 같은 작업량 유지)
+        enemy.health = enemy.maxHealth = 1.0e9f;
+        EnemyStore_Add(&game.enemies, &enemy, &motionSnapshot[e]);
+        enemySnapshot[e] = enemy;
+    }
+}
+
+static void SetupGravitySources(void) {
+    for (int s = 0; s < BENCH_GRAVITY_SOURCES; s++) {
+        GravitySource source = {
+            .position = game.enemies.items[s].position,
+            .radius = 200.0f,
+            .strength = 5.0f,
+            .type = (s % 2) ? GRAVITY_TYPE_REPULSION : GRAVITY_TYPE_ATTRACTION,
+            .active = true,
+            .sourceType = 1
+        };
+        RegisterGravitySource(source);
+    }
+}
+
+//------------------------------------------------------------------------------------
+// Benchmarks
+//------------------------------------------------------------------------------------
+
+static void RunUpdateAllParticles(void* context) {
+    (void)context;
+    UpdateAllParticles(&game, false);
+}
+
+// 매 반복 전에 적 상태를 되돌리고 지난 반복의 이벤트(피해 배치)를 비움
+static void ResetEnemies(void* context) {
+    (void)context;
+    EnemyStore_Clear(&game.enemies);
+    for (int e = 0; e < BENCH_ENEMY_COUNT; e++) {
+        EnemyStore_Add(&game.enemies, &enemySnapshot[e], &motionSnapshot[e]);
+    }
+    ProcessEventQueue();
+}
+
+static void ResetEnemiesWithContacts(void* context) {
+    ResetEnemies(context);
+    // 마지막 UpdateAllParticles 가 기록한 접촉을 다시 사용
+    game.particlePipeline.contactsReady = true;
+}
+
+static void RunProcessEnemyCollisions(void* context) {
+    (void)context;
+    ProcessEnemyCollisions(&game);
+}
+
+static void RunApplyAllGravitySources(void* context) {
+    (void)context;
+    ApplyAllGravitySources(&game, 1.0f / 60.0f);
+}
+
+// 다음 갱신에서 중력장을 다시 굽도록 표시
+static void InvalidateGravityField(void* context) {
+    (void)context;
+    game.gravityField.baked = false;
+}
+
+static void RunRefreshGravityField(void* context) {
+    (void)context;
+    RefreshGravityField(&game.gravityField);
+}
+
+// 폭풍과 같은 크기의 임펄스를 매 반복 다시 큐잉
+static void QueueStormImpulse(void* context) {
+    (void)context;
+    QueueRadialImpulse((RadialImpulse){
+        .center = { BENCH_SCREEN_WIDTH / 2, BENCH_SCREEN_HEIGHT / 2 },
+        .radius = 150.0f,
+        .minDistance = 1.0f,
+        .strength = 3.0f,
+        .probability = 0.7f
+    });
+}
+
+static void RunApplyQueuedRadialImpulses(void* context) {
+    (void)context;
+    ApplyQueuedRadialImpulses(&game, 1.0f / 60.0f);
+}
+
+static void RunParticleRaster(void* context) {
+    (void)context;
+    ParticleRasterSource source = {
+        .x = game.particles.x,
+        .y = game.particles.y,
+        .alpha = 1.0f,
+        .count = game.particles.count,
+        .color = game.particles.color
+    };
+    ParticleRaster_Render(&game.particleRaster, &source);
+}
+
+static void RunDrawGame(void* context) {
+    (void)context;
+    DrawGame(&game);
+}
+
+// 캡처 인코더 스레드가 프레임마다 하는 일
+static void RunEncodeQoi(void* context) {
+    int width, height;
+    const Color* frame = Render_GetFramebuffer(&width, &height);
+    FrameCapture_EncodeQoi(frame, width, height, (unsigned char*)context);
+}
+
+static void RunFindNearestParticle(void* context) {
+    static const Vector2 directions[4] = { {1, 0}, {0, 1}, {-1, 0}, {0, -1} };
+    static int next = 0;
+    (void)context;
+    FindNearestParticleInDirection(&game, directions[next]);
+    next = (next + 1) % 4;
+}
+
+static void CountEvent(const Event* event, void* context) {
+    (void)event;
+    (void)context;
+    eventsHandled++;
+}
+
+static void RunPublishAndProcessEvents(void* context) {
+    (void)context;
+    for (int i = 0; i < BENCH_EVENTS_PER_RUN; i++) {
+        CollisionEventData data = {0};
+        data.entityBIndex = i;
+        data.impact = 1.0f;
+        PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, &data, sizeof(data));
+    }
+    ProcessEventQueue();
+}
+
+typedef struct PoolBenchContext {
+    MemoryPool pool;
+    void* blocks[BENCH_POOL_BLOCKS];
+    int freeOrder[BENCH_POOL_BLOCKS];
+} PoolBenchContext;
+
+// 전부 할당 후 섞인 순서로 반환 (자유 목록이 실제처럼 뒤섞이도록)
+static void RunMemoryPoolAllocFree(void* context) {
+    PoolBenchContext* ctx = (PoolBenchContext*)context;
+    for (int i = 0; i < BENCH_POOL_BLOCKS; i++) {
+        ctx->blocks[i] = MemoryPool_Alloc(&ctx->pool);
+    }
+    for (int i = 0; i < BENCH_POOL_BLOCKS; i++) {
+        MemoryPool_Free(&ctx->pool, ctx->blocks[ctx->freeOrder[i]]);
+    }
+}
+
+//------------------------------------------------------------------------------------
+
+static int ParseIntOption(int argc, char* argv[], const char* name, int fallback) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], name) == 0) {
+            int value = atoi(argv[i + 1]);
+            if (value > 0) return value;
+        }
+    }
+    return fallback;
+}
+
+static const char* ParseJsonPath(int argc, char* argv[]) {
+    for (int i = 1; i < argc - 1; i++) {
+        if (strcmp(argv[i], "--json") == 0) return argv[i + 1];
+    }
+    return NULL;
+}
+
+int main(int argc, char* argv[]) {
+    int particleCount = ParseIntOption(argc, argv, "--particles", DEFAULT_PARTICLE_COUNT);
+    int threadCount = ParseIntOption(argc, argv, "--threads", 1);
+    int samples = ParseIntOption(argc, argv, "--samples", BENCH_DEFAULT_SAMPLES);
+    const char* jsonPath = ParseJsonPath(argc, argv);
+
+    if (particleCount < MIN_PARTICLE_COUNT) particleCount = MIN_PARTICLE_COUNT;
+    if (particleCount > MAX_PARTICLE_COUNT) particleCount = MAX_PARTICLE_COUNT;
+    if (threadCount > THREAD_POOL_MAX_THREADS) threadCount = THREAD_POOL_MAX_THREADS;
+
+    Rng_SetSeed(BENCH_SEED);
+    srand((unsigned int)BENCH_SEED);
+    ThreadPool_Init(threadCount);
+
+    game = InitGame(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, particleCount, DEFAULT_ENEMY_CAPACITY);
+    game.gameState = GAME_STATE_PLAYING;
+    SetupEnemies();
+    SetupGravitySources();
+
+    int n = game.particles.count;
+    printf("bench: %d particles, %d enemies, %d gravity sources, %d threads, %d samples, seed %llu\n",
+           n, BENCH_ENEMY_COUNT, BENCH_GRAVITY_SOURCES, ThreadPool_GetThreadCount(), samples,
+           (unsigned long long)BENCH_SEED);
+    printf("build: %s, particle kernel %s\n\n", BENCH_BUILD_FLAGS, ParticleKernel_GetPathName());
+    Bench_PrintHeader();
+
+    Bench_Run("UpdateAllParticles", "particle", n, BENCH_WARMUP, samples,
+              NULL, RunUpdateAllParticles, NULL);
+
+    // 파이프라인이 기록한 접촉 집계 (실제 게임 경로) / 접촉 검사만 병렬 실행 (단독 호출 경로)
+    UpdateAllParticles(&game, false);
+    Bench_Run("ProcessEnemyCollisions (pipeline contacts)", "enemy", BENCH_ENEMY_COUNT, BENCH_WARMUP, samples,
+              ResetEnemiesWithContacts, RunProcessEnemyCollisions, NULL);
+    Bench_Run("ProcessEnemyCollisions (contact pass)", "particle", n, BENCH_WARMUP, samples,
+              ResetEnemies, RunProcessEnemyCollisions, NULL);
+
+    Bench_Run("ApplyAllGravitySources", "particle", n, BENCH_WARMUP, samples,
+              NULL, RunApplyAllGravitySources, NULL);
+
+    // 구워진 중력장: 샘플링은 파이프라인 안에서 실행되므로 게임과 같은 전체 갱신으로 측정
+    // (중력원이 그대로인 프레임은 샘플링만, 움직인 프레임은 다시 굽기 추가)
+    SetGravityMode(GRAVITY_MODE_FIELD);
+    Bench_Run("UpdateAllParticles (field)", "particle", n, BENCH_WARMUP, samples,
+              NULL, RunUpdateAllParticles, NULL);
+    int fieldNodes = game.gravityField.cols * game.gravityField.rows;
+    Bench_Run("RefreshGravityField (rebake)", "node", fieldNodes, BENCH_WARMUP, samples,
+              InvalidateGravityField, RunRefreshGravityField, NULL);
+    SetGravityMode(GRAVITY_MODE_EXACT);
+
+    Bench_Run("ApplyQueuedRadialImpulses (storm)", "particle", n, BENCH_WARMUP, samples,
+              QueueStormImpulse, RunApplyQueuedRadialImpulses, NULL);
+
+    Bench_Run("ParticleRaster_Render", "particle", n, BENCH_WARMUP, samples,
+              NULL, RunParticleRaster, NULL);
+
+    // 한 프레임 전체를 CPU 래스터라이저로 그리기 (raylib 백엔드는 헤드리스에서 아무것도 안 함)
+    if (Render_Init(RENDER_BACKEND_SOFTWARE, BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT)) {
+        Bench_Run("DrawGame (software)", "frame", 1, BENCH_WARMUP, samples,
+                  NULL, RunDrawGame, NULL);
+        unsigned char* encoded = (unsigned char*)malloc(FrameCapture_QoiMaxSize(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT));
+        if (encoded) {
+            Bench_Run("FrameCapture_EncodeQoi", "frame", 1, BENCH_WARMUP, samples,
+                      NULL, RunEncodeQoi, encoded);
+            free(encoded);
+        }
+        Render_Shutdown();
+    }
+
+    Bench_Run("FindNearestParticleInDirection", "particle", n, BENCH_WARMUP, samples,
+              NULL, RunFindNearestParticle, NULL);
+
+    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, CountEvent, NULL);
+    Bench_Run("PublishEvent + ProcessEventQueue", "event", BENCH_EVENTS_PER_RUN, BENCH_WARMUP, samples,
+              NULL, RunPublishAndProcessEvents, NULL);
+
+    static PoolBenchContext poolContext;
+    MemoryPool_Init(&poolContext.pool, 64, BENCH_POOL_BLOCKS);
+    Rng rng;
+    Rng_Init(&rng, RNG_STREAM_GAMEPLAY, 1);
+    for (int i = 0; i < BENCH_POOL_BLOCKS; i++) poolContext.freeOrder[i] = i;
+    for (int i = BENCH_POOL_BLOCKS - 1; i > 0; i--) {
+        int j = Rng_NextInt(&rng, 0, i);
+        int swap = poolContext.freeOrder[i];
+        poolContext.freeOrder[i] = poolContext.freeOrder[j];
+        poolContext.freeOrder[j] = swap;
+    }
+    Bench_Run("MemoryPool_Alloc + MemoryPool_Free", "op", 2 * BENCH_POOL_BLOCKS, BENCH_WARMUP, samples,
+              NULL, RunMemoryPoolAllocFree, &poolContext);
+    MemoryPool_Destroy(&poolContext.pool);
+
+    int status = 0;
+    if (jsonPath) {
+        char extra[512];
+        snprintf(extra, sizeof(extra),
+                 "\"particles\": %d, \"enemies\": %d, \"threads\": %d, \"samples\": %d, \"seed\": %llu, "
+                 "\"build_flags\": \"%s\", \"kernel_path\": \"%s\"",
+                 n, BENCH_ENEMY_COUNT, ThreadPool_GetThreadCount(), samples, (unsigned long long)BENCH_SEED,
+                 BENCH_BUILD_FLAGS, ParticleKernel_GetPathName());
+        status = Bench_WriteJson(jsonPath, extra);
+        if (status == 0) printf("\nJSON written to %s\n", jsonPath);
+    }
+
+    CleanupGame(&game);
+    ThreadPool_Shutdown();
+    return status;
+}
@@ -16,12 +16,17 @@ void test_setup(void) {
     // Initialize minimal game state for testing
     testGame.screenWidth = 800;
     testGame.screenHeight = 600;
-    testGame.enemyCount = 0;
-    testGame.enemies = (Enemy*)calloc(MAX_ENEMIES, sizeof(Enemy));
+    EnemyStore_Init(&testGame.enemies, DEFAULT_ENEMY_CAPACITY);
 }
 
 void test_teardown(void) {
-    free(testGame.enemies);
+    EnemyStore_Destroy(&testGame.enemies);
+}
+
+static EnemyHandle AddTestEnemy(EnemyType type) {
+    EnemyMotion motion;
+    Enemy enemy = InitEnemyByType(type, 800, 600, (Vector2){100, 100}, &motion);
+    return EnemyStore_Add(&testGame.enemies, &enemy, &motion);
 }
 
 /**
@@ -98,36 +103,35 @@ MU_TEST(test_keyboard_enemy_selection) {
  * one is removed
  */
 MU_TEST(test_remove_nearest_enemy) {
-    testGame.enemyCount = 3;
-
     // Create three enemies at different distances from test point (400, 300)
-    testGame.enemies[0] = InitEnemyByType(ENEMY_TYPE_BASIC, 800, 600, (Vector2){100, 100});
-    testGame.enemies[0].position = (Vector2){450.0f, 350.0f};  // Distance: ~70
+    AddTestEnemy(ENEMY_TYPE_BASIC);
+    testGame.enemies.items[0].position = (Vector2){450.0f, 350.0f};  // Distance: ~70
 
-    testGame.enemies[1] = InitEnemyByType(ENEMY_TYPE_TRACKER, 800, 600, (Vector2){100, 100});
-    testGame.enemies[1].position = (Vector2){600.0f, 500.0f};  // Distance: ~282
+    AddTestEnemy(ENEMY_TYPE_TRACKER);
+    testGame.enemies.items[1].position = (Vector2){600.0f, 500.0f};  // Distance: ~282
 
-    testGame.enemies[2] = InitEnemyByType(ENEMY_TYPE_SPEEDY, 800, 600, (Vector2){100, 100});
-    testGame.enemies[2].position = (Vector2){410.0f, 310.0f};  // Distance: ~14 (nearest)
+    EnemyHandle nearest = AddTestEnemy(ENEMY_TYPE_SPEEDY);
+    testGame.enemies.items[2].position = (Vector2){410.0f, 310.0f};  // Distance: ~14 (nearest)
 
     // Try to remove enemy nearest to (400, 300)
     Vector2 mousePos = {400.0f, 300.0f};
     bool removed = RemoveNearestEnemy(&testGame, mousePos);
 
     mu_assert(removed, "Should successfully remove an enemy");
-    mu_assert_int_eq(2, testGame.enemyCount);  // Should have 2 enemies remaining
+    mu_assert_int_eq(2, testGame.enemies.count);  // Should have 2 enemies remaining
 
     // Verify the nearest enemy (index 2) was removed by checking remaining positions
-    // After removal, enemies should be shifted: [0] stays, [1] stays
-    mu_check(testGame.enemies[0].position.x == 450.0f);  // First enemy unchanged
-    mu_check(testGame.enemies[1].position.x == 600.0f);  // Second enemy unchanged
+    // It was last, so the swap-remove leaves [0] and [1] in place
+    mu_check(testGame.enemies.items[0].position.x == 450.0f);  // First enemy unchanged
+    mu_check(testGame.enemies.items[1].position.x == 600.0f);  // Second enemy unchanged
+    mu_check(EnemyStore_Get(&testGame.enemies, nearest) == NULL);
 }
 
 /**
  * Test 5: Verify RemoveNearestEnemy() returns false when no enemies exist
  */
 MU_TEST(test_remove_nearest_enemy_no_enemies) {
-    testGame.enemyCount = 0;
+    EnemyStore_Clear(&testGame.enemies);
 
     Vector2 mousePos = {400.0f, 300.0f};
     bool removed = RemoveNearestEnemy(&testGame, mousePos);
@@ -0,0 +1,60 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/entities/enemy_behavior.h"
+#include <string.h>
+
+MU_TEST(test_every_type_has_a_descriptor) {
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        const EnemyBehavior* behavior = EnemyBehavior_Get((EnemyType)t);
+        mu_check(behavior->patrol != NULL);
+        mu_check(behavior->label != NULL);
+        mu_check(behavior->radiusMin > 0 && behavior->radiusMin <= behavior->radiusMax);
+        mu_check(behavior->healthPerRadius > 0.0f || behavior->maxHealth > 0.0f);
+        // Shielded types need the full shield value to draw the shield ratio
+        if (behavior->initialFlags & ENEMY_STATE_SHIELDED) {
+            mu_check(behavior->shieldHealth > 0.0f);
+        }
+    }
+    mu_check(EnemyBehavior_Get(ENEMY_TYPE_COUNT) == EnemyBehavior_Get(ENEMY_TYPE_BASIC));
+}
+
+MU_TEST(test_init_applies_type_parameters) {
+    for (int t = 0; t < ENEMY_TYPE_COUNT; t++) {
+        const EnemyBehavior* behavior = EnemyBehavior_Get((EnemyType)t);
+        EnemyMotion motion;
+        Enemy enemy = InitEnemyByType((EnemyType)t, 800, 600, (Vector2){ 400, 300 }, &motion);
+
+        mu_assert_int_eq(t, enemy.type);
+        mu_check(enemy.radius >= behavior->radiusMin && enemy.radius <= behavior->radiusMax);
+        mu_check(enemy.health == enemy.maxHealth);
+        mu_assert_int_eq(behavior->movePattern, enemy.movePattern);
+        mu_assert_int_eq(behavior->aiState, enemy.aiState);
+        mu_check(memcmp(&enemy.color, &behavior->color, sizeof(Color)) == 0);
+        mu_check(enemy.stateFlags == behavior->initialFlags);
+        mu_check(motion.targetPosition.x == 400.0f && motion.targetPosition.y == 300.0f);
+    }
+}
+
+MU_TEST(test_orbiter_motion_starts_at_spawn) {
+    EnemyMotion motion;
+    Enemy enemy = InitEnemyByType(ENEMY_TYPE_ORBITER, 800, 600, (Vector2){ 0, 0 }, &motion);
+    mu_check(motion.orbitCenter.x == enemy.position.x && motion.orbitCenter.y == enemy.position.y);
+    mu_assert_double_eq(100.0, motion.orbitRadius);
+
+    // Circular movement places the enemy on the orbit, not by velocity
+    UpdateEnemyMovement(&enemy, &motion, EnemyBehavior_Get(ENEMY_TYPE_ORBITER), (Vector2){ 0, 0 }, 0.5f);
+    float dx = enemy.position.x - motion.orbitCenter.x;
+    float dy = enemy.position.y - motion.orbitCenter.y;
+    mu_check(fabsf(sqrtf(dx * dx + dy * dy) - 100.0f) < 1e-3f);
+}
+
+MU_TEST_SUITE(enemy_behavior_suite) {
+    MU_RUN_TEST(test_every_type_has_a_descriptor);
+    MU_RUN_TEST(test_init_applies_type_parameters);
+    MU_RUN_TEST(test_orbiter_motion_starts_at_spawn);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(enemy_behavior_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
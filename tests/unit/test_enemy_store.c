@@ -0,0 +1,172 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/entities/enemy_store.h"
+#include <stdlib.h>
+
+#define STORE_TEST_CAPACITY 8
+
+static EnemyStore store;
+
+static Enemy MakeEnemy(float x) {
+    Enemy enemy = {0};
+    enemy.position = (Vector2){ x, 0.0f };
+    return enemy;
+}
+
+static EnemyHandle AddEnemy(float x) {
+    Enemy enemy = MakeEnemy(x);
+    EnemyMotion motion = {0};
+    motion.orbitCenter = (Vector2){ x, 0.0f };
+    return EnemyStore_Add(&store, &enemy, &motion);
+}
+
+void test_setup(void) {
+    EnemyStore_Init(&store, STORE_TEST_CAPACITY);
+}
+
+void test_teardown(void) {
+    EnemyStore_Destroy(&store);
+}
+
+MU_TEST(test_add_returns_resolvable_handles) {
+    EnemyHandle a = AddEnemy(1.0f);
+    EnemyHandle b = AddEnemy(2.0f);
+
+    mu_assert_int_eq(2, store.count);
+    mu_check(!EnemyHandle_IsNull(a) && !EnemyHandle_IsNull(b));
+    mu_check(EnemyStore_Get(&store, a)->position.x == 1.0f);
+    mu_check(EnemyStore_Get(&store, b)->position.x == 2.0f);
+    // Each enemy carries its own handle
+    mu_check(EnemyHandle_Equals(store.items[1].handle, b));
+}
+
+MU_TEST(test_remove_moves_last_into_hole) {
+    EnemyHandle handles[4];
+    for (int i = 0; i < 4; i++) {
+        handles[i] = AddEnemy((float)i);
+    }
+
+    EnemyStore_RemoveAt(&store, 1);
+
+    mu_assert_int_eq(3, store.count);
+    mu_check(store.items[1].position.x == 3.0f);
+    mu_assert_int_eq(1, EnemyStore_IndexOf(&store, handles[3]));
+    mu_check(EnemyHandle_Equals(store.handles[1], handles[3]));
+    mu_check(EnemyStore_Get(&store, handles[1]) == NULL);
+    mu_assert_int_eq(0, EnemyStore_IndexOf(&store, handles[0]));
+    mu_assert_int_eq(2, EnemyStore_IndexOf(&store, handles[2]));
+}
+
+MU_TEST(test_reused_slot_does_not_revive_old_handle) {
+    EnemyHandle old = AddEnemy(1.0f);
+    mu_check(EnemyStore_Remove(&store, old));
+    mu_check(!EnemyStore_Remove(&store, old));
+
+    EnemyHandle reused = AddEnemy(2.0f);
+    mu_assert_int_eq((int)old.slot, (int)reused.slot);
+    mu_check(reused.generation != old.generation);
+    mu_check(EnemyStore_Get(&store, old) == NULL);
+    mu_check(EnemyStore_Get(&store, reused)->position.x == 2.0f);
+    mu_check(EnemyStore_Get(&store, ENEMY_HANDLE_NULL) == NULL);
+}
+
+MU_TEST(test_full_store_rejects_add) {
+    for (int i = 0; i < STORE_TEST_CAPACITY; i++) {
+        mu_check(!EnemyHandle_IsNull(AddEnemy((float)i)));
+    }
+    mu_check(EnemyStore_IsFull(&store));
+    mu_check(EnemyHandle_IsNull(AddEnemy(99.0f)));
+    mu_assert_int_eq(STORE_TEST_CAPACITY, store.count);
+}
+
+MU_TEST(test_clear_invalidates_all_handles) {
+    EnemyHandle handles[STORE_TEST_CAPACITY];
+    for (int i = 0; i < STORE_TEST_CAPACITY; i++) {
+        handles[i] = AddEnemy((float)i);
+    }
+    EnemyStore_Clear(&store);
+
+    int live = 0;
+    for (int i = 0; i < STORE_TEST_CAPACITY; i++) {
+        if (EnemyStore_Get(&store, handles[i])) live++;
+    }
+    mu_assert_int_eq(0, store.count);
+    mu_assert_int_eq(0, live);
+    mu_check(!EnemyHandle_IsNull(AddEnemy(0.0f)));
+}
+
+MU_TEST(test_handles_track_enemies_through_random_removal) {
+    EnemyStore_Destroy(&store);
+    EnemyStore_Init(&store, 1000);
+    srand(5);
+
+    // Position x stores the spawn number, so every live handle must still find it
+    // (and the motion block and previous position must have moved together with its enemy)
+    EnemyHandle handles[4000];
+    int spawned = 0;
+    int errors = 0;
+    for (int round = 0; round < 4000; round++) {
+        if (store.count > 0 && rand() % 3 == 0) {
+            EnemyStore_RemoveAt(&store, rand() % store.count);
+        } else if (!EnemyStore_IsFull(&store)) {
+            handles[spawned] = AddEnemy((float)spawned);
+            spawned++;
+        }
+    }
+
+    int live = 0;
+    for (int i = 0; i < spawned; i++) {
+        Enemy* enemy = EnemyStore_Get(&store, handles[i]);
+        if (!enemy) continue;
+        live++;
+        if (enemy->position.x != (float)i) errors++;
+    }
+    for (int i = 0; i < store.count; i++) {
+        if (store.motion[i].orbitCenter.x != store.items[i].position.x) errors++;
+        if (store.previousPosition[i].x != store.items[i].position.x) errors++;
+    }
+    mu_assert_int_eq(0, errors);
+    mu_assert_int_eq(store.count, live);
+}
+
+MU_TEST(test_group_by_type_keeps_store_order_within_groups) {
+    const EnemyType types[] = {
+        ENEMY_TYPE_CLUSTER, ENEMY_TYPE_BASIC, ENEMY_TYPE_CLUSTER, ENEMY_TYPE_TRACKER, ENEMY_TYPE_BASIC
+    };
+    for (int i = 0; i < 5; i++) {
+        AddEnemy((float)i);
+        store.items[i].type = types[i];
+    }
+
+    int groupStart[ENEMY_TYPE_COUNT + 1];
+    EnemyStore_GroupByType(&store, groupStart);
+
+    mu_assert_int_eq(0, groupStart[ENEMY_TYPE_BASIC]);
+    mu_assert_int_eq(2, groupStart[ENEMY_TYPE_BASIC + 1]);
+    mu_assert_int_eq(1, groupStart[ENEMY_TYPE_TRACKER + 1] - groupStart[ENEMY_TYPE_TRACKER]);
+    mu_assert_int_eq(2, groupStart[ENEMY_TYPE_CLUSTER + 1] - groupStart[ENEMY_TYPE_CLUSTER]);
+    mu_assert_int_eq(5, groupStart[ENEMY_TYPE_COUNT]);
+
+    mu_assert_int_eq(1, store.byType[0]);
+    mu_assert_int_eq(4, store.byType[1]);
+    mu_assert_int_eq(3, store.byType[groupStart[ENEMY_TYPE_TRACKER]]);
+    mu_assert_int_eq(0, store.byType[groupStart[ENEMY_TYPE_CLUSTER]]);
+    mu_assert_int_eq(2, store.byType[groupStart[ENEMY_TYPE_CLUSTER] + 1]);
+}
+
+MU_TEST_SUITE(enemy_store_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_add_returns_resolvable_handles);
+    MU_RUN_TEST(test_remove_moves_last_into_hole);
+    MU_RUN_TEST(test_reused_slot_does_not_revive_old_handle);
+    MU_RUN_TEST(test_full_store_rejects_add);
+    MU_RUN_TEST(test_clear_invalidates_all_handles);
+    MU_RUN_TEST(test_handles_track_enemies_through_random_removal);
+    MU_RUN_TEST(test_group_by_type_keeps_store_order_within_groups);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(enemy_store_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
@@ -0,0 +1,202 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/event/event_system.h"
+#include "../../src/core/event/event_types.h"
+#include "../../src/core/thread_pool.h"
+#include <string.h>
+
+static int handledCount;
+static CollisionEventData lastCollision;
+static bool lastHadData;
+
+void test_setup(void) {
+    InitEventSystem();
+    handledCount = 0;
+    lastHadData = false;
+    memset(&lastCollision, 0, sizeof(lastCollision));
+}
+
+void test_teardown(void) {
+    CleanupEventSystem();
+    ThreadPool_Shutdown();
+}
+
+static void RecordCollision(const Event* event, void* context) {
+    (void)context;
+    handledCount++;
+    lastHadData = event->data != NULL;
+    if (event->data) {
+        lastCollision = *(const CollisionEventData*)event->data;
+    }
+}
+
+MU_TEST(test_payload_is_copied_at_publish) {
+    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, RecordCollision, NULL);
+
+    CollisionEventData data = {0};
+    data.entityBIndex = 7;
+    data.impact = 2.5f;
+    PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, &data, sizeof(data));
+
+    // The caller's copy can change or go out of scope before the queue is processed
+    data.entityBIndex = 99;
+    ProcessEventQueue();
+
+    mu_assert_int_eq(1, handledCount);
+    mu_check(lastHadData);
+    mu_assert_int_eq(7, lastCollision.entityBIndex);
+    mu_assert_double_eq(2.5, lastCollision.impact);
+}
+
+MU_TEST(test_queued_payloads_stay_distinct) {
+    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, RecordCollision, NULL);
+
+    for (int i = 0; i < 100; i++) {
+        CollisionEventData data = {0};
+        data.entityBIndex = i;
+        PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, &data, sizeof(data));
+    }
+    ProcessEventQueue();
+
+    mu_assert_int_eq(100, handledCount);
+    mu_assert_int_eq(99, lastCollision.entityBIndex);
+}
+
+MU_TEST(test_event_without_data) {
+    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, RecordCollision, NULL);
+
+    PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, NULL, 0);
+    ProcessEventQueue();
+
+    mu_assert_int_eq(1, handledCount);
+    mu_check(!lastHadData);
+}
+
+MU_TEST(test_oversized_payload_is_rejected) {
+    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, RecordCollision, NULL);
+
+    char tooLarge[sizeof(EventPayload) + 1];
+    memset(tooLarge, 0, sizeof(tooLarge));
+    PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, tooLarge, sizeof(tooLarge));
+    ProcessEventQueue();
+
+    mu_assert_int_eq(0, handledCount);
+}
+
+static int batchDispatches;
+static int batchHits;
+
+static void SumDamageBatch(const Event* event, void* context) {
+    (void)context;
+    const EventBatchData* batch = (const EventBatchData*)event->data;
+    const EnemyDamageRecord* records = (const EnemyDamageRecord*)batch->items;
+    batchDispatches++;
+    for (int i = 0; i < batch->count; i++) {
+        batchHits += records[i].hits;
+    }
+}
+
+MU_TEST(test_batch_is_dispatched_once) {
+    batchDispatches = 0;
+    batchHits = 0;
+    SubscribeToEvent(EVENT_ENEMY_DAMAGE_BATCH, SumDamageBatch, NULL);
+
+    EnemyDamageRecord records[50];
+    for (int i = 0; i < 50; i++) {
+        records[i] = (EnemyDamageRecord){ .enemy = { (uint32_t)i, 1 }, .hits = i + 1 };
+    }
+    PublishEventBatch(EVENT_ENEMY_DAMAGE_BATCH, records, sizeof(EnemyDamageRecord), 50);
+    // Records are copied, so the caller may reuse its array right away
+    memset(records, 0, sizeof(records));
+    PublishEventBatch(EVENT_ENEMY_DAMAGE_BATCH, records, sizeof(EnemyDamageRecord), 0);
+    ProcessEventQueue();
+
+    mu_assert_int_eq(1, batchDispatches);
+    mu_assert_int_eq(50 * 51 / 2, batchHits);
+}
+
+MU_TEST(test_batch_arena_is_reused_each_frame) {
+    batchDispatches = 0;
+    batchHits = 0;
+    SubscribeToEvent(EVENT_ENEMY_DAMAGE_BATCH, SumDamageBatch, NULL);
+
+    // Far more records over many frames than the arena holds at once
+    EnemyDamageRecord records[64];
+    for (int i = 0; i < 64; i++) {
+        records[i] = (EnemyDamageRecord){ .hits = 1 };
+    }
+    for (int frame = 0; frame < 1000; frame++) {
+        PublishEventBatch(EVENT_ENEMY_DAMAGE_BATCH, records, sizeof(EnemyDamageRecord), 64);
+        ProcessEventQueue();
+    }
+
+    mu_assert_int_eq(1000, batchDispatches);
+    mu_assert_int_eq(64000, batchHits);
+}
+
+#define STRESS_EVENTS_PER_ROUND 1000
+#define STRESS_ROUNDS 300
+
+static int stressNext;
+static int stressOutOfOrder;
+
+static void CheckStressOrder(const Event* event, void* context) {
+    (void)context;
+    const CollisionEventData* data = (const CollisionEventData*)event->data;
+    if (data->entityBIndex != stressNext) stressOutOfOrder++;
+    stressNext++;
+}
+
+static void PublishRange(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    (void)userData;
+    for (int i = begin; i < end; i++) {
+        CollisionEventData data = {0};
+        data.entityBIndex = i + 1;     // 0 and STRESS_EVENTS_PER_ROUND + 1 come from the main thread
+        PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, &data, sizeof(data));
+    }
+}
+
+MU_TEST(test_publish_from_16_threads_keeps_serial_order) {
+    mu_check(ThreadPool_Init(16));
+    SubscribeToEvent(EVENT_COLLISION_PARTICLE_ENEMY, CheckStressOrder, NULL);
+    stressOutOfOrder = 0;
+
+    int delivered = 0;
+    for (int round = 0; round < STRESS_ROUNDS; round++) {
+        stressNext = 0;
+
+        CollisionEventData before = {0};
+        before.entityBIndex = 0;
+        PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, &before, sizeof(before));
+
+        ThreadPool_ParallelFor(STRESS_EVENTS_PER_ROUND, 16, PublishRange, NULL);
+
+        CollisionEventData after = {0};
+        after.entityBIndex = STRESS_EVENTS_PER_ROUND + 1;
+        PublishEvent(EVENT_COLLISION_PARTICLE_ENEMY, &after, sizeof(after));
+
+        ProcessEventQueue();
+        delivered += stressNext;
+    }
+
+    mu_assert_int_eq(0, stressOutOfOrder);
+    mu_assert_int_eq(STRESS_ROUNDS * (STRESS_EVENTS_PER_ROUND + 2), delivered);
+}
+
+MU_TEST_SUITE(event_system_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_payload_is_copied_at_publish);
+    MU_RUN_TEST(test_queued_payloads_stay_distinct);
+    MU_RUN_TEST(test_event_without_data);
+    MU_RUN_TEST(test_oversized_payload_is_rejected);
+    MU_RUN_TEST(test_batch_is_dispatched_once);
+    MU_RUN_TEST(test_batch_arena_is_reused_each_frame);
+    MU_RUN_TEST(test_publish_from_16_threads_keeps_serial_order);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(event_system_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
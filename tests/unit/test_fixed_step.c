@@ -0,0 +1,108 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/fixed_step.h"
+#include <math.h>
+
+static FixedStep stepClock;
+
+void test_setup(void) {
+    FixedStep_Init(&stepClock, SIM_DEFAULT_RATE);
+}
+
+void test_teardown(void) {
+}
+
+MU_TEST(test_init_rejects_out_of_range_rate) {
+    FixedStep_Init(&stepClock, SIM_MAX_RATE + 1);
+    mu_assert_int_eq(SIM_DEFAULT_RATE, stepClock.rate);
+    FixedStep_Init(&stepClock, 0);
+    mu_assert_int_eq(SIM_DEFAULT_RATE, stepClock.rate);
+
+    FixedStep_Init(&stepClock, 120);
+    mu_assert_int_eq(120, stepClock.rate);
+    mu_check(stepClock.stepSeconds == 1.0f / 120.0f);
+    mu_check(stepClock.alpha == 1.0f);
+    mu_check(!stepClock.hasPrevious);
+}
+
+MU_TEST(test_matching_frame_rate_runs_one_step_per_frame) {
+    for (int frame = 0; frame < 600; frame++) {
+        mu_assert_int_eq(1, FixedStep_Advance(&stepClock, 1.0f / 60.0f));
+    }
+    mu_check(stepClock.steps == 600);
+    mu_check(stepClock.accumulator == 0.0f);
+    mu_check(stepClock.alpha == 0.0f);
+}
+
+MU_TEST(test_slower_simulation_carries_remainder) {
+    FixedStep_Init(&stepClock, 30);
+
+    // 60 fps 화면에서 30 Hz 시뮬레이션: 두 프레임에 한 스텝, 사이 프레임은 절반 보간
+    int total = 0;
+    for (int frame = 0; frame < 60; frame++) {
+        int steps = FixedStep_Advance(&stepClock, 1.0f / 60.0f);
+        mu_check(steps == 0 || steps == 1);
+        total += steps;
+        if (stepClock.hasPrevious) {
+            mu_check(stepClock.alpha >= 0.0f && stepClock.alpha < 1.0f);
+        }
+    }
+    mu_check(total >= 29 && total <= 30);
+}
+
+MU_TEST(test_faster_simulation_runs_several_steps) {
+    FixedStep_Init(&stepClock, 240);
+
+    int total = 0;
+    for (int frame = 0; frame < 60; frame++) {
+        total += FixedStep_Advance(&stepClock, 1.0f / 60.0f);
+    }
+    mu_check(total >= 239 && total <= 240);
+    mu_check(stepClock.droppedSteps == 0);
+}
+
+MU_TEST(test_long_frame_drops_backlog) {
+    // 1초 멈춤: 최대 스텝만 실행하고 나머지는 버림 (한 스텝 미만만 남김)
+    int steps = FixedStep_Advance(&stepClock, 1.0f);
+    mu_assert_int_eq(SIM_MAX_STEPS_PER_FRAME, steps);
+    mu_check(stepClock.droppedSteps >= 60 - SIM_MAX_STEPS_PER_FRAME - 1);
+    mu_check(stepClock.accumulator >= 0.0f && stepClock.accumulator < stepClock.stepSeconds);
+    mu_check(stepClock.alpha >= 0.0f && stepClock.alpha < 1.0f);
+}
+
+MU_TEST(test_alpha_is_one_until_a_step_runs) {
+    mu_assert_int_eq(0, FixedStep_Advance(&stepClock, 0.25f / 60.0f));
+    mu_check(stepClock.alpha == 1.0f);
+
+    mu_assert_int_eq(1, FixedStep_Advance(&stepClock, 1.0f / 60.0f));
+    mu_check(fabsf(stepClock.alpha - 0.25f) < 1e-4f);
+
+    FixedStep_Reset(&stepClock);
+    mu_check(stepClock.accumulator == 0.0f);
+    mu_check(stepClock.alpha == 1.0f);
+    mu_check(!stepClock.hasPrevious);
+}
+
+MU_TEST(test_scale_is_exact_at_reference_rate) {
+    // 60Hz 에서 배율이 정확히 1 이어야 기존 상수와 비트 단위로 같은 결과
+    mu_check(FixedStep_Scale(1.0f / 60.0f) == 1.0f);
+    mu_check(fabsf(FixedStep_Scale(1.0f / 120.0f) - 0.5f) < 1e-6f);
+    mu_check(fabsf(FixedStep_Scale(1.0f / 30.0f) - 2.0f) < 1e-6f);
+}
+
+MU_TEST_SUITE(fixed_step_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_init_rejects_out_of_range_rate);
+    MU_RUN_TEST(test_matching_frame_rate_runs_one_step_per_frame);
+    MU_RUN_TEST(test_slower_simulation_carries_remainder);
+    MU_RUN_TEST(test_faster_simulation_runs_several_steps);
+    MU_RUN_TEST(test_long_frame_drops_backlog);
+    MU_RUN_TEST(test_alpha_is_one_until_a_step_runs);
+    MU_RUN_TEST(test_scale_is_exact_at_reference_rate);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(fixed_step_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
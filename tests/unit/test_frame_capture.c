@@ -0,0 +1,243 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/render/frame_capture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CAPTURE_TEST_DIR "capture_test_frames"
+#define CAPTURE_TEST_WIDTH 96
+#define CAPTURE_TEST_HEIGHT 64
+#define CAPTURE_TEST_PIXELS (CAPTURE_TEST_WIDTH * CAPTURE_TEST_HEIGHT)
+
+static Color* image;
+static Color* decoded;
+static unsigned char* encoded;
+
+// 테스트용 QOI 디코더 (사양 그대로, RGBA 전용)
+static bool DecodeQoi(const unsigned char* data, size_t size, int* width, int* height, Color* out) {
+    if (size < 22 || memcmp(data, "qoif", 4) != 0 || data[12] != 4) return false;
+    *width = (int)((uint32_t)data[4] << 24 | (uint32_t)data[5] << 16 | (uint32_t)data[6] << 8 | data[7]);
+    *height = (int)((uint32_t)data[8] << 24 | (uint32_t)data[9] << 16 | (uint32_t)data[10] << 8 | data[11]);
+
+    Color index[64];
+    memset(index, 0, sizeof(index));
+    Color px = { 0, 0, 0, 255 };
+    size_t p = 14;
+    int run = 0;
+    for (int i = 0; i < *width * *height; i++) {
+        if (run > 0) {
+            run--;
+        } else {
+            unsigned char b = data[p++];
+            if (b == 0xfe) {
+                px.r = data[p++]; px.g = data[p++]; px.b = data[p++];
+            } else if (b == 0xff) {
+                px.r = data[p++]; px.g = data[p++]; px.b = data[p++]; px.a = data[p++];
+            } else if ((b & 0xc0) == 0x00) {
+                px = index[b];
+            } else if ((b & 0xc0) == 0x40) {
+                px.r += ((b >> 4) & 3) - 2;
+                px.g += ((b >> 2) & 3) - 2;
+                px.b += (b & 3) - 2;
+            } else if ((b & 0xc0) == 0x80) {
+                int dg = (b & 0x3f) - 32;
+                unsigned char b2 = data[p++];
+                px.r += dg - 8 + ((b2 >> 4) & 0x0f);
+                px.g += dg;
+                px.b += dg - 8 + (b2 & 0x0f);
+            } else {
+                run = b & 0x3f;
+            }
+            index[(px.r * 3 + px.g * 5 + px.b * 7 + px.a * 11) % 64] = px;
+        }
+        out[i] = px;
+        if (p > size - 8) return false;
+    }
+    static const unsigned char END_MARKER[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+    return p + 8 == size && memcmp(data + p, END_MARKER, 8) == 0;
+}
+
+// 런, 작은 차이, 큰 차이, 알파 변화가 모두 들어간 이미지
+static void FillTestImage(int seed) {
+    srand((unsigned int)seed);
+    for (int y = 0; y < CAPTURE_TEST_HEIGHT; y++) {
+        for (int x = 0; x < CAPTURE_TEST_WIDTH; x++) {
+            Color* px = &image[y * CAPTURE_TEST_WIDTH + x];
+            if (y < 8) {
+                *px = (Color){ 10, 20, 30, 255 };
+            } else if (y < 24) {
+                *px = (Color){ (unsigned char)(x + seed), (unsigned char)(y * 2), (unsigned char)(x + y), 255 };
+            } else {
+                *px = (Color){ (unsigned char)rand(), (unsigned char)rand(), (unsigned char)rand(),
+                               (unsigned char)((x % 3) ? 255 : rand()) };
+            }
+        }
+    }
+}
+
+static char* FramePath(char* buffer, size_t size, int frame, const char* extension) {
+    snprintf(buffer, size, "%s/frame_%06d.%s", CAPTURE_TEST_DIR, frame, extension);
+    return buffer;
+}
+
+static size_t ReadFile(const char* path, unsigned char* out, size_t capacity) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return 0;
+    size_t size = fread(out, 1, capacity, file);
+    fclose(file);
+    return size;
+}
+
+static void RemoveCapturedFrames(int count) {
+    char path[128];
+    for (int i = 0; i < count; i++) {
+        remove(FramePath(path, sizeof(path), i, "qoi"));
+        remove(FramePath(path, sizeof(path), i, "ppm"));
+    }
+    remove(CAPTURE_TEST_DIR);
+}
+
+void test_setup(void) {
+    image = (Color*)malloc(CAPTURE_TEST_PIXELS * sizeof(Color));
+    decoded = (Color*)malloc(CAPTURE_TEST_PIXELS * sizeof(Color));
+    encoded = (unsigned char*)malloc(FrameCapture_QoiMaxSize(CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT));
+}
+
+void test_teardown(void) {
+    FrameCapture_Stop();
+    free(encoded);
+    free(decoded);
+    free(image);
+}
+
+MU_TEST(test_qoi_header_and_run_encoding) {
+    // 시작 픽셀 (0, 0, 0, 255) 와 같은 16 픽셀 = QOI_OP_RUN 하나
+    Color flat[16];
+    for (int i = 0; i < 16; i++) flat[i] = (Color){ 0, 0, 0, 255 };
+    size_t size = FrameCapture_EncodeQoi(flat, 4, 4, encoded);
+
+    mu_assert_int_eq(14 + 1 + 8, (int)size);
+    mu_check(memcmp(encoded, "qoif", 4) == 0);
+    mu_assert_int_eq(4, encoded[7]);
+    mu_assert_int_eq(4, encoded[11]);
+    mu_assert_int_eq(4, encoded[12]);
+    mu_assert_int_eq(0xc0 | 15, encoded[14]);
+    mu_assert_int_eq(1, encoded[size - 1]);
+}
+
+MU_TEST(test_qoi_round_trip_is_lossless) {
+    FillTestImage(7);
+    size_t size = FrameCapture_EncodeQoi(image, CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT, encoded);
+    mu_check(size <= FrameCapture_QoiMaxSize(CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT));
+
+    int width = 0, height = 0;
+    mu_check(DecodeQoi(encoded, size, &width, &height, decoded));
+    mu_assert_int_eq(CAPTURE_TEST_WIDTH, width);
+    mu_assert_int_eq(CAPTURE_TEST_HEIGHT, height);
+    mu_check(memcmp(image, decoded, CAPTURE_TEST_PIXELS * sizeof(Color)) == 0);
+}
+
+MU_TEST(test_capture_writes_numbered_qoi_frames) {
+    mu_check(!FrameCapture_Submit(image));
+    mu_check(FrameCapture_Start(CAPTURE_TEST_DIR "/", FRAME_CAPTURE_FORMAT_QOI, CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT));
+    mu_check(FrameCapture_IsActive());
+
+    // 링 크기만큼은 인코더 속도와 상관없이 버려지지 않음
+    for (int frame = 0; frame < FRAME_CAPTURE_RING_SIZE; frame++) {
+        FillTestImage(frame);
+        mu_check(FrameCapture_Submit(image));
+    }
+    FrameCapture_Stop();
+    mu_check(!FrameCapture_IsActive());
+
+    FrameCaptureStats stats = FrameCapture_GetStats();
+    mu_assert_int_eq(FRAME_CAPTURE_RING_SIZE, stats.submitted);
+    mu_assert_int_eq(FRAME_CAPTURE_RING_SIZE, stats.written);
+    mu_assert_int_eq(0, stats.dropped);
+    mu_assert_int_eq(0, stats.failed);
+
+    // 제출한 뒤 원본을 바꿔도 캡처된 프레임은 제출 시점의 복사본
+    char path[128];
+    size_t capacity = FrameCapture_QoiMaxSize(CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT);
+    int width, height;
+    for (int frame = 0; frame < FRAME_CAPTURE_RING_SIZE; frame += 3) {
+        size_t size = ReadFile(FramePath(path, sizeof(path), frame, "qoi"), encoded, capacity);
+        mu_check(DecodeQoi(encoded, size, &width, &height, decoded));
+        FillTestImage(frame);
+        mu_check(memcmp(image, decoded, CAPTURE_TEST_PIXELS * sizeof(Color)) == 0);
+    }
+    RemoveCapturedFrames(FRAME_CAPTURE_RING_SIZE);
+}
+
+MU_TEST(test_capture_writes_ppm) {
+    FillTestImage(3);
+    mu_check(FrameCapture_Start(CAPTURE_TEST_DIR, FRAME_CAPTURE_FORMAT_PPM, CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT));
+    mu_check(FrameCapture_Submit(image));
+    FrameCapture_Stop();
+
+    char path[128];
+    size_t capacity = FrameCapture_QoiMaxSize(CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT);
+    size_t size = ReadFile(FramePath(path, sizeof(path), 0, "ppm"), encoded, capacity);
+    const char* header = "P6\n96 64\n255\n";
+    size_t headerSize = strlen(header);
+    mu_assert_int_eq((int)(headerSize + CAPTURE_TEST_PIXELS * 3), (int)size);
+    mu_check(memcmp(encoded, header, headerSize) == 0);
+
+    const Color last = image[CAPTURE_TEST_PIXELS - 1];
+    const unsigned char* lastRgb = encoded + size - 3;
+    mu_check(lastRgb[0] == last.r && lastRgb[1] == last.g && lastRgb[2] == last.b);
+    RemoveCapturedFrames(1);
+}
+
+MU_TEST(test_full_ring_drops_instead_of_blocking) {
+    enum { SUBMITS = 200 };
+    FillTestImage(11);
+    mu_check(FrameCapture_Start(CAPTURE_TEST_DIR, FRAME_CAPTURE_FORMAT_QOI, CAPTURE_TEST_WIDTH, CAPTURE_TEST_HEIGHT));
+    int accepted = 0;
+    for (int i = 0; i < SUBMITS; i++) {
+        if (FrameCapture_Submit(image)) accepted++;
+    }
+    FrameCapture_Stop();
+
+    // 버린 프레임 번호는 파일이 없고, 나머지는 모두 기록됨
+    FrameCaptureStats stats = FrameCapture_GetStats();
+    mu_assert_int_eq(SUBMITS, stats.submitted);
+    mu_assert_int_eq(accepted, stats.written);
+    mu_assert_int_eq(SUBMITS - accepted, stats.dropped);
+    mu_check(accepted >= FRAME_CAPTURE_RING_SIZE);
+
+    char path[128];
+    int files = 0;
+    for (int i = 0; i < SUBMITS; i++) {
+        FILE* file = fopen(FramePath(path, sizeof(path), i, "qoi"), "rb");
+        if (file) {
+            files++;
+            fclose(file);
+        }
+    }
+    mu_assert_int_eq(accepted, files);
+    RemoveCapturedFrames(SUBMITS);
+}
+
+MU_TEST(test_parse_format) {
+    mu_assert_int_eq(FRAME_CAPTURE_FORMAT_PPM, FrameCapture_ParseFormat("ppm"));
+    mu_assert_int_eq(FRAME_CAPTURE_FORMAT_QOI, FrameCapture_ParseFormat("qoi"));
+    mu_assert_int_eq(FRAME_CAPTURE_FORMAT_QOI, FrameCapture_ParseFormat(NULL));
+}
+
+MU_TEST_SUITE(frame_capture_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_qoi_header_and_run_encoding);
+    MU_RUN_TEST(test_qoi_round_trip_is_lossless);
+    MU_RUN_TEST(test_capture_writes_numbered_qoi_frames);
+    MU_RUN_TEST(test_capture_writes_ppm);
+    MU_RUN_TEST(test_full_ring_drops_instead_of_blocking);
+    MU_RUN_TEST(test_parse_format);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(frame_capture_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
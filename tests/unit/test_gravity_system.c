@@ -0,0 +1,304 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/gravity_system.h"
+#include "../../src/core/gravity_field.h"
+#include "../../src/core/game.h"
+#include "../../src/core/thread_pool.h"
+#include "../../src/core/fixed_step.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define GRAVITY_TEST_WIDTH 800
+#define GRAVITY_TEST_HEIGHT 600
+#define GRAVITY_TEST_COUNT 20000
+
+static ParticleBuffer particles;
+static ParticleBuffer reference;
+static SpatialGrid grid;
+static GravityField field;
+
+void test_setup(void) {
+    srand(77);
+    ParticleBuffer_Init(&particles, GRAVITY_TEST_COUNT);
+    ParticleBuffer_Init(&reference, GRAVITY_TEST_COUNT);
+    for (int i = 0; i < particles.count; i++) {
+        // A few particles off screen to cover the clamped edge cells
+        particles.x[i] = (float)(rand() % (GRAVITY_TEST_WIDTH + 40)) - 20.0f;
+        particles.y[i] = (float)(rand() % (GRAVITY_TEST_HEIGHT + 40)) - 20.0f;
+        particles.vx[i] = 0.0f;
+        particles.vy[i] = 0.0f;
+    }
+    memcpy(reference.x, particles.x, particles.count * sizeof(float));
+    memcpy(reference.y, particles.y, particles.count * sizeof(float));
+    memset(reference.vx, 0, particles.count * sizeof(float));
+    memset(reference.vy, 0, particles.count * sizeof(float));
+
+    SpatialGrid_Init(&grid, GRAVITY_TEST_WIDTH, GRAVITY_TEST_HEIGHT, PARTICLE_GRID_CELL_SIZE, particles.count);
+    SpatialGrid_Rebuild(&grid, &particles);
+    GravityField_Init(&field, GRAVITY_TEST_WIDTH, GRAVITY_TEST_HEIGHT, GRAVITY_FIELD_CELL_SIZE);
+    InitGravitySystem();
+}
+
+void test_teardown(void) {
+    CleanupGravitySystem();
+    ThreadPool_Shutdown();
+    GravityField_Destroy(&field);
+    SpatialGrid_Destroy(&grid);
+    ParticleBuffer_Destroy(&reference);
+    ParticleBuffer_Destroy(&particles);
+}
+
+static void RegisterTestSources(void) {
+    const Vector2 centers[] = { {100, 100}, {400, 300}, {420, 320}, {790, 590}, {-10, 300} };
+    for (int i = 0; i < 5; i++) {
+        GravitySource source = {
+            .position = centers[i],
+            .radius = (i == 1) ? 200.0f : 120.0f,
+            .strength = 2.0f + i,
+            .type = (i % 2) ? GRAVITY_TYPE_REPULSION : GRAVITY_TYPE_ATTRACTION,
+            .active = true,
+            .sourceType = 1
+        };
+        RegisterGravitySource(source);
+    }
+}
+
+// One exact-mode gravity pass over target at the reference step (scale 1.0)
+static void RunGravityPass(ParticleBuffer* target) {
+    static Game game;
+    game.particles = *target;
+    game.particleGrid = grid;
+    ApplyAllGravitySources(&game, 1.0f / SIM_REFERENCE_RATE);
+    grid = game.particleGrid;
+}
+
+// Largest velocity difference against the unculled reference path
+static float MaxDifference(void) {
+    float worst = 0.0f;
+    for (int i = 0; i < particles.count; i++) {
+        float dx = fabsf(particles.vx[i] - reference.vx[i]);
+        float dy = fabsf(particles.vy[i] - reference.vy[i]);
+        if (dx > worst) worst = dx;
+        if (dy > worst) worst = dy;
+    }
+    return worst;
+}
+
+MU_TEST(test_grid_pass_matches_reference) {
+    RegisterTestSources();
+    ApplyGravityToParticles(&reference, 0, reference.count);
+    RunGravityPass(&particles);
+
+    // Same forces, only the summation order of overlapping sources differs
+    mu_check(MaxDifference() < 1e-5f);
+
+    int affected = 0;
+    for (int i = 0; i < particles.count; i++) {
+        if (particles.vx[i] != 0.0f || particles.vy[i] != 0.0f) affected++;
+    }
+    mu_check(affected > 0);
+}
+
+MU_TEST(test_inactive_sources_are_skipped) {
+    RegisterTestSources();
+    for (int id = 1; id <= 5; id++) {
+        SetGravitySourceActive(id, false);
+    }
+    RunGravityPass(&particles);
+
+    int moved = 0;
+    for (int i = 0; i < particles.count; i++) {
+        if (particles.vx[i] != 0.0f || particles.vy[i] != 0.0f) moved++;
+    }
+    mu_assert_int_eq(0, moved);
+}
+
+MU_TEST(test_grid_pass_is_identical_across_threads) {
+    RegisterTestSources();
+    RunGravityPass(&reference);
+
+    mu_check(ThreadPool_Init(4));
+    RunGravityPass(&particles);
+
+    mu_check(memcmp(particles.vx, reference.vx, particles.count * sizeof(float)) == 0);
+    mu_check(memcmp(particles.vy, reference.vy, particles.count * sizeof(float)) == 0);
+}
+
+MU_TEST(test_field_matches_exact_path) {
+    RegisterTestSources();
+    ApplyGravityToParticles(&reference, 0, reference.count);
+    RefreshGravityField(&field);
+    GravityField_Apply(&field, &particles, 0, particles.count, 1.0f);
+
+    // Bilinear error is largest where the force turns sharply: at a source
+    // center and at a radius edge. Report it everywhere, bound it away from centers.
+    const Vector2 centers[] = { {100, 100}, {400, 300}, {420, 320}, {790, 590}, {-10, 300} };
+    double errorSquared = 0.0, forceSquared = 0.0;
+    double farErrorSquared = 0.0, farForceSquared = 0.0;
+    float worstFar = 0.0f;
+    for (int i = 0; i < particles.count; i++) {
+        float ex = particles.vx[i] - reference.vx[i];
+        float ey = particles.vy[i] - reference.vy[i];
+        float errorSq = ex * ex + ey * ey;
+        float forceSq = reference.vx[i] * reference.vx[i] + reference.vy[i] * reference.vy[i];
+        errorSquared += errorSq;
+        forceSquared += forceSq;
+
+        bool nearCenter = false;
+        for (int c = 0; c < 5; c++) {
+            float dx = particles.x[i] - centers[c].x;
+            float dy = particles.y[i] - centers[c].y;
+            if (dx * dx + dy * dy < 4.0f * GRAVITY_FIELD_CELL_SIZE * GRAVITY_FIELD_CELL_SIZE) nearCenter = true;
+        }
+        // Off-screen particles sample the edge nodes, so only on-screen ones are bounded
+        bool onScreen = particles.x[i] >= 0.0f && particles.x[i] <= GRAVITY_TEST_WIDTH &&
+                        particles.y[i] >= 0.0f && particles.y[i] <= GRAVITY_TEST_HEIGHT;
+        if (nearCenter || !onScreen) continue;
+        farErrorSquared += errorSq;
+        farForceSquared += forceSq;
+        if (sqrtf(errorSq) > worstFar) worstFar = sqrtf(errorSq);
+    }
+    double relativeRms = sqrt(errorSquared / forceSquared);
+    double farRelativeRms = sqrt(farErrorSquared / farForceSquared);
+    printf("Gravity field vs exact (cell %.0f px): %.2f%% rms overall, %.2f%% rms / max %.3f away from centers\n",
+           GRAVITY_FIELD_CELL_SIZE, relativeRms * 100.0, farRelativeRms * 100.0, worstFar);
+
+    mu_check(farRelativeRms < 0.05);
+    // About a cell of linear falloff (strength * cell / radius, summed over overlapping sources)
+    mu_check(worstFar < 0.5f);
+}
+
+MU_TEST(test_field_rebakes_only_when_sources_change) {
+    RegisterTestSources();
+    RefreshGravityField(&field);
+    mu_check(field.baked);
+
+    // Unchanged sources keep the baked nodes (sentinel survives)
+    field.force[0] = (Vector2){ 123.0f, 0.0f };
+    RefreshGravityField(&field);
+    mu_assert_double_eq(123.0, field.force[0].x);
+    UpdateGravitySource(1, (Vector2){ 100, 100 });  // Same position
+    RefreshGravityField(&field);
+    mu_assert_double_eq(123.0, field.force[0].x);
+
+    // A moved source re-bakes every node
+    UpdateGravitySource(1, (Vector2){ 104, 100 });
+    RefreshGravityField(&field);
+    mu_assert_double_eq(0.0, field.force[0].x);
+
+    // Toggling a source re-bakes as well
+    field.force[0] = (Vector2){ 123.0f, 0.0f };
+    SetGravitySourceActive(2, false);
+    RefreshGravityField(&field);
+    mu_assert_double_eq(0.0, field.force[0].x);
+}
+
+MU_TEST(test_field_bake_is_identical_across_threads) {
+    RegisterTestSources();
+    RefreshGravityField(&field);
+    int nodes = field.cols * field.rows;
+    Vector2* serial = (Vector2*)malloc(nodes * sizeof(Vector2));
+    memcpy(serial, field.force, nodes * sizeof(Vector2));
+
+    mu_check(ThreadPool_Init(4));
+    field.baked = false;
+    RefreshGravityField(&field);
+    mu_check(memcmp(serial, field.force, nodes * sizeof(Vector2)) == 0);
+    free(serial);
+}
+
+MU_TEST(test_impulse_reaches_only_particles_in_range) {
+    const Vector2 center = { 300, 200 };
+    mu_check(ApplyRadialImpulse(center, 150.0f, 5.0f));
+    RunGravityPass(&particles);
+
+    int pushed = 0;
+    float worst = 0.0f;
+    for (int i = 0; i < particles.count; i++) {
+        float dx = particles.x[i] - center.x;
+        float dy = particles.y[i] - center.y;
+        float dist = sqrtf(dx * dx + dy * dy);
+        float expectedX = 0.0f, expectedY = 0.0f;
+        if (dist < 150.0f && dist > 1.0f) {
+            float scale = (1.0f - dist / 150.0f) * 5.0f / dist;
+            expectedX = dx * scale;
+            expectedY = dy * scale;
+            pushed++;
+        }
+        worst = fmaxf(worst, fmaxf(fabsf(particles.vx[i] - expectedX), fabsf(particles.vy[i] - expectedY)));
+    }
+    mu_check(worst < 1e-5f);
+    mu_check(pushed > 0);
+}
+
+MU_TEST(test_timed_impulse_expires) {
+    static Game game;
+    game.particles = particles;
+    game.particleGrid = grid;
+
+    // One-pass impulse is gone after the next pass
+    ApplyRadialImpulse((Vector2){ 400, 300 }, 100.0f, 2.0f);
+    mu_assert_int_eq(1, GetQueuedRadialImpulseCount());
+    ApplyAllGravitySources(&game, 0.02f);
+    mu_assert_int_eq(0, GetQueuedRadialImpulseCount());
+
+    // Timed impulse keeps applying until its duration runs out
+    RadialImpulse blast = { .center = { 400, 300 }, .radius = 100.0f, .minDistance = 1.0f,
+                            .strength = 2.0f, .probability = 1.0f, .duration = 0.05f };
+    mu_check(QueueRadialImpulse(blast));
+    ApplyAllGravitySources(&game, 0.02f);
+    mu_assert_int_eq(1, GetQueuedRadialImpulseCount());
+    ApplyAllGravitySources(&game, 0.02f);
+    mu_assert_int_eq(1, GetQueuedRadialImpulseCount());
+    ApplyAllGravitySources(&game, 0.02f);
+    mu_assert_int_eq(0, GetQueuedRadialImpulseCount());
+    grid = game.particleGrid;
+}
+
+MU_TEST(test_partial_impulse_is_identical_across_threads) {
+    RadialImpulse storm = { .center = { 400, 300 }, .radius = 200.0f, .minDistance = 1.0f,
+                            .strength = 3.0f, .probability = 0.7f };
+    QueueRadialImpulse(storm);
+    RunGravityPass(&reference);
+
+    // Same pass index, so the same particles draw a push
+    InitGravitySystem();
+    QueueRadialImpulse(storm);
+    mu_check(ThreadPool_Init(4));
+    RunGravityPass(&particles);
+
+    mu_check(memcmp(particles.vx, reference.vx, particles.count * sizeof(float)) == 0);
+    mu_check(memcmp(particles.vy, reference.vy, particles.count * sizeof(float)) == 0);
+
+    // Roughly 70% of the particles in range were pushed
+    int inRange = 0, pushed = 0;
+    for (int i = 0; i < particles.count; i++) {
+        float dx = particles.x[i] - 400.0f;
+        float dy = particles.y[i] - 300.0f;
+        float distSq = dx * dx + dy * dy;
+        if (distSq >= 200.0f * 200.0f || distSq <= 1.0f) continue;
+        inRange++;
+        if (particles.vx[i] != 0.0f || particles.vy[i] != 0.0f) pushed++;
+    }
+    mu_check(pushed > inRange * 6 / 10 && pushed < inRange * 8 / 10);
+}
+
+MU_TEST_SUITE(gravity_system_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_grid_pass_matches_reference);
+    MU_RUN_TEST(test_inactive_sources_are_skipped);
+    MU_RUN_TEST(test_grid_pass_is_identical_across_threads);
+    MU_RUN_TEST(test_field_matches_exact_path);
+    MU_RUN_TEST(test_field_rebakes_only_when_sources_change);
+    MU_RUN_TEST(test_field_bake_is_identical_across_threads);
+    MU_RUN_TEST(test_impulse_reaches_only_particles_in_range);
+    MU_RUN_TEST(test_timed_impulse_expires);
+    MU_RUN_TEST(test_partial_impulse_is_identical_across_threads);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(gravity_system_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
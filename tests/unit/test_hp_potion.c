@@ -1,18 +1,16 @@
 #include "../../src/minunit/minunit.h"
 #include "../../src/entities/items/hp_potion.h"
-#include "../../src/core/memory_pool.h"
-
-// Stub for testing - define uninitialized pool
-MemoryPool g_itemEventPool = {0};
+#include "../../src/core/event/event_system.h"
 
 static HPPotion testPotion;
 
 void test_setup(void) {
+    InitEventSystem();
     testPotion = InitHPPotion();
 }
 
 void test_teardown(void) {
-    // Nothing to clean up
+    CleanupEventSystem();
 }
 
 MU_TEST(test_hp_potion_init) {
@@ -0,0 +1,189 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/entities/particle.h"
+#include "../../src/entities/particle_buffer.h"
+#include "../../src/entities/particle_kernel.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KERNEL_TEST_WIDTH 800
+#define KERNEL_TEST_HEIGHT 600
+#define KERNEL_TEST_FRICTION 0.99f
+#define KERNEL_TEST_TOLERANCE 1e-3f
+
+static ParticleBuffer buffer;
+static Particle reference[1027];
+
+void test_setup(void) {
+    // Odd count so the SIMD loop always leaves a scalar tail
+    ParticleBuffer_Init(&buffer, 1027);
+}
+
+void test_teardown(void) {
+    ParticleBuffer_Destroy(&buffer);
+}
+
+static float RandomRange(float min, float max) {
+    return min + (rand() / (float)RAND_MAX) * (max - min);
+}
+
+static void StoreParticle(int i, float x, float y, float vx, float vy) {
+    reference[i] = (Particle){ .position = {x, y}, .velocity = {vx, vy}, .color = BLACK };
+    ParticleBuffer_Set(&buffer, i, reference[i]);
+}
+
+// Run the per-particle reference path and the kernel on the same input
+static void StepBoth(Vector2 attractor, float attraction) {
+    for (int i = 0; i < buffer.count; i++) {
+        AttractParticle(&reference[i], attractor, attraction);
+        ApplyFriction(&reference[i], KERNEL_TEST_FRICTION);
+        MoveParticle(&reference[i], KERNEL_TEST_WIDTH, KERNEL_TEST_HEIGHT);
+    }
+
+    ParticleStepParams params = ParticleKernel_MakeParams(attractor, attraction, KERNEL_TEST_FRICTION,
+                                                          KERNEL_TEST_WIDTH, KERNEL_TEST_HEIGHT);
+    ParticleKernel_Step(&buffer, 0, buffer.count, &params);
+}
+
+static int CountMismatches(void) {
+    int mismatches = 0;
+    for (int i = 0; i < buffer.count; i++) {
+        if (fabsf(buffer.x[i] - reference[i].position.x) > KERNEL_TEST_TOLERANCE ||
+            fabsf(buffer.y[i] - reference[i].position.y) > KERNEL_TEST_TOLERANCE ||
+            fabsf(buffer.vx[i] - reference[i].velocity.x) > KERNEL_TEST_TOLERANCE ||
+            fabsf(buffer.vy[i] - reference[i].velocity.y) > KERNEL_TEST_TOLERANCE) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+MU_TEST(test_kernel_matches_reference_interior) {
+    srand(1234);
+    for (int i = 0; i < buffer.count; i++) {
+        StoreParticle(i, RandomRange(1, 798), RandomRange(1, 598),
+                      RandomRange(-3, 3), RandomRange(-3, 3));
+    }
+
+    StepBoth((Vector2){400, 300}, 1.0f);
+
+    mu_assert_int_eq(0, CountMismatches());
+}
+
+MU_TEST(test_kernel_matches_reference_boundaries) {
+    // Particles pushed past every wall, sitting exactly on walls, and outside the screen
+    srand(99);
+    for (int i = 0; i < buffer.count; i++) {
+        float x, y;
+        switch (i % 6) {
+            case 0: x = 0.0f; y = RandomRange(0, 599); break;
+            case 1: x = 799.0f; y = RandomRange(0, 599); break;
+            case 2: x = RandomRange(0, 799); y = 0.0f; break;
+            case 3: x = RandomRange(0, 799); y = 599.0f; break;
+            case 4: x = RandomRange(-20, 0); y = RandomRange(600, 620); break;
+            default: x = RandomRange(800, 820); y = RandomRange(-20, 0); break;
+        }
+        StoreParticle(i, x, y, RandomRange(-12, 12), RandomRange(-12, 12));
+    }
+
+    StepBoth((Vector2){-300, 900}, 5.0f);
+
+    mu_assert_int_eq(0, CountMismatches());
+}
+
+MU_TEST(test_kernel_matches_reference_at_attractor) {
+    // Zero distance and sub-0.5 distances exercise the clamp in AttractParticle
+    for (int i = 0; i < buffer.count; i++) {
+        float offset = (i % 5) * 0.1f;
+        StoreParticle(i, 400.0f + offset, 300.0f - offset, 0.0f, 0.0f);
+    }
+
+    StepBoth((Vector2){400, 300}, 5.0f);
+
+    mu_assert_int_eq(0, CountMismatches());
+}
+
+MU_TEST(test_kernel_reflects_velocity_sign) {
+    StoreParticle(0, 1.0f, 1.0f, -5.0f, -5.0f);
+    StoreParticle(1, 798.0f, 598.0f, 5.0f, 5.0f);
+    for (int i = 2; i < buffer.count; i++) {
+        StoreParticle(i, 400.0f, 300.0f, 0.0f, 0.0f);
+    }
+
+    // No attraction so only friction and wall reflection apply
+    ParticleStepParams params = ParticleKernel_MakeParams((Vector2){400, 300}, 0.0f, 1.0f,
+                                                          KERNEL_TEST_WIDTH, KERNEL_TEST_HEIGHT);
+    ParticleKernel_Step(&buffer, 0, buffer.count, &params);
+
+    mu_assert_double_eq(0.0, buffer.x[0]);
+    mu_assert_double_eq(0.0, buffer.y[0]);
+    mu_assert(buffer.vx[0] > 0 && buffer.vy[0] > 0, "Velocity should reflect away from top-left walls");
+    mu_assert_double_eq(799.0, buffer.x[1]);
+    mu_assert_double_eq(599.0, buffer.y[1]);
+    mu_assert(buffer.vx[1] < 0 && buffer.vy[1] < 0, "Velocity should reflect away from bottom-right walls");
+}
+
+MU_TEST(test_kernel_partial_range) {
+    for (int i = 0; i < buffer.count; i++) {
+        StoreParticle(i, 100.0f, 100.0f, 1.0f, 1.0f);
+    }
+
+    // Only [5, 13) may change; the rest must be untouched
+    ParticleStepParams params = ParticleKernel_MakeParams((Vector2){400, 300}, 1.0f, KERNEL_TEST_FRICTION,
+                                                          KERNEL_TEST_WIDTH, KERNEL_TEST_HEIGHT);
+    ParticleKernel_Step(&buffer, 5, 13, &params);
+
+    mu_assert_double_eq(100.0, buffer.x[4]);
+    mu_assert(buffer.x[5] != 100.0f, "First particle in range should move");
+    mu_assert(buffer.x[12] != 100.0f, "Last particle in range should move");
+    mu_assert_double_eq(100.0, buffer.x[13]);
+}
+
+MU_TEST(test_kernel_stays_in_bounds) {
+    srand(7);
+    for (int i = 0; i < buffer.count; i++) {
+        StoreParticle(i, RandomRange(0, 799), RandomRange(0, 599),
+                      RandomRange(-10, 10), RandomRange(-10, 10));
+    }
+
+    ParticleStepParams params = ParticleKernel_MakeParams((Vector2){700, 50}, 5.0f, KERNEL_TEST_FRICTION,
+                                                          KERNEL_TEST_WIDTH, KERNEL_TEST_HEIGHT);
+    int outOfBounds = 0;
+    for (int frame = 0; frame < 200; frame++) {
+        ParticleKernel_Step(&buffer, 0, buffer.count, &params);
+        for (int i = 0; i < buffer.count; i++) {
+            if (buffer.x[i] < 0 || buffer.x[i] > 799 || buffer.y[i] < 0 || buffer.y[i] > 599) {
+                outOfBounds++;
+            }
+        }
+    }
+    mu_assert_int_eq(0, outOfBounds);
+}
+
+// make test-kernel builds this test once per path and names the one it expects
+MU_TEST(test_kernel_built_with_expected_path) {
+#if defined(KERNEL_TEST_EXPECT_PATH)
+    mu_check(strcmp(KERNEL_TEST_EXPECT_PATH, ParticleKernel_GetPathName()) == 0);
+#else
+    mu_check(ParticleKernel_GetPathName() != NULL);
+#endif
+}
+
+MU_TEST_SUITE(particle_kernel_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_kernel_matches_reference_interior);
+    MU_RUN_TEST(test_kernel_matches_reference_boundaries);
+    MU_RUN_TEST(test_kernel_matches_reference_at_attractor);
+    MU_RUN_TEST(test_kernel_reflects_velocity_sign);
+    MU_RUN_TEST(test_kernel_partial_range);
+    MU_RUN_TEST(test_kernel_stays_in_bounds);
+    MU_RUN_TEST(test_kernel_built_with_expected_path);
+}
+
+int main(int argc, char *argv[]) {
+    printf("Particle kernel path: %s\n", ParticleKernel_GetPathName());
+    MU_RUN_SUITE(particle_kernel_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
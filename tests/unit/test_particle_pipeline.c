@@ -0,0 +1,177 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/particle_pipeline.h"
+#include "../../src/core/thread_pool.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PIPELINE_TEST_WIDTH 800
+#define PIPELINE_TEST_HEIGHT 600
+#define PIPELINE_TEST_COUNT 30001
+
+static ParticlePipeline pipeline;
+static ParticleBuffer particles;
+static int hits[8];
+
+void test_setup(void) {
+    srand(77);
+    ParticlePipeline_Init(&pipeline, PIPELINE_TEST_WIDTH, PIPELINE_TEST_HEIGHT);
+    ParticleBuffer_Init(&particles, PIPELINE_TEST_COUNT);
+    for (int i = 0; i < particles.count; i++) {
+        particles.x[i] = (float)(rand() % PIPELINE_TEST_WIDTH);
+        particles.y[i] = (float)(rand() % PIPELINE_TEST_HEIGHT);
+        particles.vx[i] = 0.0f;
+        particles.vy[i] = 0.0f;
+    }
+    // No attraction or friction so only queued operators change velocities
+    pipeline.step = ParticleKernel_MakeParams((Vector2){0, 0}, 0.0f, 1.0f, PIPELINE_TEST_WIDTH, PIPELINE_TEST_HEIGHT);
+}
+
+void test_teardown(void) {
+    ParticleBuffer_Destroy(&particles);
+    ParticlePipeline_Destroy(&pipeline);
+    ThreadPool_Shutdown();
+}
+
+static const ContactTarget testTargets[] = {
+    { {400, 300}, 60.0f, 0.0f },
+    { {0, 0}, 25.0f, 0.0f },
+    { {790, 590}, 40.0f, 0.0f },
+    { {420, 310}, 15.0f, 0.0f },    // Overlaps the first target
+};
+
+static void CountHits(void) {
+    memset(hits, 0, sizeof(hits));
+    for (int w = 0; w < THREAD_POOL_MAX_THREADS; w++) {
+        for (int c = 0; c < pipeline.contacts[w].count; c++) {
+            hits[pipeline.contacts[w].items[c].target]++;
+        }
+    }
+}
+
+MU_TEST(test_contacts_match_brute_force) {
+    ParticlePipeline_SetContactTargets(&pipeline, testTargets, 4);
+    ParticlePipeline_Run(&pipeline, &particles);
+    CountHits();
+
+    int mismatches = 0;
+    for (int t = 0; t < 4; t++) {
+        int expected = 0;
+        float reach = testTargets[t].radius + 1.0f;
+        for (int p = 0; p < particles.count; p++) {
+            float dx = particles.x[p] - testTargets[t].position.x;
+            float dy = particles.y[p] - testTargets[t].position.y;
+            if (dx*dx + dy*dy <= reach * reach) expected++;
+        }
+        if (expected != hits[t]) mismatches++;
+    }
+    mu_assert_int_eq(0, mismatches);
+    mu_assert_int_eq(hits[0] + hits[1] + hits[2] + hits[3], ParticlePipeline_GetContactCount(&pipeline));
+}
+
+MU_TEST(test_contacts_independent_of_thread_count) {
+    ParticlePipeline_SetContactTargets(&pipeline, testTargets, 4);
+    ParticlePipeline_Run(&pipeline, &particles);
+    CountHits();
+    int single[4];
+    memcpy(single, hits, sizeof(single));
+
+    ThreadPool_Init(5);
+    ParticlePipeline_Run(&pipeline, &particles);
+    CountHits();
+
+    // Positions did not move (zero velocity), so both runs see the same contacts
+    mu_assert_int_eq(0, memcmp(single, hits, sizeof(single)));
+}
+
+MU_TEST(test_target_hits_reduce_identically_across_threads) {
+    ContactTarget targets[4];
+    memcpy(targets, testTargets, sizeof(targets));
+    targets[0].repelImpulse = 3.0f;
+    ParticleBuffer copy;
+    ParticleBuffer_Init(&copy, PIPELINE_TEST_COUNT);
+    memcpy(copy.x, particles.x, particles.count * sizeof(float));
+    memcpy(copy.y, particles.y, particles.count * sizeof(float));
+
+    ParticlePipeline_SetContactTargets(&pipeline, targets, 4);
+    ParticlePipeline_DetectContacts(&pipeline, &particles);
+    int single[4];
+    mu_assert_int_eq(4, ParticlePipeline_SumTargetHits(&pipeline, single));
+
+    ThreadPool_Init(6);
+    ParticlePipeline_DetectContacts(&pipeline, &copy);
+    int parallel[4];
+    ParticlePipeline_SumTargetHits(&pipeline, parallel);
+    CountHits();
+
+    // Per-worker counters agree with the contact lists and with the single-threaded pass
+    mu_assert_int_eq(0, memcmp(single, parallel, sizeof(single)));
+    mu_assert_int_eq(0, memcmp(hits, parallel, sizeof(parallel)));
+    mu_check(parallel[0] > 0);
+
+    // Repulsor impulses land on the same particles with the same values
+    int mismatches = 0;
+    for (int i = 0; i < particles.count; i++) {
+        if (particles.vx[i] != copy.vx[i] || particles.vy[i] != copy.vy[i]) mismatches++;
+        if (particles.x[i] != copy.x[i]) mismatches++;     // Contact pass does not integrate
+    }
+    ParticleBuffer_Destroy(&copy);
+    mu_assert_int_eq(0, mismatches);
+}
+
+MU_TEST(test_repel_impulse_points_away_from_target) {
+    ContactTarget repulsor = { {400, 300}, 30.0f, 3.0f };
+    particles.x[0] = 410.0f;
+    particles.y[0] = 300.0f;
+    particles.x[1] = 400.0f;
+    particles.y[1] = 280.0f;
+
+    ParticlePipeline_SetContactTargets(&pipeline, &repulsor, 1);
+    ParticlePipeline_Run(&pipeline, &particles);
+
+    mu_assert_double_eq(3.0, particles.vx[0]);
+    mu_assert_double_eq(0.0, particles.vy[0]);
+    mu_assert_double_eq(0.0, particles.vx[1]);
+    mu_assert_double_eq(-3.0, particles.vy[1]);
+}
+
+// 모든 파티클에 params 만큼 x 속도 추가
+static void PushRight(ParticleBuffer* particles, int begin, int end, const void* params) {
+    float push = *(const float*)params;
+    for (int p = begin; p < end; p++) {
+        particles->vx[p] += push;
+    }
+}
+
+MU_TEST(test_queued_forces_apply_to_one_run) {
+    static const float push = 2.0f;
+    int last = particles.count - 1;
+    particles.x[0] = particles.x[last] = 400.0f;    // Away from the reflecting edges
+    ParticlePipeline_SetContactTargets(&pipeline, NULL, 0);
+    ParticlePipeline_AddForce(&pipeline, PushRight, &push, true);
+    ParticlePipeline_AddForce(&pipeline, PushRight, &push, false);
+    ParticlePipeline_Run(&pipeline, &particles);
+
+    mu_assert_double_eq(4.0, particles.vx[0]);
+    mu_assert_double_eq(4.0, particles.vx[last]);
+    mu_assert_int_eq(0, pipeline.forceCount);
+
+    ParticlePipeline_Run(&pipeline, &particles);
+    mu_assert_double_eq(4.0, particles.vx[0]);
+}
+
+MU_TEST_SUITE(particle_pipeline_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_contacts_match_brute_force);
+    MU_RUN_TEST(test_contacts_independent_of_thread_count);
+    MU_RUN_TEST(test_target_hits_reduce_identically_across_threads);
+    MU_RUN_TEST(test_repel_impulse_points_away_from_target);
+    MU_RUN_TEST(test_queued_forces_apply_to_one_run);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(particle_pipeline_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
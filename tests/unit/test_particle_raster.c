@@ -0,0 +1,160 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/particle_raster.h"
+#include "../../src/core/thread_pool.h"
+#include "../../src/entities/particle_buffer.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RASTER_TEST_WIDTH 320
+#define RASTER_TEST_HEIGHT 200
+#define RASTER_TEST_COUNT 60000
+
+static ParticleRaster raster;
+static ParticleBuffer particles;
+static Color* reference;
+
+static const Color opaqueColor = { 200, 100, 50, 255 };
+static const Color translucentColor = { 10, 220, 240, 128 };
+
+void test_setup(void) {
+    srand(4242);
+    ParticleRaster_Init(&raster, RASTER_TEST_WIDTH, RASTER_TEST_HEIGHT);
+    ParticleBuffer_Init(&particles, RASTER_TEST_COUNT);
+    for (int i = 0; i < particles.count; i++) {
+        particles.x[i] = (float)rand() / (float)RAND_MAX * RASTER_TEST_WIDTH;
+        particles.y[i] = (float)rand() / (float)RAND_MAX * RASTER_TEST_HEIGHT;
+    }
+    reference = (Color*)malloc(RASTER_TEST_WIDTH * RASTER_TEST_HEIGHT * sizeof(Color));
+}
+
+void test_teardown(void) {
+    free(reference);
+    ParticleBuffer_Destroy(&particles);
+    ParticleRaster_Destroy(&raster);
+    ThreadPool_Shutdown();
+}
+
+static ParticleRasterSource SourceOf(int count, Color color) {
+    return (ParticleRasterSource){ .x = particles.x, .y = particles.y, .alpha = 1.0f,
+                                   .count = count, .color = color };
+}
+
+static int CountLitPixels(void) {
+    int lit = 0;
+    for (int i = 0; i < raster.width * raster.height; i++) {
+        if (raster.pixels[i].a != 0) lit++;
+    }
+    return lit;
+}
+
+MU_TEST(test_single_particle_lands_on_its_pixel) {
+    particles.x[0] = 17.9f;
+    particles.y[0] = 42.2f;
+    ParticleRasterSource source = SourceOf(1, opaqueColor);
+    ParticleRaster_Render(&raster, &source);
+
+    Color pixel = ParticleRaster_GetPixel(&raster, 17, 42);
+    mu_check(pixel.r == 200 && pixel.g == 100 && pixel.b == 50 && pixel.a == 255);
+    mu_assert_int_eq(1, CountLitPixels());
+}
+
+MU_TEST(test_overlapping_particles_blend_alpha) {
+    // n 개가 겹치면 알파 블렌딩을 n 번 한 것과 같은 1 - (1 - a)^n
+    for (int i = 0; i < 3; i++) {
+        particles.x[i] = 5.5f;
+        particles.y[i] = 6.5f;
+    }
+    particles.x[3] = 100.0f;
+    particles.y[3] = 100.0f;
+    ParticleRasterSource source = SourceOf(4, translucentColor);
+    ParticleRaster_Render(&raster, &source);
+
+    float a = 128.0f / 255.0f;
+    int expectedThree = (int)lroundf(255.0f * (1.0f - powf(1.0f - a, 3.0f)));
+    Color stacked = ParticleRaster_GetPixel(&raster, 5, 6);
+    Color single = ParticleRaster_GetPixel(&raster, 100, 100);
+    mu_check(stacked.r == 10 && stacked.g == 220 && stacked.b == 240);
+    mu_assert_int_eq(expectedThree, stacked.a);
+    mu_assert_int_eq(128, single.a);
+    mu_assert_int_eq(2, CountLitPixels());
+}
+
+MU_TEST(test_out_of_bounds_particles_are_clipped) {
+    float xs[] = { -0.5f, RASTER_TEST_WIDTH, 10.0f, 10.0f, NAN, RASTER_TEST_WIDTH - 0.01f };
+    float ys[] = { 10.0f, 10.0f, -3.0f, RASTER_TEST_HEIGHT, 10.0f, RASTER_TEST_HEIGHT - 0.01f };
+    for (int i = 0; i < 6; i++) {
+        particles.x[i] = xs[i];
+        particles.y[i] = ys[i];
+    }
+    ParticleRasterSource source = SourceOf(6, opaqueColor);
+    ParticleRaster_Render(&raster, &source);
+
+    mu_assert_int_eq(1, CountLitPixels());
+    mu_assert_int_eq(255, ParticleRaster_GetPixel(&raster, RASTER_TEST_WIDTH - 1, RASTER_TEST_HEIGHT - 1).a);
+}
+
+MU_TEST(test_interpolates_between_steps) {
+    float previousX[1] = { 10.0f };
+    float previousY[1] = { 20.0f };
+    particles.x[0] = 30.0f;
+    particles.y[0] = 60.0f;
+    ParticleRasterSource source = SourceOf(1, opaqueColor);
+    source.previousX = previousX;
+    source.previousY = previousY;
+    source.alpha = 0.25f;
+    ParticleRaster_Render(&raster, &source);
+
+    mu_assert_int_eq(255, ParticleRaster_GetPixel(&raster, 15, 30).a);
+    mu_assert_int_eq(1, CountLitPixels());
+}
+
+MU_TEST(test_frames_do_not_accumulate) {
+    ParticleRasterSource source = SourceOf(RASTER_TEST_COUNT, translucentColor);
+    ParticleRaster_Render(&raster, &source);
+
+    // 두 번째 프레임은 첫 프레임의 밀도를 이어받지 않아야 함
+    particles.x[0] = 1.0f;
+    particles.y[0] = 1.0f;
+    source.count = 1;
+    ParticleRaster_Render(&raster, &source);
+    mu_assert_int_eq(1, CountLitPixels());
+    mu_assert_int_eq(128, ParticleRaster_GetPixel(&raster, 1, 1).a);
+}
+
+MU_TEST(test_result_independent_of_thread_count) {
+    // 절반은 한 픽셀에 몰아서 여러 워커 레이어의 합과 포화를 함께 확인
+    for (int i = 0; i < RASTER_TEST_COUNT; i += 2) {
+        particles.x[i] = 160.0f;
+        particles.y[i] = 100.0f;
+    }
+    ParticleRasterSource source = SourceOf(RASTER_TEST_COUNT, translucentColor);
+    ParticleRaster_Render(&raster, &source);
+    memcpy(reference, raster.pixels, RASTER_TEST_WIDTH * RASTER_TEST_HEIGHT * sizeof(Color));
+    mu_assert_int_eq(255, ParticleRaster_GetPixel(&raster, 160, 100).a);
+
+    int threadCounts[] = { 3, 8 };
+    for (int t = 0; t < 2; t++) {
+        mu_check(ThreadPool_Init(threadCounts[t]));
+        ParticleRaster_Render(&raster, &source);
+        mu_check(memcmp(reference, raster.pixels, RASTER_TEST_WIDTH * RASTER_TEST_HEIGHT * sizeof(Color)) == 0);
+        ThreadPool_Shutdown();
+    }
+}
+
+MU_TEST_SUITE(particle_raster_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_single_particle_lands_on_its_pixel);
+    MU_RUN_TEST(test_overlapping_particles_blend_alpha);
+    MU_RUN_TEST(test_out_of_bounds_particles_are_clipped);
+    MU_RUN_TEST(test_interpolates_between_steps);
+    MU_RUN_TEST(test_frames_do_not_accumulate);
+    MU_RUN_TEST(test_result_independent_of_thread_count);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(particle_raster_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
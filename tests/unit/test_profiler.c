@@ -0,0 +1,140 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/profiler.h"
+#include "../../src/core/thread_pool.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_TRACE_PATH "test_profiler_trace.json"
+
+static void SpinNs(uint64_t ns) {
+    uint64_t start = Profiler_NowNs();
+    while (Profiler_NowNs() - start < ns) {
+    }
+}
+
+void test_setup(void) {
+    Profiler_Reset();
+}
+
+void test_teardown(void) {
+    ThreadPool_Shutdown();
+    remove(TEST_TRACE_PATH);
+}
+
+MU_TEST(test_zones_are_summed_per_frame) {
+    Profiler_BeginFrame();
+    Profiler_BeginZone(PROFILE_ZONE_PARTICLES);
+    SpinNs(200000);
+    Profiler_EndZone(PROFILE_ZONE_PARTICLES);
+    // 같은 구간이 한 프레임에 두 번 실행되면 합산
+    Profiler_BeginZone(PROFILE_ZONE_COLLISIONS);
+    SpinNs(100000);
+    Profiler_EndZone(PROFILE_ZONE_COLLISIONS);
+    Profiler_BeginZone(PROFILE_ZONE_COLLISIONS);
+    SpinNs(100000);
+    Profiler_EndZone(PROFILE_ZONE_COLLISIONS);
+    Profiler_EndFrame();
+
+    mu_assert_int_eq(1, Profiler_GetFrameCount());
+    const ProfileFrame* frame = Profiler_GetFrame(0);
+    mu_check(frame != NULL);
+    mu_assert_int_eq(3, frame->spanCount);
+    mu_check(frame->zoneNs[PROFILE_ZONE_PARTICLES] >= 200000);
+    mu_check(frame->zoneNs[PROFILE_ZONE_COLLISIONS] >= 200000);
+    mu_check(frame->zoneNs[PROFILE_ZONE_DRAW] == 0);
+    mu_check(frame->endNs - frame->startNs >= frame->zoneNs[PROFILE_ZONE_PARTICLES]
+                                              + frame->zoneNs[PROFILE_ZONE_COLLISIONS]);
+}
+
+MU_TEST(test_nested_zones_record_depth) {
+    Profiler_BeginFrame();
+    Profiler_BeginZone(PROFILE_ZONE_PARTICLES);
+    Profiler_BeginZone(PROFILE_ZONE_GRAVITY);
+    Profiler_EndZone(PROFILE_ZONE_GRAVITY);
+    // Left open: closed at the end of the frame
+    Profiler_EndFrame();
+
+    const ProfileFrame* frame = Profiler_GetFrame(0);
+    mu_assert_int_eq(2, frame->spanCount);
+    mu_assert_int_eq(0, frame->spans[0].depth);
+    mu_assert_int_eq(1, frame->spans[1].depth);
+    mu_check(frame->spans[0].endNs == frame->endNs);
+}
+
+MU_TEST(test_ring_buffer_keeps_latest_frames) {
+    for (int i = 0; i < PROFILER_HISTORY_FRAMES + 10; i++) {
+        Profiler_BeginFrame();
+        Profiler_EndFrame();
+    }
+
+    mu_assert_int_eq(PROFILER_HISTORY_FRAMES, Profiler_GetFrameCount());
+    const ProfileFrame* newest = Profiler_GetFrame(0);
+    const ProfileFrame* oldest = Profiler_GetFrame(PROFILER_HISTORY_FRAMES - 1);
+    mu_check(newest->index - oldest->index == PROFILER_HISTORY_FRAMES - 1);
+    mu_check(Profiler_GetFrame(PROFILER_HISTORY_FRAMES) == NULL);
+}
+
+static void AddWorkPerItem(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    (void)userData;
+    Profiler_AddWork(PROFILE_ZONE_GRAVITY, (uint64_t)(end - begin));
+}
+
+MU_TEST(test_work_from_workers_is_summed) {
+    mu_check(ThreadPool_Init(4));
+
+    Profiler_BeginFrame();
+    ThreadPool_ParallelFor(4096, 16, AddWorkPerItem, NULL);
+    Profiler_AddWork(PROFILE_ZONE_GRAVITY, 4);     // Main thread outside ParallelFor
+    Profiler_EndFrame();
+
+    const ProfileFrame* frame = Profiler_GetFrame(0);
+    mu_check(frame->zoneNs[PROFILE_ZONE_GRAVITY] == 4100);
+    mu_check(frame->workMask == (1u << PROFILE_ZONE_GRAVITY));
+}
+
+MU_TEST(test_chrome_trace_contains_zones) {
+    Profiler_BeginFrame();
+    Profiler_BeginZone(PROFILE_ZONE_DRAW);
+    Profiler_EndZone(PROFILE_ZONE_DRAW);
+    Profiler_AddWork(PROFILE_ZONE_GRAVITY, 1000);
+    Profiler_EndFrame();
+
+    mu_check(Profiler_WriteChromeTrace(TEST_TRACE_PATH));
+
+    char text[4096];
+    FILE* file = fopen(TEST_TRACE_PATH, "r");
+    mu_check(file != NULL);
+    size_t length = fread(text, 1, sizeof(text) - 1, file);
+    fclose(file);
+    text[length] = '\0';
+
+    mu_check(strncmp(text, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 39) == 0);
+    mu_check(strstr(text, "\"name\":\"draw\",\"cat\":\"zone\",\"ph\":\"X\"") != NULL);
+    mu_check(strstr(text, "\"name\":\"gravity cpu ms\"") != NULL);
+    mu_check(strstr(text, "\n]}\n") != NULL);
+}
+
+MU_TEST(test_zones_outside_frame_are_ignored) {
+    Profiler_BeginZone(PROFILE_ZONE_STAGE);
+    Profiler_EndZone(PROFILE_ZONE_STAGE);
+    mu_assert_int_eq(0, Profiler_GetFrameCount());
+    mu_check(Profiler_GetAverageMs(PROFILE_ZONE_STAGE, 60) == 0.0f);
+}
+
+MU_TEST_SUITE(profiler_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_zones_are_summed_per_frame);
+    MU_RUN_TEST(test_nested_zones_record_depth);
+    MU_RUN_TEST(test_ring_buffer_keeps_latest_frames);
+    MU_RUN_TEST(test_work_from_workers_is_summed);
+    MU_RUN_TEST(test_chrome_trace_contains_zones);
+    MU_RUN_TEST(test_zones_outside_frame_are_ignored);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(profiler_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
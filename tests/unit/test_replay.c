@@ -0,0 +1,147 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/replay.h"
+#include "raylib.h"
+#include <stddef.h>
+#include <stdio.h>
+
+#define TEST_REPLAY_PATH "test_replay.psr"
+#define TEST_FRAMES 120
+
+// Scripted input in place of raylib (recording samples these)
+static int scriptFrame;
+
+static bool ScriptKeyDown(int frame, int key) {
+    if (key == KEY_SPACE) return (frame / 10) % 2 == 1;    // Held for 10 frames, released for 10
+    if (key == KEY_RIGHT) return frame >= 30 && frame < 90;
+    if (key == KEY_ENTER) return frame == 5;
+    return false;
+}
+
+bool IsKeyDown(int key) { return ScriptKeyDown(scriptFrame, key); }
+bool IsKeyPressed(int key) { return ScriptKeyDown(scriptFrame, key) && !ScriptKeyDown(scriptFrame - 1, key); }
+bool IsKeyReleased(int key) { return !ScriptKeyDown(scriptFrame, key) && ScriptKeyDown(scriptFrame - 1, key); }
+float GetFrameTime(void) { return 0.01f + 0.001f * (float)(scriptFrame % 7); }
+double GetTime(void) { return 1000.0; }
+
+static void RecordScript(void) {
+    ReplayHeader header = { .seed = 987654321ull, .startingStage = 3, .testMode = 0, .particleCount = 5000 };
+    mu_check(Replay_StartRecording(TEST_REPLAY_PATH, &header));
+    for (scriptFrame = 0; scriptFrame < TEST_FRAMES; scriptFrame++) {
+        Replay_BeginFrame();
+    }
+    Replay_Stop();
+}
+
+void test_setup(void) {
+    scriptFrame = 0;
+}
+
+void test_teardown(void) {
+    Replay_Stop();
+    remove(TEST_REPLAY_PATH);
+}
+
+MU_TEST(test_off_mode_forwards_to_raylib) {
+    scriptFrame = 10;
+    mu_check(Replay_GetMode() == REPLAY_MODE_OFF);
+    mu_check(Replay_IsKeyDown(KEY_SPACE));
+    mu_check(Replay_IsKeyPressed(KEY_SPACE));
+    mu_assert_double_eq(1000.0, Replay_GetTime());
+    mu_check(!Replay_IsFinished());
+}
+
+MU_TEST(test_header_round_trip) {
+    RecordScript();
+
+    ReplayHeader header;
+    mu_check(Replay_StartPlayback(TEST_REPLAY_PATH, &header));
+    mu_check(header.seed == 987654321ull);
+    mu_assert_int_eq(3, header.startingStage);
+    mu_assert_int_eq(5000, header.particleCount);
+    mu_assert_int_eq(TEST_FRAMES, (int)header.frameCount);
+}
+
+MU_TEST(test_playback_reproduces_input_and_time) {
+    RecordScript();
+
+    ReplayHeader header;
+    mu_check(Replay_StartPlayback(TEST_REPLAY_PATH, &header));
+
+    int mismatches = 0;
+    double expectedTime = 0.0;
+    for (int frame = 0; frame < TEST_FRAMES; frame++) {
+        mu_check(!Replay_IsFinished());
+        // Live input is different during playback; only the file counts
+        scriptFrame = 1000 + frame;
+        Replay_BeginFrame();
+
+        int recorded = frame;
+        float dt = 0.01f + 0.001f * (float)(recorded % 7);
+        expectedTime += dt;
+        if (Replay_GetFrameTime() != dt) mismatches++;
+        if (Replay_IsKeyDown(KEY_SPACE) != ScriptKeyDown(recorded, KEY_SPACE)) mismatches++;
+        if (Replay_IsKeyDown(KEY_RIGHT) != ScriptKeyDown(recorded, KEY_RIGHT)) mismatches++;
+        if (frame > 0) {
+            bool pressed = ScriptKeyDown(recorded, KEY_SPACE) && !ScriptKeyDown(recorded - 1, KEY_SPACE);
+            bool released = !ScriptKeyDown(recorded, KEY_SPACE) && ScriptKeyDown(recorded - 1, KEY_SPACE);
+            if (Replay_IsKeyPressed(KEY_SPACE) != pressed) mismatches++;
+            if (Replay_IsKeyReleased(KEY_SPACE) != released) mismatches++;
+            if (Replay_IsKeyPressed(KEY_ENTER) != (recorded == 5)) mismatches++;
+        }
+        // Keys outside the mask never read as pressed
+        if (Replay_IsKeyDown(KEY_Q)) mismatches++;
+    }
+
+    mu_assert_int_eq(0, mismatches);
+    mu_check(fabs(Replay_GetTime() - expectedTime) < 1e-4);
+    mu_check(Replay_IsFinished());
+}
+
+MU_TEST(test_rejects_non_replay_file) {
+    FILE* file = fopen(TEST_REPLAY_PATH, "wb");
+    fputs("not a replay file at all, just text", file);
+    fclose(file);
+
+    ReplayHeader header;
+    mu_check(!Replay_StartPlayback(TEST_REPLAY_PATH, &header));
+    mu_check(Replay_GetMode() == REPLAY_MODE_OFF);
+}
+
+MU_TEST(test_frame_count_capped_to_file_length) {
+    RecordScript();
+
+    // 프레임 수가 손상된 헤더 (0xFFFFFFFF 는 + 1 하면 0 으로 넘침)
+    FILE* file = fopen(TEST_REPLAY_PATH, "r+b");
+    uint32_t corrupt = 0xFFFFFFFFu;
+    fseek(file, (long)offsetof(ReplayHeader, frameCount), SEEK_SET);
+    fwrite(&corrupt, sizeof(corrupt), 1, file);
+    fclose(file);
+
+    ReplayHeader header;
+    mu_check(Replay_StartPlayback(TEST_REPLAY_PATH, &header));
+    mu_assert_int_eq(TEST_FRAMES, (int)header.frameCount);
+
+    int frames = 0;
+    while (!Replay_IsFinished() && frames < 2 * TEST_FRAMES) {
+        Replay_BeginFrame();
+        frames++;
+    }
+    mu_assert_int_eq(TEST_FRAMES, frames);
+    Replay_Stop();
+}
+
+MU_TEST_SUITE(replay_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_off_mode_forwards_to_raylib);
+    MU_RUN_TEST(test_header_round_trip);
+    MU_RUN_TEST(test_playback_reproduces_input_and_time);
+    MU_RUN_TEST(test_rejects_non_replay_file);
+    MU_RUN_TEST(test_frame_count_capped_to_file_length);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(replay_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
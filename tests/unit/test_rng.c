@@ -0,0 +1,128 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/rng.h"
+#include <string.h>
+
+#define RNG_TEST_FILL_COUNT 1003
+
+static float fillA[RNG_TEST_FILL_COUNT];
+static float fillB[RNG_TEST_FILL_COUNT];
+
+void test_setup(void) {
+    Rng_SetSeed(12345);
+}
+
+void test_teardown(void) {
+}
+
+MU_TEST(test_philox_known_answers) {
+    // Philox4x32-10 reference vectors (Random123 kat_vectors)
+    uint32_t words[4];
+
+    Rng_SetSeed(0);
+    Rng_Block(0, 0, 0, words);
+    mu_check(words[0] == 0x6627e8d5u && words[1] == 0xe169c58du);
+    mu_check(words[2] == 0xbc57ac4cu && words[3] == 0x9b00dbd8u);
+
+    Rng_SetSeed(0xffffffffffffffffull);
+    Rng_Block((RngStream)0xffffffffu, 0xffffffffu, 0xffffffffffffffffull, words);
+    mu_check(words[0] == 0x408f276du && words[1] == 0x41c83b0eu);
+    mu_check(words[2] == 0xa20bc7c6u && words[3] == 0x6d5451fdu);
+}
+
+MU_TEST(test_fill_matches_block_layout) {
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 3, 10, fillA, RNG_TEST_FILL_COUNT, 0.0f, 1.0f);
+
+    int mismatches = 0;
+    for (int i = 0; i < RNG_TEST_FILL_COUNT; i++) {
+        uint32_t words[4];
+        Rng_Block(RNG_STREAM_PARTICLE_INIT, 3, 10 + i / 4, words);
+        if (fillA[i] != Rng_ToUnitFloat(words[i % 4])) mismatches++;
+    }
+    mu_assert_int_eq(0, mismatches);
+}
+
+MU_TEST(test_fill_sub_range_is_reproducible) {
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 0, 0, fillA, RNG_TEST_FILL_COUNT, -1.0f, 1.0f);
+    // Regenerate from element 500 (block 125) on
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 0, 125, fillB, RNG_TEST_FILL_COUNT - 500, -1.0f, 1.0f);
+
+    mu_assert_int_eq(0, memcmp(fillA + 500, fillB, (RNG_TEST_FILL_COUNT - 500) * sizeof(float)));
+
+    int outOfRange = 0;
+    for (int i = 0; i < RNG_TEST_FILL_COUNT; i++) {
+        if (fillA[i] < -1.0f || fillA[i] >= 1.0f) outOfRange++;
+    }
+    mu_assert_int_eq(0, outOfRange);
+}
+
+MU_TEST(test_streams_lanes_and_seeds_differ) {
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 0, 0, fillA, 64, 0.0f, 1.0f);
+
+    Rng_FillUniform(RNG_STREAM_PARTICLE_FORCE, 0, 0, fillB, 64, 0.0f, 1.0f);
+    mu_check(memcmp(fillA, fillB, 64 * sizeof(float)) != 0);
+
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 1, 0, fillB, 64, 0.0f, 1.0f);
+    mu_check(memcmp(fillA, fillB, 64 * sizeof(float)) != 0);
+
+    Rng_SetSeed(54321);
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 0, 0, fillB, 64, 0.0f, 1.0f);
+    mu_check(memcmp(fillA, fillB, 64 * sizeof(float)) != 0);
+
+    Rng_SetSeed(12345);
+    Rng_FillUniform(RNG_STREAM_PARTICLE_INIT, 0, 0, fillB, 64, 0.0f, 1.0f);
+    mu_assert_int_eq(0, memcmp(fillA, fillB, 64 * sizeof(float)));
+}
+
+MU_TEST(test_sequential_int_range_and_coverage) {
+    Rng rng;
+    Rng_Init(&rng, RNG_STREAM_GAMEPLAY, 0);
+
+    int buckets[21] = {0};
+    int outOfRange = 0;
+    for (int i = 0; i < 21000; i++) {
+        int value = Rng_NextInt(&rng, -10, 10);
+        if (value < -10 || value > 10) {
+            outOfRange++;
+        } else {
+            buckets[value + 10]++;
+        }
+    }
+    mu_assert_int_eq(0, outOfRange);
+
+    // Each bucket expects 1000 hits; allow a generous margin
+    int skewed = 0;
+    for (int b = 0; b < 21; b++) {
+        if (buckets[b] < 800 || buckets[b] > 1200) skewed++;
+    }
+    mu_assert_int_eq(0, skewed);
+
+    mu_assert_int_eq(7, Rng_NextInt(&rng, 7, 7));
+}
+
+MU_TEST(test_sequential_matches_blocks) {
+    Rng rng;
+    Rng_Init(&rng, RNG_STREAM_GAMEPLAY, 9);
+
+    uint32_t words[4];
+    Rng_Block(RNG_STREAM_GAMEPLAY, 9, 1, words);
+    for (int i = 0; i < 4; i++) Rng_NextU32(&rng);
+    mu_check(Rng_NextU32(&rng) == words[0]);
+    mu_check(Rng_NextU32(&rng) == words[1]);
+}
+
+MU_TEST_SUITE(rng_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_philox_known_answers);
+    MU_RUN_TEST(test_fill_matches_block_layout);
+    MU_RUN_TEST(test_fill_sub_range_is_reproducible);
+    MU_RUN_TEST(test_streams_lanes_and_seeds_differ);
+    MU_RUN_TEST(test_sequential_int_range_and_coverage);
+    MU_RUN_TEST(test_sequential_matches_blocks);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(rng_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
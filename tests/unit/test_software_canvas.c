@@ -0,0 +1,205 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/render/software_canvas.h"
+#include "../../src/render/render.h"
+#include <math.h>
+
+#define CANVAS_TEST_WIDTH 64
+#define CANVAS_TEST_HEIGHT 48
+
+static SoftwareCanvas canvas;
+
+static const Color opaqueColor = { 200, 100, 50, 255 };
+static const Color translucentColor = { 255, 0, 0, 128 };
+
+void test_setup(void) {
+    SoftwareCanvas_Init(&canvas, CANVAS_TEST_WIDTH, CANVAS_TEST_HEIGHT);
+}
+
+void test_teardown(void) {
+    SoftwareCanvas_Destroy(&canvas);
+    Render_Shutdown();
+}
+
+static bool SameColor(Color a, Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+// 검은 배경에서 바뀐 픽셀 수
+static int CountLitPixels(void) {
+    int lit = 0;
+    for (int i = 0; i < canvas.width * canvas.height; i++) {
+        if (!SameColor(canvas.pixels[i], BLACK)) lit++;
+    }
+    return lit;
+}
+
+static bool IsLit(int x, int y) {
+    return !SameColor(SoftwareCanvas_GetPixel(&canvas, x, y), BLACK);
+}
+
+MU_TEST(test_fill_rect_covers_exact_pixels_and_clips) {
+    SoftwareCanvas_FillRect(&canvas, 2, 3, 4, 2, opaqueColor);
+    mu_assert_int_eq(8, CountLitPixels());
+    mu_check(SameColor(opaqueColor, SoftwareCanvas_GetPixel(&canvas, 2, 3)));
+    mu_check(SameColor(opaqueColor, SoftwareCanvas_GetPixel(&canvas, 5, 4)));
+    mu_check(!IsLit(6, 4) && !IsLit(5, 5));
+
+    SoftwareCanvas_Clear(&canvas, BLACK);
+    SoftwareCanvas_FillRect(&canvas, -5, -5, 10, 10, opaqueColor);
+    SoftwareCanvas_FillRect(&canvas, CANVAS_TEST_WIDTH - 1, CANVAS_TEST_HEIGHT - 1, 10, 10, opaqueColor);
+    mu_assert_int_eq(26, CountLitPixels());
+}
+
+MU_TEST(test_alpha_blends_like_raylib) {
+    // (255, 0, 0, 128) over opaque black -> src * a + dst * (1 - a), alpha stays opaque
+    SoftwareCanvas_DrawPixel(&canvas, 1, 1, translucentColor);
+    Color pixel = SoftwareCanvas_GetPixel(&canvas, 1, 1);
+    mu_assert_int_eq(128, pixel.r);
+    mu_assert_int_eq(0, pixel.g);
+    mu_assert_int_eq(255, pixel.a);
+
+    // 투명 색은 아무것도 바꾸지 않음
+    SoftwareCanvas_FillRect(&canvas, 0, 0, CANVAS_TEST_WIDTH, CANVAS_TEST_HEIGHT, BLANK);
+    mu_assert_int_eq(1, CountLitPixels());
+}
+
+MU_TEST(test_stroke_rect_blends_each_border_pixel_once) {
+    SoftwareCanvas_StrokeRect(&canvas, 10, 10, 5, 4, translucentColor);
+    mu_assert_int_eq(2 * 5 + 2 * 2, CountLitPixels());
+
+    // 모서리와 변 중간이 같은 값이어야 모서리가 두 번 칠해지지 않은 것
+    Color corner = SoftwareCanvas_GetPixel(&canvas, 10, 10);
+    mu_check(SameColor(corner, SoftwareCanvas_GetPixel(&canvas, 14, 13)));
+    mu_check(SameColor(corner, SoftwareCanvas_GetPixel(&canvas, 12, 10)));
+    mu_check(SameColor(corner, SoftwareCanvas_GetPixel(&canvas, 10, 11)));
+    mu_check(!IsLit(11, 11) && !IsLit(13, 12));
+}
+
+MU_TEST(test_fill_circle_matches_pixel_centers) {
+    float cx = 20.0f, cy = 24.0f, radius = 6.0f;
+    SoftwareCanvas_FillCircle(&canvas, cx, cy, radius, opaqueColor);
+
+    int expected = 0;
+    for (int y = 0; y < CANVAS_TEST_HEIGHT; y++) {
+        for (int x = 0; x < CANVAS_TEST_WIDTH; x++) {
+            float dx = x + 0.5f - cx;
+            float dy = y + 0.5f - cy;
+            bool inside = dx * dx + dy * dy <= radius * radius;
+            if (inside) expected++;
+            mu_check(inside == IsLit(x, y));
+        }
+    }
+    mu_assert_int_eq(expected, CountLitPixels());
+}
+
+MU_TEST(test_stroke_circle_is_one_pixel_ring) {
+    float cx = 32.0f, cy = 24.0f, radius = 5.0f;
+    SoftwareCanvas_StrokeCircle(&canvas, cx, cy, radius, opaqueColor);
+
+    for (int y = 0; y < CANVAS_TEST_HEIGHT; y++) {
+        for (int x = 0; x < CANVAS_TEST_WIDTH; x++) {
+            float distance = sqrtf((x + 0.5f - cx) * (x + 0.5f - cx) + (y + 0.5f - cy) * (y + 0.5f - cy));
+            bool onRing = fabsf(distance - radius) <= 0.5f;
+            mu_check(onRing == IsLit(x, y));
+        }
+    }
+    mu_check(!IsLit(31, 23));
+}
+
+MU_TEST(test_lines_thin_and_thick) {
+    SoftwareCanvas_DrawLine(&canvas, 0.0f, 5.0f, 9.0f, 5.0f, 1.0f, opaqueColor);
+    mu_assert_int_eq(10, CountLitPixels());
+    mu_check(IsLit(0, 5) && IsLit(9, 5) && !IsLit(10, 5));
+
+    SoftwareCanvas_Clear(&canvas, BLACK);
+    SoftwareCanvas_DrawLine(&canvas, 0.0f, 0.0f, 7.0f, 7.0f, 1.0f, opaqueColor);
+    mu_assert_int_eq(8, CountLitPixels());
+    for (int i = 0; i < 8; i++) mu_check(IsLit(i, i));
+
+    // 4 픽셀 굵기: 중심이 선에서 2 이내인 행 38..41
+    SoftwareCanvas_Clear(&canvas, BLACK);
+    SoftwareCanvas_DrawLine(&canvas, 10.0f, 40.0f, 30.0f, 40.0f, 4.0f, opaqueColor);
+    mu_check(IsLit(20, 38) && IsLit(20, 41));
+    mu_check(!IsLit(20, 37) && !IsLit(20, 42));
+    mu_check(!IsLit(5, 40) && !IsLit(35, 40));
+}
+
+MU_TEST(test_text_glyph_and_measure) {
+    // 'I' = 가운데 열 전체와 양 끝 행, 셀 위 1 픽셀 여백
+    SoftwareCanvas_DrawText(&canvas, "I", 0, 0, 10, WHITE);
+    for (int row = 1; row <= 7; row++) mu_check(IsLit(2, row));
+    mu_check(!IsLit(2, 0) && !IsLit(2, 8));
+    mu_check(IsLit(1, 1) && IsLit(1, 7) && !IsLit(1, 4));
+    mu_check(!IsLit(0, 4) && !IsLit(4, 4));
+
+    // fontSize 20 은 두 배 크기
+    SoftwareCanvas_Clear(&canvas, BLACK);
+    SoftwareCanvas_DrawText(&canvas, "I", 0, 0, 20, WHITE);
+    mu_check(IsLit(4, 2) && IsLit(5, 15) && !IsLit(4, 16) && !IsLit(6, 8));
+
+    // 글자 폭 5 + 간격 fontSize / 10, 마지막 간격 제외
+    mu_assert_int_eq(11, SoftwareCanvas_MeasureText("AB", 10));
+    mu_assert_int_eq(22, SoftwareCanvas_MeasureText("AB", 20));
+    mu_assert_int_eq(17, SoftwareCanvas_MeasureText("A\nABC", 10));
+    mu_assert_int_eq(0, SoftwareCanvas_MeasureText("", 10));
+}
+
+MU_TEST(test_draw_image_skips_transparent_and_clips) {
+    Color image[4] = { opaqueColor, BLANK, translucentColor, opaqueColor };
+    SoftwareCanvas_DrawImage(&canvas, image, 2, 2, 3, 4);
+    mu_assert_int_eq(3, CountLitPixels());
+    mu_check(SameColor(opaqueColor, SoftwareCanvas_GetPixel(&canvas, 3, 4)));
+    mu_check(!IsLit(4, 4));
+    mu_assert_int_eq(128, SoftwareCanvas_GetPixel(&canvas, 3, 5).r);
+
+    SoftwareCanvas_Clear(&canvas, BLACK);
+    SoftwareCanvas_DrawImage(&canvas, image, 2, 2, -1, CANVAS_TEST_HEIGHT - 1);
+    mu_assert_int_eq(0, CountLitPixels());
+    SoftwareCanvas_DrawImage(&canvas, image, 2, 2, CANVAS_TEST_WIDTH - 1, -1);
+    mu_assert_int_eq(1, CountLitPixels());
+    mu_check(IsLit(CANVAS_TEST_WIDTH - 1, 0));
+}
+
+MU_TEST(test_render_dispatches_to_software_backend) {
+    mu_assert_int_eq(RENDER_BACKEND_SOFTWARE, Render_ParseBackendType("software"));
+    mu_assert_int_eq(RENDER_BACKEND_RAYLIB, Render_ParseBackendType("vulkan"));
+    mu_check(Render_GetFramebuffer(NULL, NULL) == NULL);
+
+    mu_check(Render_Init(RENDER_BACKEND_SOFTWARE, 32, 16));
+    mu_assert_int_eq(RENDER_BACKEND_SOFTWARE, Render_GetBackendType());
+    Render_ClearBackground(BLUE);
+    Render_DrawRectangle(4, 4, 2, 2, RED);
+
+    int width = 0, height = 0;
+    const Color* frame = Render_GetFramebuffer(&width, &height);
+    mu_check(frame != NULL);
+    mu_assert_int_eq(32, width);
+    mu_assert_int_eq(16, height);
+    mu_check(SameColor(BLUE, frame[0]));
+    mu_check(SameColor(RED, frame[5 * width + 5]));
+    mu_assert_int_eq(SoftwareCanvas_MeasureText("FPS", 20), Render_MeasureText("FPS", 20));
+
+    Render_Shutdown();
+    mu_assert_int_eq(RENDER_BACKEND_RAYLIB, Render_GetBackendType());
+    mu_check(Render_GetFramebuffer(NULL, NULL) == NULL);
+}
+
+MU_TEST_SUITE(software_canvas_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_fill_rect_covers_exact_pixels_and_clips);
+    MU_RUN_TEST(test_alpha_blends_like_raylib);
+    MU_RUN_TEST(test_stroke_rect_blends_each_border_pixel_once);
+    MU_RUN_TEST(test_fill_circle_matches_pixel_centers);
+    MU_RUN_TEST(test_stroke_circle_is_one_pixel_ring);
+    MU_RUN_TEST(test_lines_thin_and_thick);
+    MU_RUN_TEST(test_text_glyph_and_measure);
+    MU_RUN_TEST(test_draw_image_skips_transparent_and_clips);
+    MU_RUN_TEST(test_render_dispatches_to_software_backend);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(software_canvas_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
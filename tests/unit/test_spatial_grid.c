@@ -0,0 +1,167 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/spatial_grid.h"
+#include "../../src/entities/particle_buffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define GRID_TEST_WIDTH 800
+#define GRID_TEST_HEIGHT 600
+#define GRID_TEST_COUNT 20000
+
+static ParticleBuffer particles;
+static SpatialGrid grid;
+static unsigned char seen[GRID_TEST_COUNT];
+
+void test_setup(void) {
+    srand(2024);
+    ParticleBuffer_Init(&particles, GRID_TEST_COUNT);
+    for (int i = 0; i < particles.count; i++) {
+        particles.x[i] = (float)(rand() % GRID_TEST_WIDTH);
+        particles.y[i] = (float)(rand() % GRID_TEST_HEIGHT);
+    }
+    SpatialGrid_Init(&grid, GRID_TEST_WIDTH, GRID_TEST_HEIGHT, PARTICLE_GRID_CELL_SIZE, particles.count);
+}
+
+void test_teardown(void) {
+    SpatialGrid_Destroy(&grid);
+    ParticleBuffer_Destroy(&particles);
+}
+
+// Every particle appears exactly once, in the span of the cell its position maps to
+static int CountGridErrors(void) {
+    int errors = 0;
+    memset(seen, 0, sizeof(seen));
+
+    if (grid.cellStart[0] != 0 || grid.cellStart[grid.cellCount] != particles.count) errors++;
+    for (int c = 0; c < grid.cellCount; c++) {
+        if (grid.cellStart[c] > grid.cellStart[c + 1]) errors++;
+        for (int s = grid.cellStart[c]; s < grid.cellStart[c + 1]; s++) {
+            int p = grid.sorted[s];
+            if (seen[p]++) errors++;
+            if (grid.slotOf[p] != s) errors++;
+            if (SpatialGrid_CellOf(&grid, particles.x[p], particles.y[p]) != c) errors++;
+        }
+    }
+    for (int p = 0; p < particles.count; p++) {
+        if (!seen[p]) errors++;
+    }
+    return errors;
+}
+
+// Particles found through the grid within `radius` of `center`, compared to a brute-force scan
+static int CountQueryMismatches(Vector2 center, float radius) {
+    memset(seen, 0, sizeof(seen));
+
+    int colBegin = SpatialGrid_Col(&grid, center.x - radius);
+    int colEnd = SpatialGrid_Col(&grid, center.x + radius);
+    int rowBegin = SpatialGrid_Row(&grid, center.y - radius);
+    int rowEnd = SpatialGrid_Row(&grid, center.y + radius);
+    for (int row = rowBegin; row <= rowEnd; row++) {
+        int begin, end;
+        SpatialGrid_RowSpan(&grid, row, colBegin, colEnd, &begin, &end);
+        for (int s = begin; s < end; s++) {
+            int p = grid.sorted[s];
+            float dx = particles.x[p] - center.x;
+            float dy = particles.y[p] - center.y;
+            if (dx*dx + dy*dy <= radius*radius) seen[p] = 1;
+        }
+    }
+
+    int mismatches = 0;
+    for (int p = 0; p < particles.count; p++) {
+        float dx = particles.x[p] - center.x;
+        float dy = particles.y[p] - center.y;
+        bool inside = dx*dx + dy*dy <= radius*radius;
+        if (inside != (seen[p] != 0)) mismatches++;
+    }
+    return mismatches;
+}
+
+MU_TEST(test_grid_rebuild_is_consistent) {
+    SpatialGrid_Update(&grid, &particles);
+
+    mu_check(grid.lastRebuilt);
+    mu_assert_int_eq(0, CountGridErrors());
+}
+
+MU_TEST(test_grid_query_matches_brute_force) {
+    SpatialGrid_Update(&grid, &particles);
+
+    Vector2 centers[] = { {400, 300}, {0, 0}, {799, 599}, {5, 590}, {123.5f, 77.25f} };
+    float radii[] = { 61.0f, 16.0f, 40.0f, 9.0f, 120.0f };
+    for (int i = 0; i < 5; i++) {
+        mu_assert_int_eq(0, CountQueryMismatches(centers[i], radii[i]));
+    }
+}
+
+MU_TEST(test_grid_incremental_update_small_moves) {
+    SpatialGrid_Update(&grid, &particles);
+
+    // Nudge a few particles across cell boundaries in every direction
+    for (int frame = 0; frame < 20; frame++) {
+        for (int k = 0; k < 50; k++) {
+            int p = rand() % particles.count;
+            particles.x[p] += (float)(rand() % 41 - 20);
+            particles.y[p] += (float)(rand() % 41 - 20);
+            if (particles.x[p] < 0) particles.x[p] = 0;
+            if (particles.y[p] < 0) particles.y[p] = 0;
+            if (particles.x[p] > GRID_TEST_WIDTH - 1) particles.x[p] = GRID_TEST_WIDTH - 1;
+            if (particles.y[p] > GRID_TEST_HEIGHT - 1) particles.y[p] = GRID_TEST_HEIGHT - 1;
+        }
+        SpatialGrid_Update(&grid, &particles);
+        mu_check(!grid.lastRebuilt);
+        mu_assert_int_eq(0, CountGridErrors());
+    }
+
+    mu_assert_int_eq(0, CountQueryMismatches((Vector2){300, 200}, 50.0f));
+}
+
+MU_TEST(test_grid_large_moves_fall_back_to_rebuild) {
+    SpatialGrid_Update(&grid, &particles);
+
+    for (int i = 0; i < particles.count; i++) {
+        particles.x[i] = (float)(rand() % GRID_TEST_WIDTH);
+        particles.y[i] = (float)(rand() % GRID_TEST_HEIGHT);
+    }
+    SpatialGrid_Update(&grid, &particles);
+
+    mu_check(grid.lastRebuilt);
+    mu_assert_int_eq(0, CountGridErrors());
+}
+
+MU_TEST(test_grid_clamps_out_of_screen_positions) {
+    particles.x[0] = -50.0f;
+    particles.y[0] = 5000.0f;
+    SpatialGrid_Update(&grid, &particles);
+
+    mu_assert_int_eq((grid.rows - 1) * grid.cols, grid.cellOf[0]);
+    mu_assert_int_eq(0, CountGridErrors());
+}
+
+// Init 이 실패한 (배열이 없는) 그리드는 갱신해도 아무것도 하지 않음
+MU_TEST(test_failed_init_grid_update_is_noop) {
+    SpatialGrid failed;
+    mu_check(!SpatialGrid_Init(&failed, GRID_TEST_WIDTH, GRID_TEST_HEIGHT, 0.0f, particles.count));
+    mu_check(failed.cellStart == NULL);
+
+    SpatialGrid_Update(&failed, &particles);
+    mu_check(!failed.built);
+    SpatialGrid_Destroy(&failed);
+}
+
+MU_TEST_SUITE(spatial_grid_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_grid_rebuild_is_consistent);
+    MU_RUN_TEST(test_grid_query_matches_brute_force);
+    MU_RUN_TEST(test_grid_incremental_update_small_moves);
+    MU_RUN_TEST(test_grid_large_moves_fall_back_to_rebuild);
+    MU_RUN_TEST(test_grid_clamps_out_of_screen_positions);
+    MU_RUN_TEST(test_failed_init_grid_update_is_noop);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(spatial_grid_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}
@@ -0,0 +1,153 @@
+#include "../../src/minunit/minunit.h"
+#include "../../src/core/thread_pool.h"
+#include "../../src/entities/particle_buffer.h"
+#include "../../src/entities/particle_kernel.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define POOL_TEST_COUNT 100003
+
+static int visits[POOL_TEST_COUNT];
+
+void test_setup(void) {
+    memset(visits, 0, sizeof(visits));
+}
+
+void test_teardown(void) {
+    ThreadPool_Shutdown();
+}
+
+static void CountVisits(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    (void)userData;
+    for (int i = begin; i < end; i++) {
+        visits[i]++;
+    }
+}
+
+static int CountBadVisits(int count) {
+    int bad = 0;
+    for (int i = 0; i < count; i++) {
+        if (visits[i] != 1) bad++;
+    }
+    return bad;
+}
+
+typedef struct {
+    ParticleBuffer* particles;
+    ParticleStepParams params;
+} KernelJob;
+
+static void StepRange(int begin, int end, int worker, void* userData) {
+    (void)worker;
+    KernelJob* job = (KernelJob*)userData;
+    ParticleKernel_Step(job->particles, begin, end, &job->params);
+}
+
+// Run 60 frames of the particle kernel on `threads` threads from a fixed start state
+static void SimulateWithThreads(ParticleBuffer* buffer, int threads) {
+    ThreadPool_Init(threads);
+
+    srand(42);
+    for (int i = 0; i < buffer->count; i++) {
+        buffer->x[i] = (float)(rand() % 800);
+        buffer->y[i] = (float)(rand() % 600);
+        buffer->vx[i] = (rand() % 200 - 100) / 50.0f;
+        buffer->vy[i] = (rand() % 200 - 100) / 50.0f;
+    }
+
+    KernelJob job = { buffer, ParticleKernel_MakeParams((Vector2){300, 200}, 5.0f, 0.99f, 800, 600) };
+    for (int frame = 0; frame < 60; frame++) {
+        ThreadPool_ParallelFor(buffer->count, 1024, StepRange, &job);
+    }
+
+    ThreadPool_Shutdown();
+}
+
+MU_TEST(test_ranges_cover_every_item_once) {
+    int counts[] = { 1, 15, 16, 17, 1000, POOL_TEST_COUNT };
+    for (int c = 0; c < 6; c++) {
+        for (int parts = 1; parts <= 9; parts++) {
+            memset(visits, 0, sizeof(visits));
+            for (int p = 0; p < parts; p++) {
+                int begin, end;
+                ThreadPool_GetRange(counts[c], p, parts, &begin, &end);
+                CountVisits(begin, end, p, NULL);
+            }
+            mu_assert_int_eq(0, CountBadVisits(counts[c]));
+        }
+    }
+}
+
+MU_TEST(test_ranges_are_aligned) {
+    for (int parts = 2; parts <= 16; parts++) {
+        int misaligned = 0;
+        for (int p = 0; p < parts; p++) {
+            int begin, end;
+            ThreadPool_GetRange(POOL_TEST_COUNT, p, parts, &begin, &end);
+            if (begin % THREAD_POOL_RANGE_ALIGNMENT != 0 && begin != POOL_TEST_COUNT) misaligned++;
+        }
+        mu_assert_int_eq(0, misaligned);
+    }
+}
+
+MU_TEST(test_parallel_for_visits_every_item_once) {
+    mu_check(ThreadPool_Init(8));
+    mu_assert_int_eq(8, ThreadPool_GetThreadCount());
+
+    // Repeated dispatches reuse the same workers
+    for (int round = 0; round < 50; round++) {
+        ThreadPool_ParallelFor(POOL_TEST_COUNT, 1000, CountVisits, NULL);
+    }
+    int wrong = 0;
+    for (int i = 0; i < POOL_TEST_COUNT; i++) {
+        if (visits[i] != 50) wrong++;
+    }
+    mu_assert_int_eq(0, wrong);
+}
+
+MU_TEST(test_parallel_for_small_input_runs_inline) {
+    mu_check(ThreadPool_Init(4));
+
+    ThreadPool_ParallelFor(100, 1000, CountVisits, NULL);
+
+    mu_assert_int_eq(0, CountBadVisits(100));
+}
+
+MU_TEST(test_kernel_result_independent_of_thread_count) {
+    ParticleBuffer single, multi;
+    ParticleBuffer_Init(&single, 50001);
+    ParticleBuffer_Init(&multi, 50001);
+
+    SimulateWithThreads(&single, 1);
+    int mismatches = 0;
+    int threadCounts[] = { 2, 3, 7, 16 };
+    for (int t = 0; t < 4; t++) {
+        SimulateWithThreads(&multi, threadCounts[t]);
+        size_t bytes = (size_t)single.count * sizeof(float);
+        if (memcmp(single.x, multi.x, bytes) != 0 || memcmp(single.y, multi.y, bytes) != 0 ||
+            memcmp(single.vx, multi.vx, bytes) != 0 || memcmp(single.vy, multi.vy, bytes) != 0) {
+            mismatches++;
+        }
+    }
+    mu_assert_int_eq(0, mismatches);
+
+    ParticleBuffer_Destroy(&single);
+    ParticleBuffer_Destroy(&multi);
+}
+
+MU_TEST_SUITE(thread_pool_suite) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(test_ranges_cover_every_item_once);
+    MU_RUN_TEST(test_ranges_are_aligned);
+    MU_RUN_TEST(test_parallel_for_visits_every_item_once);
+    MU_RUN_TEST(test_parallel_for_small_input_runs_inline);
+    MU_RUN_TEST(test_kernel_result_independent_of_thread_count);
+}
+
+int main(int argc, char *argv[]) {
+    MU_RUN_SUITE(thread_pool_suite);
+    MU_REPORT();
+    return MU_EXIT_CODE;
+}